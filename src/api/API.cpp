@@ -21,6 +21,7 @@
 
 #include "API.h"
 
+#include <LpsCollector.h>
 #include <SimulationObserver.h>
 
 #include <antares/writer/writer_factory.h>
@@ -35,7 +36,8 @@ namespace Antares::API
 SimulationResults APIInternal::run(
   const IStudyLoader& study_loader,
   const std::filesystem::path& output,
-  const Antares::Solver::Optimization::OptimizationOptions& optOptions)
+  const Antares::Solver::Optimization::OptimizationOptions& optOptions,
+  ILpsConsumer* consumer)
 {
     try
     {
@@ -46,7 +48,7 @@ SimulationResults APIInternal::run(
         Antares::API::Error err{.reason = e.what()};
         return {.antares_problems = {}, .error = err};
     }
-    return execute(output, optOptions);
+    return execute(output, optOptions, consumer);
 }
 
 /**
@@ -58,7 +60,8 @@ SimulationResults APIInternal::run(
  */
 SimulationResults APIInternal::execute(
   const std::filesystem::path& output,
-  const Antares::Solver::Optimization::OptimizationOptions& optOptions) const
+  const Antares::Solver::Optimization::OptimizationOptions& optOptions,
+  ILpsConsumer* consumer) const
 {
     // study_ == nullptr e.g when the -h flag is given
     if (!study_)
@@ -90,7 +93,9 @@ SimulationResults APIInternal::execute(
         study_->saveAboutTheStudy(*resultWriter);
     }
 
-    SimulationObserver simulationObserver;
+    // Without consumer, the weekly problems are all kept and returned with the results
+    LpsCollector collector;
+    SimulationObserver simulationObserver(consumer ? *consumer : collector);
 
     optimizationInfo = simulationRun(*study_,
                                      settings,
@@ -101,6 +106,6 @@ SimulationResults APIInternal::execute(
     // Importing Time-Series if asked
     study_->importTimeseriesIntoInput();
 
-    return {.antares_problems = simulationObserver.acquireLps(), .error{}};
+    return {.antares_problems = collector.acquireLps(), .error{}};
 }
 } // namespace Antares::API
@@ -28,23 +28,17 @@ namespace Antares::API
 {
 namespace
 {
-auto translate(const PROBLEME_HEBDO& problemeHebdo,
-               std::string_view name,
-               const Solver::HebdoProblemToLpsTranslator& translator,
-               std::once_flag& flag)
+Solver::WeeklyProblemId weeklyProblemId(const PROBLEME_HEBDO& problemeHebdo)
 {
-    auto weekly_data = translator.translate(problemeHebdo.ProblemeAResoudre.get(), name);
-    std::optional<Solver::ConstantDataFromAntares> common_data;
-    bool translateCommonData = false;
-    std::call_once(flag, [&translateCommonData]() { translateCommonData = true; });
-    if (translateCommonData)
-    {
-        common_data = translator.commonProblemData(problemeHebdo.ProblemeAResoudre.get());
-    }
-    return std::make_pair(common_data, weekly_data);
+    return {.year = problemeHebdo.year + 1, .week = problemeHebdo.weekInTheYear + 1};
 }
 } // namespace
 
+SimulationObserver::SimulationObserver(ILpsConsumer& consumer):
+    consumer_(consumer)
+{
+}
+
 void SimulationObserver::notifyHebdoProblem(const PROBLEME_HEBDO& problemeHebdo,
                                             int optimizationNumber,
                                             std::string_view name)
@@ -54,21 +48,25 @@ void SimulationObserver::notifyHebdoProblem(const PROBLEME_HEBDO& problemeHebdo,
         return; // We only care about first optimization
     }
     Solver::HebdoProblemToLpsTranslator translator;
-    const unsigned int year = problemeHebdo.year + 1;
-    const unsigned int week = problemeHebdo.weekInTheYear + 1;
-    // common_data and weekly_data computed before the mutex lock to prevent blocking the thread
-    auto [common_data, weekly_data] = translate(problemeHebdo, name, translator, flag_);
-    std::lock_guard lock(lps_mutex_);
-    if (common_data)
-    {
-        lps_.setConstantData(common_data.value());
-    }
-    lps_.addWeeklyData({year, week}, weekly_data);
+    const auto* problem = problemeHebdo.ProblemeAResoudre.get();
+    // The other weeks wait for the constant data to be handed to the consumer first
+    std::call_once(flag_,
+                   [this, &translator, problem]()
+                   { consumer_.onConstantData(translator.commonProblemData(problem)); });
+    consumer_.onWeeklyProblem(weeklyProblemId(problemeHebdo), translator.translate(problem, name));
 }
 
-Solver::LpsFromAntares&& SimulationObserver::acquireLps() noexcept
+void SimulationObserver::notifyHebdoSolution(const PROBLEME_HEBDO& problemeHebdo,
+                                             int optimizationNumber,
+                                             std::string_view name)
 {
-    std::lock_guard lock(lps_mutex_);
-    return std::move(lps_);
+    if (optimizationNumber != 1 || !consumer_.wantsSolutions())
+    {
+        return;
+    }
+    Solver::HebdoProblemToLpsTranslator translator;
+    consumer_.onWeeklySolution(weeklyProblemId(problemeHebdo),
+                               translator.translateSolution(problemeHebdo.ProblemeAResoudre.get(),
+                                                            name));
 }
 } // namespace Antares::API
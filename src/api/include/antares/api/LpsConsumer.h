@@ -0,0 +1,78 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include "antares/solver/lps/LpsFromAntares.h"
+
+namespace Antares::API
+{
+
+/**
+ * @class ILpsConsumer
+ * @brief The ILpsConsumer class is used to receive the weekly problems while the simulation runs.
+ * @details Each weekly problem is handed to the consumer as soon as it is built, instead of being
+ * kept until the end of the simulation: the memory used does not depend on the number of years.
+ * The MC years run in parallel, so the weekly methods may be called concurrently from several
+ * threads, and in no particular order. A consumer backed by a bounded queue can simply block
+ * in these methods until some room is made, the simulation then waits for it.
+ */
+class ILpsConsumer
+{
+public:
+    virtual ~ILpsConsumer() = default;
+
+    /**
+     * @brief Receives the data common to all the weekly problems (constraints matrix...).
+     * @details Called once, before any weekly problem.
+     * @param data The constant data.
+     */
+    virtual void onConstantData(Solver::ConstantDataFromAntares&& data) = 0;
+
+    /**
+     * @brief Receives a weekly problem (costs, bounds and right hand sides).
+     * @param id The year and the week of the problem.
+     * @param data The weekly data.
+     */
+    virtual void onWeeklyProblem(Solver::WeeklyProblemId id, Solver::WeeklyDataFromAntares&& data)
+      = 0;
+
+    /**
+     * @brief Does the consumer want the solutions of the weekly problems ?
+     * @details Solutions are not copied at all when false (default).
+     */
+    virtual bool wantsSolutions() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Receives the solution of a weekly problem, once it has been solved.
+     * @param id The year and the week of the problem.
+     * @param solution The weekly solution.
+     */
+    virtual void onWeeklySolution(Solver::WeeklyProblemId /* id */,
+                                  Solver::WeeklySolutionFromAntares&& /* solution */)
+    {
+    }
+};
+
+} // namespace Antares::API
@@ -24,6 +24,7 @@
 
 #include <antares/optimization-options/options.h>
 
+#include "LpsConsumer.h"
 #include "SimulationResults.h"
 
 namespace Antares::API
@@ -38,4 +39,19 @@ SimulationResults PerformSimulation(
   const std::filesystem::path& study_path,
   const std::filesystem::path& output,
   const Antares::Solver::Optimization::OptimizationOptions& optOptions) noexcept;
+
+/**
+ * @brief Performs a simulation, streaming the weekly problems to a consumer.
+ * @details The weekly problems are not kept: SimulationResults::antares_problems is empty, and
+ * the memory used does not grow with the number of MC years.
+ * @param study_path The path to the study to be simulated.
+ * @param consumer Receives the weekly problems (and their solutions if asked) as soon as built.
+ * @return SimulationResults object which contains a potential error.
+ * @exception noexcept This function does not throw exceptions.
+ */
+SimulationResults PerformSimulation(
+  const std::filesystem::path& study_path,
+  const std::filesystem::path& output,
+  const Antares::Solver::Optimization::OptimizationOptions& optOptions,
+  ILpsConsumer& consumer) noexcept;
 } // namespace Antares::API
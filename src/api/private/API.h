@@ -24,6 +24,7 @@
 
 #include <antares/optimization-options/options.h>
 #include <antares/study-loader/IStudyLoader.h>
+#include "antares/api/LpsConsumer.h"
 #include "antares/api/SimulationResults.h"
 
 namespace Antares::Data
@@ -45,17 +46,20 @@ public:
      * @brief The run method is used to run the simulation.
      * @param study_loader A pointer to an IStudyLoader object. The IStudyLoader object is used to
      * load the study that will be simulated.
+     * @param consumer If given, receives the weekly problems while the simulation runs, instead
+     * of the results.
      * @return SimulationResults object which contains the results of the simulation.
      */
     SimulationResults run(const IStudyLoader& study_loader,
                           const std::filesystem::path& output,
-                          const Antares::Solver::Optimization::OptimizationOptions& optOptions);
+                          const Antares::Solver::Optimization::OptimizationOptions& optOptions,
+                          ILpsConsumer* consumer = nullptr);
 
 private:
     std::shared_ptr<Antares::Data::Study> study_;
-    SimulationResults execute(
-      const std::filesystem::path& output,
-      const Antares::Solver::Optimization::OptimizationOptions& optOptions) const;
+    SimulationResults execute(const std::filesystem::path& output,
+                              const Antares::Solver::Optimization::OptimizationOptions& optOptions,
+                              ILpsConsumer* consumer) const;
 };
 
 } // namespace Antares::API
@@ -20,8 +20,10 @@
  */
 
 #pragma once
-#include <antares/solver/lps/LpsFromAntares.h>
+#include <mutex>
+
 #include <antares/solver/simulation/ISimulationObserver.h>
+#include "antares/api/LpsConsumer.h"
 
 namespace Antares::API
 {
@@ -29,12 +31,17 @@ namespace Antares::API
 /**
  * @class SimulationObserver
  * @brief The SimulationObserver class is used to observe the simulation.
- * @details It inherits from the ISimulationObserver interface and overrides the notifyHebdoProblem
- * method.
+ * @details It inherits from the ISimulationObserver interface, translates the weekly problems
+ * (and their solutions if asked) and streams them to a consumer.
  */
 class SimulationObserver: public Solver::Simulation::ISimulationObserver
 {
 public:
+    /**
+     * @param consumer Receives the weekly problems. It must outlive the simulation.
+     */
+    explicit SimulationObserver(ILpsConsumer& consumer);
+
     /**
      * @brief Used to notify of a solver HEBDO_PROBLEM.
      * HEBDO_PROBLEM is assumed to be properly constructed and valid in order to build
@@ -48,15 +55,19 @@ public:
                             std::string_view name) override;
 
     /**
-     * @brief The acquireLps method is used to take ownership of Antares problems.
-     * @return An LpsFromAntares object containing the linear programming problems.
+     * @brief Used to notify of the solution of a solver HEBDO_PROBLEM.
+     * Only forwarded to the consumer if it wants the solutions.
+     * @param problemeHebdo A pointer to a PROBLEME_HEBDO object representing the solved problem.
+     * @param optimizationNumber The number of the optimization.
+     * @param name The name of the problem.
      */
-    Solver::LpsFromAntares&& acquireLps() noexcept;
+    void notifyHebdoSolution(const PROBLEME_HEBDO& problemeHebdo,
+                             int optimizationNumber,
+                             std::string_view name) override;
 
 private:
-    Solver::LpsFromAntares lps_;
-    mutable std::mutex lps_mutex_;
-    mutable std::once_flag flag_;
+    ILpsConsumer& consumer_;
+    std::once_flag flag_;
 };
 
 } // namespace Antares::API
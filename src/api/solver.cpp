@@ -46,4 +46,23 @@ SimulationResults PerformSimulation(
     }
 }
 
+SimulationResults PerformSimulation(
+  const std::filesystem::path& study_path,
+  const std::filesystem::path& output,
+  const Antares::Solver::Optimization::OptimizationOptions& optOptions,
+  ILpsConsumer& consumer) noexcept
+{
+    try
+    {
+        APIInternal api;
+        FileTreeStudyLoader study_loader(study_path);
+        return api.run(study_loader, output, optOptions, &consumer);
+    }
+    catch (const std::exception& e)
+    {
+        Antares::API::Error err{.reason = e.what()};
+        return SimulationResults{.antares_problems{}, .error = err};
+    }
+}
+
 } // namespace Antares::API
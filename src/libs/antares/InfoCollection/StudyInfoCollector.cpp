@@ -131,7 +131,7 @@ void StudyInfoCollector::unitCommitmentModeToFileContent(FileContent& file_conte
 
 void StudyInfoCollector::maxNbYearsInParallelToFileContent(FileContent& file_content)
 {
-    file_content.addItemToSection("study", "max parallel years", study_.maxNbYearsInParallel);
+    file_content.addItemToSection("study", "max parallel years", study_.maxNbYearsRunning);
 }
 
 void StudyInfoCollector::solverVersionToFileContent(FileContent& file_content)
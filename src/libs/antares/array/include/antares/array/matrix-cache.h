@@ -0,0 +1,152 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
+#define __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace Antares
+{
+/*!
+** \brief On-disk binary cache of the matrices parsed from text files
+**
+** Each entry holds one matrix, column by column, after a header identifying its
+** source file (path, size and last modification time) and the parameters it was
+** loaded with. An entry is considered stale as soon as one of them changes.
+**
+** The columns start on a 64-byte boundary and are stored in the native layout,
+** so an entry can be memory-mapped as is.
+*/
+class MatrixCache final
+{
+public:
+    //! What identifies an entry
+    struct Key
+    {
+        //! The text file the matrix is loaded from
+        std::filesystem::path source;
+        //! sizeof() of a cell
+        uint32_t cellSize;
+        //! Loading parameters
+        uint32_t minWidth;
+        uint32_t maxHeight;
+        uint32_t options;
+    };
+
+    //! Layout of the beginning of an entry
+    struct Header
+    {
+        char magic[8];
+        uint32_t cellSize;
+        uint32_t minWidth;
+        uint32_t maxHeight;
+        uint32_t options;
+        uint32_t width;
+        uint32_t height;
+        uint64_t sourceSize;
+        int64_t sourceLastWriteTime;
+        //! Length of the source path, stored right after the header
+        uint32_t sourceLength;
+        //! Offset of the first column from the beginning of the entry
+        uint32_t dataOffset;
+    };
+
+    //! Result of the verification of an entry
+    enum class Status
+    {
+        upToDate,
+        stale,
+        corrupted
+    };
+
+    /*!
+    ** \brief Read access to an up-to-date entry
+    */
+    class Reader final
+    {
+    public:
+        /*!
+        ** \brief Open the entry of a key
+        **
+        ** \return False if the entry does not exist or is stale
+        */
+        bool open(const Key& key);
+
+        uint32_t width() const
+        {
+            return header_.width;
+        }
+
+        uint32_t height() const
+        {
+            return header_.height;
+        }
+
+        //! Size of the entry, in bytes
+        uint64_t size() const;
+
+        //! Read the next column (height() cells)
+        bool readColumn(void* column);
+
+    private:
+        std::ifstream file_;
+        Header header_{};
+    };
+
+    //! Get if the cache is enabled
+    static bool Enabled()
+    {
+        return not folder.empty();
+    }
+
+    //! Path of the entry of a key
+    static std::filesystem::path EntryPath(const Key& key);
+
+    /*!
+    ** \brief Store a matrix
+    **
+    ** The entry is written to a temporary file first, then renamed, so that
+    ** concurrent readers never see a partially written entry.
+    */
+    static bool Store(const Key& key, uint32_t width, uint32_t height, const void* const* columns);
+
+    //! Check an entry against its source file
+    static Status Verify(const std::filesystem::path& entry);
+
+public:
+    /*!
+    ** \brief Folder of the cache, empty to disable it
+    **
+    ** Set by the loading of a study, from its load options (useInputCache).
+    ** Disabled by default.
+    */
+    static std::filesystem::path folder;
+
+    //! Extension of the entries
+    static constexpr const char* extension = ".mtx";
+
+}; // class MatrixCache
+
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
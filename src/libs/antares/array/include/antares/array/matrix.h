@@ -23,11 +23,13 @@
 
 #include <cassert>
 #include <set>
+#include <span>
 
 #include <yuni/yuni.h>
 #include <yuni/io/file.h>
 
 #include <antares/memory/memory.h>
+#include "antares/array/matrix-cache.h"
 #include "antares/jit/jit.h"
 
 namespace Antares
@@ -274,6 +276,11 @@ public:
     //! Get the Nth column (const)
     const ColumnType& column(uint n) const;
 
+    //! View on the Nth column, without copy
+    std::span<T> columnView(uint n);
+    //! View on the Nth column, without copy (const)
+    std::span<const T> columnView(uint n) const;
+
     /*!
     ** \brief Make the matrix a zero matrix
     */
@@ -442,6 +449,7 @@ public:
     //! Height of the matrix
     mutable uint height;
     //! All entries of the matrix (bidimensional array)
+    //! Columns point into a single buffer, each one starting on a cache line (when T allows it)
     mutable ColumnType* entry;
     //! Just-in-time informations
     mutable JIT::Informations* jit;
@@ -490,6 +498,15 @@ private:
                              PredicateT& predicate,
                              bool saveEvenIfAllZero) const;
 
+    //! Load the matrix from the input cache, false if not available
+    bool loadFromCache(const AnyString& filename, uint minWidth, uint maxHeight, uint options);
+
+    //! Store the matrix into the input cache
+    void storeIntoCache(const AnyString& filename,
+                        uint minWidth,
+                        uint maxHeight,
+                        uint options) const;
+
     bool loadFromBuffer(const AnyString& filename,
                         BufferType& data,
                         uint minWidth,
@@ -506,6 +523,29 @@ private:
     */
     void reverseRows(uint column, uint start, uint end);
 
+    //! Number of cells between the start of two consecutive columns of height `h`
+    static std::size_t ColumnStride(uint h);
+
+    //! Allocate `entry` and the buffer of `w` columns of height `h`, nothing must be allocated
+    void allocateColumns(uint w, uint h);
+    //! Release `entry` and the buffer of all columns
+    void releaseColumns();
+    //! Exchange the storage (not the dimensions) of two matrices
+    void swapColumns(Matrix& rhs) noexcept;
+
+    //! Alignment of the buffer and of each column
+    static constexpr std::size_t columnAlignment = 64;
+
+    //! Buffer of all columns
+    T* pStorage = nullptr;
+    //! Number of cells of the buffer
+    std::size_t pStorageSize = 0;
+    //! Number of cells between the start of two consecutive columns
+    std::size_t pColumnStride = 0;
+
+    template<class U, class V>
+    friend class Matrix;
+
 }; // class Matrix
 
 template<class T>
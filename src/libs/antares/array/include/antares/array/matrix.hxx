@@ -21,8 +21,15 @@
 #ifndef __ANTARES_LIBS_ARRAY_MATRIX_HXX__
 #define __ANTARES_LIBS_ARRAY_MATRIX_HXX__
 
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <cmath>
 #include <cstdlib>
+#include <memory>
+#include <new>
+#include <system_error>
+#include <type_traits>
 #include <utility>
 
 #include <yuni/yuni.h>
@@ -40,6 +47,56 @@ namespace Antares
 {
 namespace // anonymous
 {
+//! Lookup table of the characters ending a cell
+constexpr std::array<bool, 256> matrixCSVSeparators = []
+{
+    std::array<bool, 256> table{};
+    for (const char* c = ANTARES_MATRIX_CSV_SEPARATORS; *c != '\0'; ++c)
+    {
+        table[static_cast<unsigned char>(*c)] = true;
+    }
+    return table;
+}();
+
+/*!
+** \brief Find the next cell separator in [offset, size), npos if none
+*/
+template<class BufferT>
+inline typename BufferT::Size FindNextSeparator(const BufferT& data,
+                                                typename BufferT::Size offset)
+{
+    const char* buffer = data.c_str();
+    const typename BufferT::Size size = data.size();
+    for (; offset < size; ++offset)
+    {
+        if (matrixCSVSeparators[static_cast<unsigned char>(buffer[offset])])
+        {
+            return offset;
+        }
+    }
+    return BufferT::npos;
+}
+
+/*!
+** \brief Convert a cell into a double
+**
+** std::from_chars gives the same correctly rounded value as strtod, without the
+** locale lookup. It is stricter though (leading '+' or spaces, hexadecimal values,
+** out of range values...): such cells are given to strtod, so that the results are the same.
+*/
+inline bool ParseDouble(const AnyString& str, double& out)
+{
+    const char* first = str.c_str();
+    const char* last = first + str.size();
+    if (auto [ptr, ec] = std::from_chars(first, last, out); ec == std::errc() and ptr == last)
+    {
+        return true;
+    }
+    char* pend;
+    out = ::strtod(first, &pend);
+    return (NULL != pend and '\0' == *pend);
+}
+
 template<class T>
 class MatrixData final
 {
@@ -111,9 +168,7 @@ public:
 public:
     inline static bool Do(const AnyString& str, double& out)
     {
-        char* pend;
-        out = ::strtod(str.c_str(), &pend);
-        return (NULL != pend and '\0' == *pend);
+        return ParseDouble(str, out);
     }
 };
 
@@ -129,9 +184,10 @@ public:
 public:
     inline static bool Do(const AnyString& str, float& out)
     {
-        char* pend;
-        out = static_cast<float>(::strtod(str.c_str(), &pend));
-        return (NULL != pend and '\0' == *pend);
+        double value;
+        const bool ok = ParseDouble(str, value);
+        out = static_cast<float>(value);
+        return ok;
     }
 };
 
@@ -209,53 +265,47 @@ inline Matrix<T, ReadWriteT>::Matrix():
 
 template<class T, class ReadWriteT>
 Matrix<T, ReadWriteT>::Matrix(uint w, uint h):
-    width(w),
-    height(h),
+    width(0),
+    height(0),
+    entry(nullptr),
     jit(nullptr)
 {
-    if (0 == width or 0 == height)
-    {
-        entry = nullptr;
-    }
-    else
+    if (0 != w and 0 != h)
     {
-        entry = new typename Antares::Memory::Stored<T>::Type[w + 1];
-        entry[w] = nullptr;
-
-        for (uint i = 0; i != w; ++i)
-        {
-            Antares::Memory::Allocate<T>(entry[i], h);
-        }
+        allocateColumns(w, h);
     }
 }
 
 template<class T, class ReadWriteT>
 Matrix<T, ReadWriteT>::Matrix(const Matrix<T, ReadWriteT>& rhs):
-    width(rhs.width),
-    height(rhs.height),
+    width(0),
+    height(0),
+    entry(nullptr),
     jit(nullptr)
 {
-    if (0 == width or 0 == height)
-    {
-        entry = nullptr;
-        width = 0;
-        height = 0;
-    }
-    else
+    if (0 != rhs.width and 0 != rhs.height)
     {
-        entry = new typename Antares::Memory::Stored<T>::Type[width + 1];
-        entry[width] = nullptr;
-
-        for (uint i = 0; i != rhs.width; ++i)
+        allocateColumns(rhs.width, rhs.height);
+        if (pColumnStride == rhs.pColumnStride)
         {
-            Antares::Memory::Allocate<T>(entry[i], height);
-            memcpy(entry[i], rhs.entry[i], sizeof(T) * height);
+            memcpy(pStorage, rhs.pStorage, sizeof(T) * pColumnStride * width);
+        }
+        else
+        {
+            for (uint i = 0; i != width; ++i)
+            {
+                memcpy(entry[i], rhs.entry[i], sizeof(T) * height);
+            }
         }
     }
 }
 
 template<class T, class ReadWriteT>
-Matrix<T, ReadWriteT>::Matrix(Matrix<T, ReadWriteT>&& rhs) noexcept
+Matrix<T, ReadWriteT>::Matrix(Matrix<T, ReadWriteT>&& rhs) noexcept:
+    width(0),
+    height(0),
+    entry(nullptr),
+    jit(nullptr)
 {
     // use Matrix::operator=(Matrix&& rhs)
     *this = std::move(rhs);
@@ -279,23 +329,79 @@ Matrix<T, ReadWriteT>::~Matrix()
            and "Internal variable jit is set but JIT is not globally enabled (overflow?)");
     delete jit;
 
-    if (entry)
+    releaseColumns();
+}
+
+template<class T, class ReadWriteT>
+inline std::size_t Matrix<T, ReadWriteT>::ColumnStride(uint h)
+{
+    if constexpr (columnAlignment % sizeof(T) == 0)
     {
-        for (uint i = 0; i != width; ++i)
-        {
-            Antares::Memory::Release(entry[i]);
-        }
-        delete[] entry;
+        constexpr std::size_t cellsPerLine = columnAlignment / sizeof(T);
+        return (h + cellsPerLine - 1) / cellsPerLine * cellsPerLine;
     }
+    else
+    {
+        return h;
+    }
+}
+
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::allocateColumns(uint w, uint h)
+{
+    assert(!entry and !pStorage and "The previous columns must be released first");
+
+    width = w;
+    height = h;
+    pColumnStride = ColumnStride(h);
+    pStorageSize = pColumnStride * w;
+
+    // A single allocation for all columns, instead of one per column
+    pStorage = static_cast<T*>(
+      ::operator new(sizeof(T) * pStorageSize, std::align_val_t{columnAlignment}));
+    std::uninitialized_default_construct_n(pStorage, pStorageSize);
+
+    entry = new typename Antares::Memory::Stored<T>::Type[w + 1];
+    for (uint i = 0; i != w; ++i)
+    {
+        entry[i] = pStorage + i * pColumnStride;
+    }
+    entry[w] = nullptr;
+}
+
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::releaseColumns()
+{
+    delete[] entry;
+    entry = nullptr;
+
+    if (pStorage)
+    {
+        std::destroy_n(pStorage, pStorageSize);
+        ::operator delete(pStorage, std::align_val_t{columnAlignment});
+        pStorage = nullptr;
+    }
+    pStorageSize = 0;
+    pColumnStride = 0;
+}
+
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::swapColumns(Matrix<T, ReadWriteT>& rhs) noexcept
+{
+    using std::swap;
+    swap(entry, rhs.entry);
+    swap(pStorage, rhs.pStorage);
+    swap(pStorageSize, rhs.pStorageSize);
+    swap(pColumnStride, rhs.pColumnStride);
 }
 
 template<class T, class ReadWriteT>
 inline void Matrix<T, ReadWriteT>::zero()
 {
-    for (uint i = 0; i != width; ++i)
+    if (pStorage)
     {
-        ColumnType& column = entry[i];
-        (void)::memset((void*)column, 0, sizeof(T) * height);
+        // Padding and columns dropped by a shrink included : one linear pass
+        (void)::memset((void*)pStorage, 0, sizeof(T) * pColumnStride * width);
     }
 }
 
@@ -335,10 +441,9 @@ void Matrix<T, ReadWriteT>::averageTimeseries(bool roundValues)
         }
 
         // Release all timeseries no longer needed
-        for (uint i = 1; i != width; ++i)
-        {
-            Antares::Memory::Release(entry[i]);
-        }
+        Matrix<T, ReadWriteT> average(1, height);
+        (void)::memcpy(average.entry[0], first, sizeof(T) * height);
+        swapColumns(average);
         // reset the width to 1
         width = 1;
     }
@@ -347,14 +452,9 @@ void Matrix<T, ReadWriteT>::averageTimeseries(bool roundValues)
 template<class T, class ReadWriteT>
 void Matrix<T, ReadWriteT>::fill(const T& v)
 {
-    for (uint i = 0; i != width; ++i)
+    if (pStorage)
     {
-        ColumnType& column = entry[i];
-
-        for (uint j = 0; j != height; ++j)
-        {
-            column[j] = v;
-        }
+        std::fill_n(pStorage, pColumnStride * width, v);
     }
 }
 
@@ -531,15 +631,7 @@ inline bool Matrix<T, ReadWriteT>::empty() const
 template<class T, class ReadWriteT>
 void Matrix<T, ReadWriteT>::clear()
 {
-    if (entry)
-    {
-        for (uint i = 0; i != width; ++i)
-        {
-            Antares::Memory::Release(entry[i]);
-        }
-        delete[] entry;
-        entry = nullptr;
-    }
+    releaseColumns();
     width = 0;
     height = 0;
 }
@@ -569,35 +661,8 @@ void Matrix<T, ReadWriteT>::resize(uint w, uint h, bool fixedSize)
         }
         else
         {
-            if (entry)
-            {
-                for (uint i = 0; i != width; ++i)
-                {
-                    Antares::Memory::Release(entry[i]);
-                }
-                delete[] entry;
-            }
-            if (!w and !h)
-            {
-                entry = nullptr;
-                width = 0;
-                height = 0;
-            }
-            else
-            {
-                // Assigning the new size
-                width = w;
-                height = h;
-
-                // Allocating the entry for the matrix
-                entry = new typename Antares::Memory::Stored<T>::Type[width + 1];
-                entry[width] = nullptr;
-
-                for (uint i = 0; i != w; ++i)
-                {
-                    Antares::Memory::Allocate<T>(entry[i], height);
-                }
-            }
+            releaseColumns();
+            allocateColumns(w, h);
         }
     }
 
@@ -824,16 +889,15 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
         pos = offset;
         uint lineOffset = (uint)offset;
 
-        while ((offset = data.find_first_of(ANTARES_MATRIX_CSV_SEPARATORS, offset))
-               != BufferType::npos)
+        while ((offset = FindNextSeparator(data, offset)) != BufferType::npos)
         {
             assert(offset != BufferType::npos);
 
             separator = data[offset];
             // the final zero is mandatory for string-to-double convertions
             data[offset] = '\0';
-            // Adding the value
-            converter = (const char*)((const char*)data.c_str() + pos);
+            // Adding the value, its length is already known
+            converter.adapt((const char*)data.c_str() + pos, offset - pos);
 
             // Convert string into double or something else
             if (not converter.empty())
@@ -1024,6 +1088,55 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
     return ((0 != (options & optNeverFails)) ? true : result);
 }
 
+template<class T, class ReadWriteT>
+bool Matrix<T, ReadWriteT>::loadFromCache(const AnyString& filename,
+                                          uint minWidth,
+                                          uint maxHeight,
+                                          uint options)
+{
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        MatrixCache::Reader reader;
+        if (not reader.open({filename.c_str(), sizeof(T), minWidth, maxHeight, options}))
+        {
+            return false;
+        }
+
+        resize(reader.width(), reader.height(), 0 != (options & optFixedSize));
+        for (uint x = 0; x != width; ++x)
+        {
+            if (not reader.readColumn(entry[x]))
+            {
+                logs.warning() << filename << ": truncated cache entry, reloading";
+                return false;
+            }
+        }
+
+        // IO statistics
+        Statistics::HasReadFromDisk(reader.size());
+        return true;
+    }
+    return false;
+}
+
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::storeIntoCache(const AnyString& filename,
+                                           uint minWidth,
+                                           uint maxHeight,
+                                           uint options) const
+{
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        if (not MatrixCache::Store({filename.c_str(), sizeof(T), minWidth, maxHeight, options},
+                                   width,
+                                   height,
+                                   reinterpret_cast<const void* const*>(entry)))
+        {
+            logs.warning() << filename << ": impossible to write its cache entry";
+        }
+    }
+}
+
 template<class T, class ReadWriteT>
 bool Matrix<T, ReadWriteT>::internalLoadCSVFile(const AnyString& filename,
                                                 uint minWidth,
@@ -1034,84 +1147,100 @@ bool Matrix<T, ReadWriteT>::internalLoadCSVFile(const AnyString& filename,
     // Status
     bool result = false;
 
-    const bool hasOwnership = (NULL == buffer);
-    if (not buffer)
+    if (MatrixCache::Enabled() and loadFromCache(filename, minWidth, maxHeight, options))
     {
-        buffer = new BufferType();
+        result = true;
+        // Mark as modified
+        if (0 != (options & optMarkAsModified) and jit)
+        {
+            jit->markAsModified();
+        }
     }
-
-    switch (loadFromFileToBuffer(*buffer, filename))
-    {
-    case Yuni::IO::errNone:
+    else
     {
-        // Empty files
-        if (buffer->empty())
+        const bool hasOwnership = (NULL == buffer);
+        if (not buffer)
         {
-            if (maxHeight and minWidth)
+            buffer = new BufferType();
+        }
+
+        switch (loadFromFileToBuffer(*buffer, filename))
+        {
+        case Yuni::IO::errNone:
+        {
+            // Empty files
+            if (buffer->empty())
             {
-                reset((minWidth != 0 ? minWidth : 1),
-                      maxHeight); // gp : minWidth always != 0 here ==> Refactoring
+                if (maxHeight and minWidth)
+                {
+                    reset((minWidth != 0 ? minWidth : 1),
+                          maxHeight); // gp : minWidth always != 0 here ==> Refactoring
+                }
+                else
+                {
+                    clear();
+                }
+                result = true;
+                break;
             }
-            else
+
+            // IO statistics
+            Statistics::HasReadFromDisk(buffer->size());
+
+            // Adding a final \n to make sure we have a line return at the end of the file
+            *buffer += '\n';
+            // Load the data
+            result = loadFromBuffer(filename,
+                                    *buffer,
+                                    minWidth,
+                                    maxHeight,
+                                    (options & optFixedSize),
+                                    options);
+            if (result and MatrixCache::Enabled())
             {
-                clear();
+                storeIntoCache(filename, minWidth, maxHeight, options);
+            }
+
+            // Mark as modified
+            if (0 != (options & optMarkAsModified))
+            {
+                if (jit)
+                {
+                    jit->markAsModified();
+                }
             }
-            result = true;
             break;
         }
-
-        // IO statistics
-        Statistics::HasReadFromDisk(buffer->size());
-
-        // Adding a final \n to make sure we have a line return at the end of the file
-        *buffer += '\n';
-        // Load the data
-        result = loadFromBuffer(filename,
-                                *buffer,
-                                minWidth,
-                                maxHeight,
-                                (options & optFixedSize),
-                                options);
-
-        // Mark as modified
-        if (0 != (options & optMarkAsModified))
+        case Yuni::IO::errNotFound:
         {
-            if (jit)
+            if (not(options & optQuiet))
             {
-                jit->markAsModified();
+                logs.error() << "I/O Error: not found: '" << filename << "'";
             }
+            break;
         }
-        break;
-    }
-    case Yuni::IO::errNotFound:
-    {
-        if (not(options & optQuiet))
+        case Yuni::IO::errMemoryLimit:
         {
-            logs.error() << "I/O Error: not found: '" << filename << "'";
+            if (not(options & optQuiet))
+            {
+                logs.error() << filename << ": The file is too large (>"
+                             << (filesizeHardLimit / 1024 / 1024) << "Mo)";
+            }
+            break;
         }
-        break;
-    }
-    case Yuni::IO::errMemoryLimit:
-    {
-        if (not(options & optQuiet))
+        default:
         {
-            logs.error() << filename << ": The file is too large (>"
-                         << (filesizeHardLimit / 1024 / 1024) << "Mo)";
+            if (not(options & optQuiet))
+            {
+                logs.error() << "I/O Error: failed to load '" << filename << "'";
+            }
         }
-        break;
-    }
-    default:
-    {
-        if (not(options & optQuiet))
-        {
-            logs.error() << "I/O Error: failed to load '" << filename << "'";
         }
-    }
-    }
 
-    if (hasOwnership)
-    {
-        delete buffer;
+        if (hasOwnership)
+        {
+            delete buffer;
+        }
     }
 
     // The matrix may not be loaded but we have to initialize it to avoid
@@ -1323,11 +1452,7 @@ void Matrix<T, ReadWriteT>::resizeWithoutDataLost(uint x, uint y, const T& defVa
     {
         if (x <= width and y <= height) // shrinking
         {
-            for (uint i = x; i < width; ++i)
-            {
-                Antares::Memory::Release(entry[i]);
-            }
-
+            // The buffer is kept as is, columns keep their stride
             // Update the matrix size
             width = x;
             height = y;
@@ -1516,23 +1641,31 @@ void Matrix<T, ReadWriteT>::copyFrom(const Matrix<U, V>& rhs)
         // resize the matrix
         resize(rhs.width, rhs.height);
         // copy raw values
-        for (uint x = 0; x != rhs.width; ++x)
+        if (Yuni::Static::Type::StrictlyEqual<T, U>::Yes and pColumnStride == rhs.pColumnStride)
         {
-            auto& column = entry[x];
-            const auto& src = rhs.entry[x];
-
-            // if the two types are strictly equal, we can perform some major
-            // optimisations
-            if (Yuni::Static::Type::StrictlyEqual<T, U>::Yes)
-            {
-                (void)::memcpy((void*)column, (void*)src, sizeof(T) * height);
-            }
-            else
+            // if the two types and layouts are strictly equal, all columns at once
+            (void)::memcpy((void*)pStorage, (void*)rhs.pStorage, sizeof(T) * pColumnStride * width);
+        }
+        else
+        {
+            for (uint x = 0; x != rhs.width; ++x)
             {
-                // ...otherwise we have to copy each item by hand in any cases
-                for (uint y = 0; y != height; ++y)
+                auto& column = entry[x];
+                const auto& src = rhs.entry[x];
+
+                // if the two types are strictly equal, we can perform some major
+                // optimisations
+                if (Yuni::Static::Type::StrictlyEqual<T, U>::Yes)
                 {
-                    column[y] = (T)src[y];
+                    (void)::memcpy((void*)column, (void*)src, sizeof(T) * height);
+                }
+                else
+                {
+                    // ...otherwise we have to copy each item by hand in any cases
+                    for (uint y = 0; y != height; ++y)
+                    {
+                        column[y] = (T)src[y];
+                    }
                 }
             }
         }
@@ -1572,7 +1705,7 @@ void Matrix<T, ReadWriteT>::swap(Matrix<T, ReadWriteT>& rhs) noexcept
     using std::swap;
     swap(this->width, rhs.width);
     swap(this->height, rhs.height);
-    swap(this->entry, rhs.entry);
+    swapColumns(rhs);
     swap(this->jit, rhs.jit);
 }
 
@@ -1586,21 +1719,27 @@ inline Matrix<T, ReadWriteT>& Matrix<T, ReadWriteT>::operator=(const Matrix<T, R
 template<class T, class ReadWriteT>
 inline Matrix<T, ReadWriteT>& Matrix<T, ReadWriteT>::operator=(Matrix<T, ReadWriteT>&& rhs) noexcept
 {
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    releaseColumns();
+    delete jit;
+
     width = rhs.width;
     height = rhs.height;
     jit = rhs.jit;
+    swapColumns(rhs);
     if (0 == width || 0 == height)
     {
-        entry = nullptr;
         width = 0;
         height = 0;
     }
-    else
-    {
-        entry = rhs.entry;
-    }
     // Prevent spurious de-allocation from rhs's destructor
-    rhs.entry = nullptr;
+    rhs.width = 0;
+    rhs.height = 0;
+    rhs.jit = nullptr;
     return *this;
 }
 
@@ -1766,6 +1905,20 @@ inline typename Matrix<T, ReadWriteT>::ColumnType& Matrix<T, ReadWriteT>::column
     return entry[n];
 }
 
+template<class T, class ReadWriteT>
+inline std::span<const T> Matrix<T, ReadWriteT>::columnView(uint n) const
+{
+    assert(n < width);
+    return {entry[n], height};
+}
+
+template<class T, class ReadWriteT>
+inline std::span<T> Matrix<T, ReadWriteT>::columnView(uint n)
+{
+    assert(n < width);
+    return {entry[n], height};
+}
+
 } // namespace Antares
 
 #endif // __ANTARES_LIBS_ARRAY_MATRIX_HXX__
@@ -0,0 +1,250 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/array/matrix-cache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <system_error>
+
+namespace fs = std::filesystem;
+
+namespace Antares
+{
+fs::path MatrixCache::folder;
+
+namespace // anonymous
+{
+constexpr char entryMagic[8] = {'A', 'N', 'T', 'M', 'T', 'X', '0', '1'};
+constexpr uint32_t dataAlignment = 64;
+
+//! FNV-1a, stable across platforms and runs, unlike std::hash
+uint64_t Fnv1a(const void* data, std::size_t size, uint64_t hash = 14695981039346656037ULL)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::string NormalizedSource(const fs::path& source)
+{
+    std::error_code ec;
+    fs::path absolute = fs::absolute(source, ec);
+    return (ec ? source : absolute).lexically_normal().generic_string();
+}
+
+bool SourceState(const fs::path& source, uint64_t& size, int64_t& lastWriteTime)
+{
+    std::error_code ec;
+    size = fs::file_size(source, ec);
+    if (ec)
+    {
+        return false;
+    }
+    lastWriteTime = fs::last_write_time(source, ec).time_since_epoch().count();
+    return not ec;
+}
+
+bool ReadHeader(std::ifstream& file, MatrixCache::Header& header, std::string& source)
+{
+    if (not file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    {
+        return false;
+    }
+    if (std::memcmp(header.magic, entryMagic, sizeof(entryMagic)) != 0
+        or header.dataOffset < sizeof(header) + header.sourceLength)
+    {
+        return false;
+    }
+    source.resize(header.sourceLength);
+    return static_cast<bool>(file.read(source.data(), header.sourceLength));
+}
+
+uint64_t EntrySize(const MatrixCache::Header& header)
+{
+    return header.dataOffset
+           + static_cast<uint64_t>(header.width) * header.height * header.cellSize;
+}
+
+//! Unique temporary file next to an entry : other threads and other processes sharing the
+//! cache may be writing the same entry
+fs::path TemporaryPath(const fs::path& entry)
+{
+    thread_local std::mt19937_64 generator(std::random_device{}());
+    char suffix[22];
+    std::snprintf(suffix,
+                  sizeof(suffix),
+                  ".tmp%016llx",
+                  static_cast<unsigned long long>(generator()));
+    fs::path tmp = entry;
+    tmp += suffix;
+    return tmp;
+}
+
+} // anonymous namespace
+
+fs::path MatrixCache::EntryPath(const Key& key)
+{
+    const std::string source = NormalizedSource(key.source);
+    uint64_t hash = Fnv1a(source.data(), source.size());
+    hash = Fnv1a(&key.cellSize, sizeof(key.cellSize), hash);
+    hash = Fnv1a(&key.minWidth, sizeof(key.minWidth), hash);
+    hash = Fnv1a(&key.maxHeight, sizeof(key.maxHeight), hash);
+    hash = Fnv1a(&key.options, sizeof(key.options), hash);
+
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash));
+    return folder / (std::string(name) + extension);
+}
+
+bool MatrixCache::Reader::open(const Key& key)
+{
+    const fs::path entry = EntryPath(key);
+    file_.open(entry, std::ios::binary);
+    if (not file_)
+    {
+        return false;
+    }
+
+    std::string source;
+    if (not ReadHeader(file_, header_, source))
+    {
+        return false;
+    }
+
+    uint64_t sourceSize;
+    int64_t sourceLastWriteTime;
+    if (not SourceState(key.source, sourceSize, sourceLastWriteTime))
+    {
+        return false;
+    }
+
+    std::error_code ec;
+    return header_.cellSize == key.cellSize and header_.minWidth == key.minWidth
+           and header_.maxHeight == key.maxHeight and header_.options == key.options
+           and header_.sourceSize == sourceSize
+           and header_.sourceLastWriteTime == sourceLastWriteTime
+           and source == NormalizedSource(key.source) and fs::file_size(entry, ec) == size()
+           and not ec and file_.seekg(header_.dataOffset);
+}
+
+uint64_t MatrixCache::Reader::size() const
+{
+    return EntrySize(header_);
+}
+
+bool MatrixCache::Reader::readColumn(void* column)
+{
+    const auto bytes = static_cast<std::streamsize>(header_.height) * header_.cellSize;
+    return static_cast<bool>(file_.read(static_cast<char*>(column), bytes));
+}
+
+bool MatrixCache::Store(const Key& key, uint32_t width, uint32_t height, const void* const* columns)
+{
+    Header header{};
+    std::memcpy(header.magic, entryMagic, sizeof(entryMagic));
+    header.cellSize = key.cellSize;
+    header.minWidth = key.minWidth;
+    header.maxHeight = key.maxHeight;
+    header.options = key.options;
+    header.width = width;
+    header.height = height;
+    if (not SourceState(key.source, header.sourceSize, header.sourceLastWriteTime))
+    {
+        return false;
+    }
+
+    const std::string source = NormalizedSource(key.source);
+    header.sourceLength = static_cast<uint32_t>(source.size());
+    const uint32_t headerEnd = static_cast<uint32_t>(sizeof(header)) + header.sourceLength;
+    header.dataOffset = (headerEnd + dataAlignment - 1) / dataAlignment * dataAlignment;
+
+    std::error_code ec;
+    fs::create_directories(folder, ec);
+    if (ec)
+    {
+        return false;
+    }
+
+    const fs::path entry = EntryPath(key);
+    const fs::path tmp = TemporaryPath(entry);
+    {
+        std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(source.data(), header.sourceLength);
+        const std::string padding(header.dataOffset - headerEnd, '\0');
+        file.write(padding.data(), padding.size());
+
+        const auto bytes = static_cast<std::streamsize>(height) * header.cellSize;
+        for (uint32_t x = 0; x != width; ++x)
+        {
+            file.write(static_cast<const char*>(columns[x]), bytes);
+        }
+        if (not file.flush())
+        {
+            file.close();
+            fs::remove(tmp, ec);
+            return false;
+        }
+    }
+
+    fs::rename(tmp, entry, ec);
+    if (ec)
+    {
+        fs::remove(tmp, ec);
+        return false;
+    }
+    return true;
+}
+
+MatrixCache::Status MatrixCache::Verify(const fs::path& entry)
+{
+    std::ifstream file(entry, std::ios::binary);
+    Header header{};
+    std::string source;
+    if (not file or not ReadHeader(file, header, source))
+    {
+        return Status::corrupted;
+    }
+
+    std::error_code ec;
+    if (fs::file_size(entry, ec) != EntrySize(header) or ec)
+    {
+        return Status::corrupted;
+    }
+
+    uint64_t sourceSize;
+    int64_t sourceLastWriteTime;
+    if (not SourceState(source, sourceSize, sourceLastWriteTime)
+        or sourceSize != header.sourceSize or sourceLastWriteTime != header.sourceLastWriteTime)
+    {
+        return Status::stale;
+    }
+    return Status::upToDate;
+}
+
+} // namespace Antares
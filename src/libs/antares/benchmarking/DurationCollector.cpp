@@ -20,27 +20,262 @@
 */
 #include "antares/benchmarking/DurationCollector.h"
 
-#include <numeric>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <deque>
+#include <stdexcept>
 #include <string>
 
 namespace Benchmarking
 {
 
+namespace
+{
+// Durations below are exact, each power of two above is split in as many buckets (~12% error)
+constexpr int subBucketBits = 3;
+constexpr int64_t subBucketCount = 1 << subBucketBits;
+constexpr std::size_t bucketCount = subBucketCount * (64 - subBucketBits);
+
+std::size_t bucketOf(int64_t duration)
+{
+    const auto value = static_cast<uint64_t>(std::max<int64_t>(duration, 0));
+    if (value < subBucketCount)
+    {
+        return value;
+    }
+    const int exponent = std::bit_width(value) - 1;
+    const int shift = exponent - subBucketBits;
+    const auto sub = static_cast<std::size_t>((value >> shift) & (subBucketCount - 1));
+    return subBucketCount * (shift + 1) + sub;
+}
+
+// Largest duration falling into a bucket
+int64_t bucketUpperBound(std::size_t bucket)
+{
+    if (bucket < subBucketCount)
+    {
+        return static_cast<int64_t>(bucket);
+    }
+    const auto shift = bucket / subBucketCount - 1;
+    const auto sub = bucket % subBucketCount;
+    const uint64_t lower = (subBucketCount + sub) << shift;
+    return static_cast<int64_t>(lower + (uint64_t(1) << shift) - 1);
+}
+
+// Shards are only written by their thread : a relaxed load and store is enough, and cheaper
+// than a read-modify-write
+template<class T>
+void increase(std::atomic<T>& counter, T value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+uint64_t nextCollectorId()
+{
+    static std::atomic<uint64_t> lastId{0};
+    return ++lastId;
+}
+
+struct MergedHistogram
+{
+    int64_t nbCalls = 0;
+    int64_t total = 0;
+    int64_t max = 0;
+    std::array<uint64_t, bucketCount> buckets{};
+
+    int64_t percentile(double p) const
+    {
+        const auto rank = static_cast<uint64_t>(std::ceil(p * static_cast<double>(nbCalls)));
+        uint64_t seen = 0;
+        for (std::size_t b = 0; b < bucketCount; ++b)
+        {
+            seen += buckets[b];
+            if (seen >= rank && seen > 0)
+            {
+                return std::min(bucketUpperBound(b), max);
+            }
+        }
+        return max;
+    }
+
+    DurationCollector::Statistics statistics() const
+    {
+        return {.nbCalls = nbCalls,
+                .total = total,
+                .p50 = percentile(0.5),
+                .p95 = percentile(0.95),
+                .max = max};
+    }
+};
+} // namespace
+
+class DurationCollector::Shard
+{
+public:
+    //! Only called by the thread owning the shard
+    void add(Key key, int64_t duration)
+    {
+        if (key >= histograms_.size())
+        {
+            // The only write the merging thread can see, hence the lock
+            const std::lock_guard lock(growMutex_);
+            while (histograms_.size() <= key)
+            {
+                histograms_.emplace_back();
+            }
+        }
+
+        auto& histogram = histograms_[key];
+        increase<int64_t>(histogram.nbCalls, 1);
+        increase(histogram.total, duration);
+        if (duration > histogram.max.load(std::memory_order_relaxed))
+        {
+            histogram.max.store(duration, std::memory_order_relaxed);
+        }
+        increase<uint32_t>(histogram.buckets[bucketOf(duration)], 1);
+    }
+
+    void mergeInto(std::vector<MergedHistogram>& merged) const
+    {
+        const std::lock_guard lock(growMutex_);
+        for (std::size_t key = 0; key < histograms_.size() && key < merged.size(); ++key)
+        {
+            const auto& histogram = histograms_[key];
+            auto& target = merged[key];
+            target.nbCalls += histogram.nbCalls.load(std::memory_order_relaxed);
+            target.total += histogram.total.load(std::memory_order_relaxed);
+            target.max = std::max(target.max, histogram.max.load(std::memory_order_relaxed));
+            for (std::size_t b = 0; b < bucketCount; ++b)
+            {
+                target.buckets[b] += histogram.buckets[b].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    //! Keys already interned by the owning thread
+    std::unordered_map<std::string, Key> knownKeys;
+
+private:
+    struct Histogram
+    {
+        std::atomic<int64_t> nbCalls{0};
+        std::atomic<int64_t> total{0};
+        std::atomic<int64_t> max{0};
+        std::array<std::atomic<uint32_t>, bucketCount> buckets{};
+    };
+
+    mutable std::mutex growMutex_;
+    // A deque, so that growing never moves the histograms being written
+    std::deque<Histogram> histograms_;
+};
+
+DurationCollector::DurationCollector():
+    id_(nextCollectorId())
+{
+}
+
+DurationCollector::~DurationCollector() = default;
+
+DurationCollector::Key DurationCollector::intern(const std::string& name)
+{
+    {
+        const std::shared_lock lock(namesMutex_);
+        if (auto it = keys_.find(name); it != keys_.end())
+        {
+            return it->second;
+        }
+    }
+
+    const std::unique_lock lock(namesMutex_);
+    auto [it, inserted] = keys_.try_emplace(name, names_.size());
+    if (inserted)
+    {
+        names_.push_back(name);
+    }
+    return it->second;
+}
+
+DurationCollector::Shard& DurationCollector::localShard()
+{
+    // Shards of the collectors this thread has written to. Entries of destroyed collectors
+    // are never looked up again, since ids are not reused.
+    thread_local std::vector<std::pair<uint64_t, Shard*>> threadShards;
+    for (const auto& [id, shard]: threadShards)
+    {
+        if (id == id_)
+        {
+            return *shard;
+        }
+    }
+
+    auto shard = std::make_unique<Shard>();
+    Shard* result = shard.get();
+    {
+        const std::lock_guard lock(shardsMutex_);
+        shards_.push_back(std::move(shard));
+    }
+    threadShards.emplace_back(id_, result);
+    return *result;
+}
+
 void DurationCollector::addDuration(const std::string& name, int64_t duration)
 {
-    const std::lock_guard lock(mutex_);
-    duration_items_[name].push_back(duration);
+    auto& shard = localShard();
+    auto it = shard.knownKeys.find(name);
+    if (it == shard.knownKeys.end())
+    {
+        it = shard.knownKeys.emplace(name, intern(name)).first;
+    }
+    shard.add(it->second, duration);
 }
 
-void DurationCollector::toFileContent(FileContent& file_content)
+std::map<std::string, DurationCollector::Statistics> DurationCollector::getAllStatistics() const
 {
-    for (const auto& [name, durations]: duration_items_)
+    std::vector<std::string> names;
+    {
+        const std::shared_lock lock(namesMutex_);
+        names = names_;
+    }
+
+    std::vector<MergedHistogram> merged(names.size());
     {
-        const int64_t duration_sum = accumulate(durations.begin(),
-                                                durations.end(),
-                                                static_cast<int64_t>(0));
+        const std::lock_guard lock(shardsMutex_);
+        for (const auto& shard: shards_)
+        {
+            shard->mergeInto(merged);
+        }
+    }
 
-        file_content.addDurationItem(name, (unsigned int)duration_sum, (int)durations.size());
+    std::map<std::string, Statistics> statistics;
+    for (std::size_t key = 0; key < names.size(); ++key)
+    {
+        statistics[names[key]] = merged[key].statistics();
+    }
+    return statistics;
+}
+
+DurationCollector::Statistics DurationCollector::getStatistics(const std::string& name) const
+{
+    const auto all = getAllStatistics();
+    auto it = all.find(name);
+    if (it == all.end())
+    {
+        throw std::out_of_range("No duration collected for '" + name + "'");
+    }
+    return it->second;
+}
+
+void DurationCollector::toFileContent(FileContent& file_content)
+{
+    for (const auto& [name, statistics]: getAllStatistics())
+    {
+        file_content.addDurationItem(name, (unsigned int)statistics.total, (int)statistics.nbCalls);
+        file_content.addItemToSection("durations_p50_ms", name, (int)statistics.p50);
+        file_content.addItemToSection("durations_p95_ms", name, (int)statistics.p95);
+        file_content.addItemToSection("durations_max_ms", name, (int)statistics.max);
     }
 }
 
@@ -51,8 +286,7 @@ DurationCollector::OperationTimer DurationCollector::operator()(const std::strin
 
 void DurationCollector::OperationTimer::addDuration(int64_t duration_ms) const
 {
-    const std::scoped_lock lock(collector.mutex_);
-    collector.duration_items_[key].push_back(duration_ms);
+    collector.addDuration(key, duration_ms);
 }
 
 void operator<<(const DurationCollector::OperationTimer& op, const std::function<void(void)>& f)
@@ -67,9 +301,7 @@ void operator<<(const DurationCollector::OperationTimer& op, const std::function
 
 int64_t DurationCollector::getTime(const std::string& name) const
 {
-    const auto& v = duration_items_.at(name);
-
-    return accumulate(v.begin(), v.end(), static_cast<int64_t>(0));
+    return getStatistics(name).total;
 }
 
 } // namespace Benchmarking
@@ -18,6 +18,10 @@
 ** You should have received a copy of the Mozilla Public Licence 2.0
 ** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
 */
+#include <cctype>
+#include <cstdio>
+#include <sstream>
+
 #include <antares/benchmarking/file_content.h>
 #include <antares/inifile/inifile.h>
 
@@ -68,4 +72,123 @@ std::string FileContent::saveToBufferAsIni()
     }
     return ini.toString();
 }
+
+namespace
+{
+// Values matching the JSON number grammar are written as is, anything else is quoted
+// -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+bool isNumber(const string& value)
+{
+    auto it = value.begin();
+    const auto end = value.end();
+    auto skipDigits = [&it, &end]()
+    {
+        const auto first = it;
+        while (it != end && isdigit(static_cast<unsigned char>(*it)))
+        {
+            ++it;
+        }
+        return it - first;
+    };
+
+    if (it != end && *it == '-')
+    {
+        ++it;
+    }
+    if (it == end)
+    {
+        return false;
+    }
+    if (*it == '0')
+    {
+        ++it;
+    }
+    else if (!skipDigits())
+    {
+        return false;
+    }
+    if (it != end && *it == '.')
+    {
+        ++it;
+        if (!skipDigits())
+        {
+            return false;
+        }
+    }
+    if (it != end && (*it == 'e' || *it == 'E'))
+    {
+        ++it;
+        if (it != end && (*it == '+' || *it == '-'))
+        {
+            ++it;
+        }
+        if (!skipDigits())
+        {
+            return false;
+        }
+    }
+    return it == end;
+}
+
+string quoted(const string& value)
+{
+    string result = "\"";
+    for (char c: value)
+    {
+        switch (c)
+        {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\r':
+            result += "\\r";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                // Other control characters are not allowed as is in a JSON string
+                char escaped[7];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+                result += escaped;
+            }
+            else
+            {
+                result += c;
+            }
+        }
+    }
+    return result + "\"";
+}
+} // namespace
+
+std::string FileContent::saveToBufferAsJson() const
+{
+    std::ostringstream out;
+    out << "{";
+    const char* sectionSeparator = "\n";
+    for (const auto& [sectionName, content]: sections_)
+    {
+        out << sectionSeparator << "  " << quoted(sectionName) << ": {";
+        const char* separator = "\n";
+        for (const auto& [key, value]: content)
+        {
+            out << separator << "    " << quoted(key) << ": "
+                << (isNumber(value) ? value : quoted(value));
+            separator = ",\n";
+        }
+        out << "\n  }";
+        sectionSeparator = ",\n";
+    }
+    out << "\n}\n";
+    return out.str();
+}
 } // namespace Benchmarking
@@ -21,10 +21,14 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "file_content.h"
@@ -32,9 +36,34 @@
 namespace Benchmarking
 {
 
+/*!
+** \brief Collects the durations of named operations, possibly from many threads
+**
+** Each thread records into its own shard, without taking any lock once the names it uses are
+** known to it. Shards are merged on demand. For each name, the number of calls, the total
+** duration, the maximum and a logarithmic histogram (for percentiles) are kept, so that the
+** memory used does not depend on the number of calls.
+*/
 class DurationCollector
 {
 public:
+    //! Merged statistics of one operation, durations in ms
+    struct Statistics
+    {
+        int64_t nbCalls = 0;
+        int64_t total = 0;
+        //! Percentiles are approximated by the upper bound of their histogram bucket
+        int64_t p50 = 0;
+        int64_t p95 = 0;
+        int64_t max = 0;
+    };
+
+    DurationCollector();
+    ~DurationCollector();
+
+    DurationCollector(const DurationCollector&) = delete;
+    DurationCollector& operator=(const DurationCollector&) = delete;
+
     void toFileContent(FileContent& file_content);
     void addDuration(const std::string& name, int64_t duration);
 
@@ -56,14 +85,34 @@ public:
 
     friend void operator<<(const OperationTimer& op, const std::function<void(void)>& f);
 
+    //! Total duration of an operation. Throws std::out_of_range for an unknown name
     int64_t getTime(const std::string& name) const;
 
+    //! Statistics of an operation. Throws std::out_of_range for an unknown name
+    Statistics getStatistics(const std::string& name) const;
+
+    //! Statistics of all operations, by name
+    std::map<std::string, Statistics> getAllStatistics() const;
+
 private:
-    std::map<std::string, std::vector<int64_t>> duration_items_;
+    class Shard;
+
+    using Key = std::size_t;
+
+    Key intern(const std::string& name);
+    Shard& localShard();
+
+    // Identifies this collector in the per-thread caches of shards. Never reused
+    const uint64_t id_;
+
+    // Names of the operations, the position of a name being its key in the shards
+    mutable std::shared_mutex namesMutex_;
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, Key> keys_;
 
-    // Durations can be added in a context of multi-threading, so we need to protect
-    // these additions from thread concurrency
-    std::mutex mutex_;
+    // One shard per thread which added a duration
+    mutable std::mutex shardsMutex_;
+    std::vector<std::unique_ptr<Shard>> shards_;
 };
 
 } // namespace Benchmarking
@@ -43,6 +43,13 @@ public:
 
     std::string saveToBufferAsIni();
 
+    /*!
+    ** \brief Same content as the ini, as a JSON object of sections
+    **
+    ** Numeric values are written as JSON numbers, other values as strings.
+    */
+    std::string saveToBufferAsJson() const;
+
 private:
     std::mutex pSectionsMutex;
     // Data of the file content
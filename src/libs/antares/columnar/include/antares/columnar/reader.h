@@ -0,0 +1,107 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_COLUMNAR_READER_H__
+#define __ANTARES_LIBS_COLUMNAR_READER_H__
+
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "table.h"
+
+namespace Antares::Columnar
+{
+class MappedFile;
+
+/*!
+** \brief Read access to a table
+**
+** All methods throw std::runtime_error if the table is not valid.
+*/
+class TableReader final
+{
+public:
+    //! Value returned by find() when there is no such column
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    //! Read a table from a file, mapped in memory
+    explicit TableReader(const std::filesystem::path& path);
+    //! Read a table from a buffer, which must outlive the reader
+    TableReader(const char* data, std::size_t size);
+    ~TableReader();
+
+    uint32_t rowCount() const
+    {
+        return rowCount_;
+    }
+
+    const Options& options() const
+    {
+        return options_;
+    }
+
+    const std::vector<Column>& columns() const
+    {
+        return columns_;
+    }
+
+    //! Index of a column from its variable name and statistic, or npos
+    std::size_t find(std::string_view name, std::string_view statistic = "EXP") const;
+
+    /*!
+    ** \brief Values of a column
+    **
+    ** Uncompressed float64 columns are read in place : the result points into the table.
+    ** Other columns are decoded into `storage`. A non applicable column has no values.
+    */
+    std::span<const double> values(std::size_t column, std::vector<double>& storage) const;
+
+    //! Convert the table back to the legacy text layout
+    void toText(std::string& out) const;
+
+private:
+    struct Block
+    {
+        uint64_t offset;
+        uint64_t size;
+        uint64_t rawSize;
+    };
+
+    void parse();
+    std::string_view view(const Block& block) const;
+    void uncompress(const Block& block, void* out) const;
+
+    std::unique_ptr<MappedFile> file_;
+    std::string_view content_;
+    Options options_;
+    uint32_t rowCount_ = 0;
+    std::vector<Column> columns_;
+    std::vector<Block> blocks_;
+    Block text_{};
+    uint64_t preambleSize_ = 0;
+};
+
+} // namespace Antares::Columnar
+
+#endif // __ANTARES_LIBS_COLUMNAR_READER_H__
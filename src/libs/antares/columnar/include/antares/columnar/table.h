@@ -0,0 +1,71 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_COLUMNAR_TABLE_H__
+#define __ANTARES_LIBS_COLUMNAR_TABLE_H__
+
+#include <cstdint>
+#include <string>
+
+namespace Antares::Columnar
+{
+/*!
+** \brief Columnar storage of a table of results
+**
+** A table holds the values of one results file (one area, link or set, at one time level),
+** variable by variable. Each column is stored as a contiguous array of float64 or float32,
+** optionally compressed with zlib, and described by an index at the end of the file. The text
+** of the legacy layout which is not made of values (header lines and labels of the rows) is kept
+** as well, so that a table can be converted back to the legacy text file.
+*/
+
+//! Extension of the files holding a table, replacing `.txt`
+constexpr const char* extension = ".col";
+
+//! Type of the stored values
+enum class ValueType : uint8_t
+{
+    float64 = 0,
+    float32 = 1
+};
+
+struct Options
+{
+    ValueType valueType = ValueType::float64;
+    //! Compress each column. Uncompressed float64 columns can be read in place from a mapped file
+    bool compress = false;
+};
+
+//! Description of a column
+struct Column
+{
+    //! Variable name, unit and statistic, as in the three header rows of the legacy layout
+    std::string name;
+    std::string unit;
+    std::string statistic;
+    //! printf format of the values in the legacy layout
+    std::string precision;
+    //! No values are stored for a non applicable column
+    bool notApplicable = false;
+};
+
+} // namespace Antares::Columnar
+
+#endif // __ANTARES_LIBS_COLUMNAR_TABLE_H__
@@ -0,0 +1,81 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_COLUMNAR_WRITER_H__
+#define __ANTARES_LIBS_COLUMNAR_WRITER_H__
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "table.h"
+
+namespace Antares::Columnar
+{
+/*!
+** \brief Encode a table into a buffer
+**
+** Columns are appended one at a time, the index is written by finalize().
+*/
+class TableWriter final
+{
+public:
+    TableWriter(const Options& options, uint32_t rowCount);
+
+    /*!
+    ** \brief Set the text of the legacy layout
+    **
+    ** \param preamble The text before the first row
+    ** \param rowLabels The labels of all rows (their first cells), each one ended by '\n'
+    */
+    void setText(std::string_view preamble, std::string_view rowLabels);
+
+    /*!
+    ** \brief Append a column
+    **
+    ** \param values The value of each row, not used for a non applicable column
+    */
+    void addColumn(const Column& column, const double* values);
+
+    //! Write the index, and get the whole table
+    std::string& finalize();
+
+private:
+    struct Block
+    {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint64_t rawSize = 0;
+    };
+
+    Block append(const void* data, std::size_t size, bool compress);
+
+    Options options_;
+    uint32_t rowCount_;
+    std::string buffer_;
+    Block text_;
+    uint64_t preambleSize_ = 0;
+    std::vector<std::pair<Column, Block>> columns_;
+    std::vector<float> floats_;
+};
+
+} // namespace Antares::Columnar
+
+#endif // __ANTARES_LIBS_COLUMNAR_WRITER_H__
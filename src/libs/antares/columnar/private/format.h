@@ -0,0 +1,88 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_COLUMNAR_FORMAT_H__
+#define __ANTARES_LIBS_COLUMNAR_FORMAT_H__
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace Antares::Columnar::Format
+{
+/*
+** Layout of a table, in native byte order:
+**
+**   Header
+**   text of the legacy layout (preamble, then labels of the rows), compressed
+**   columns, each one starting on a 64-byte boundary
+**   index: for each column, its block, flags, name, unit, statistic and precision
+**   Trailer
+**
+** A block is stored as its offset from the beginning of the table, its size and its size once
+** uncompressed (uint64 each). Strings are stored as their length (uint32) followed by their
+** characters.
+*/
+constexpr char magic[8] = {'A', 'N', 'T', 'C', 'O', 'L', '0', '1'};
+constexpr uint32_t dataAlignment = 64;
+
+struct Header
+{
+    char magic[8];
+    uint32_t rowCount;
+    uint32_t columnCount;
+    uint8_t valueType;
+    uint8_t compressed;
+    uint8_t reserved[6];
+};
+
+struct Trailer
+{
+    uint64_t textOffset;
+    uint64_t textSize;
+    uint64_t textRawSize;
+    //! Size of the preamble, in the uncompressed text
+    uint64_t preambleSize;
+    uint64_t indexOffset;
+    char magic[8];
+};
+
+//! Column flags
+enum : uint8_t
+{
+    notApplicable = 1
+};
+
+template<class T>
+inline void Put(std::string& out, const T& value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+inline void PutString(std::string& out, std::string_view text)
+{
+    Put(out, static_cast<uint32_t>(text.size()));
+    out.append(text);
+}
+
+} // namespace Antares::Columnar::Format
+
+#endif // __ANTARES_LIBS_COLUMNAR_FORMAT_H__
@@ -0,0 +1,332 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/columnar/reader.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <zlib.h>
+
+#include <antares/utils/utils.h>
+#include <antares/utils/value-format.h>
+#include "antares/columnar/mapped_file.h"
+
+#include "format.h"
+
+namespace Antares::Columnar
+{
+namespace
+{
+std::runtime_error InvalidTable(const std::string& reason)
+{
+    return std::runtime_error("invalid columnar table: " + reason);
+}
+
+//! Sequential read of the index
+class Cursor final
+{
+public:
+    Cursor(std::string_view content, uint64_t offset):
+        content_(content),
+        offset_(offset)
+    {
+    }
+
+    template<class T>
+    T get()
+    {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    std::string getString()
+    {
+        const auto length = get<uint32_t>();
+        return std::string(take(length), length);
+    }
+
+private:
+    const char* take(uint64_t size)
+    {
+        if (offset_ > content_.size() || size > content_.size() - offset_)
+        {
+            throw InvalidTable("truncated index");
+        }
+        const char* data = content_.data() + offset_;
+        offset_ += size;
+        return data;
+    }
+
+    std::string_view content_;
+    uint64_t offset_;
+};
+
+// Only the formats used by the survey results are accepted, since they are given to printf
+bool IsValidPrecision(const std::string& precision)
+{
+    if (precision.size() < 4 || precision.size() > 5 || precision.compare(0, 2, "%.") != 0
+        || precision.back() != 'f')
+    {
+        return false;
+    }
+    for (std::size_t i = 2; i + 1 < precision.size(); ++i)
+    {
+        if (precision[i] < '0' || precision[i] > '9')
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Same rules and same formatting as the survey results
+void AppendValue(std::string& out, double v, int decimals, const Column& column)
+{
+    if (Utils::isZero(v))
+    {
+        out.append("\t0", 2);
+        return;
+    }
+    if (std::isnan(v))
+    {
+        out.append("\tNaN", 4);
+        return;
+    }
+    if (std::isinf(v))
+    {
+        out.append((v > 0) ? "\t+inf" : "\t-inf", 5);
+        return;
+    }
+    if (!Utils::AppendFixedValue(out, v, decimals, column.precision.c_str()))
+    {
+        out.append("\tERR", 4);
+    }
+}
+} // namespace
+
+TableReader::TableReader(const std::filesystem::path& path):
+    file_(std::make_unique<MappedFile>(path)),
+    content_(file_->data(), file_->size())
+{
+    parse();
+}
+
+TableReader::TableReader(const char* data, std::size_t size):
+    content_(data, size)
+{
+    parse();
+}
+
+TableReader::~TableReader() = default;
+
+void TableReader::parse()
+{
+    if (content_.size() < sizeof(Format::Header) + sizeof(Format::Trailer))
+    {
+        throw InvalidTable("too small");
+    }
+
+    Format::Header header;
+    std::memcpy(&header, content_.data(), sizeof(header));
+    Format::Trailer trailer;
+    std::memcpy(&trailer, content_.data() + content_.size() - sizeof(trailer), sizeof(trailer));
+    if (std::memcmp(header.magic, Format::magic, sizeof(Format::magic)) != 0
+        || std::memcmp(trailer.magic, Format::magic, sizeof(Format::magic)) != 0)
+    {
+        throw InvalidTable("unknown format");
+    }
+    if (header.valueType > static_cast<uint8_t>(ValueType::float32))
+    {
+        throw InvalidTable("unknown type of values");
+    }
+
+    rowCount_ = header.rowCount;
+    options_.valueType = static_cast<ValueType>(header.valueType);
+    options_.compress = header.compressed != 0;
+    text_ = {trailer.textOffset, trailer.textSize, trailer.textRawSize};
+    preambleSize_ = trailer.preambleSize;
+    view(text_);
+    if (preambleSize_ > text_.rawSize)
+    {
+        throw InvalidTable("invalid text");
+    }
+
+    const std::size_t valueSize = options_.valueType == ValueType::float32 ? sizeof(float)
+                                                                            : sizeof(double);
+    Cursor cursor(content_.substr(0, content_.size() - sizeof(trailer)), trailer.indexOffset);
+    columns_.resize(header.columnCount);
+    blocks_.resize(header.columnCount);
+    for (uint32_t i = 0; i != header.columnCount; ++i)
+    {
+        auto& block = blocks_[i];
+        block.offset = cursor.get<uint64_t>();
+        block.size = cursor.get<uint64_t>();
+        block.rawSize = cursor.get<uint64_t>();
+
+        auto& column = columns_[i];
+        column.notApplicable = (cursor.get<uint8_t>() & Format::notApplicable) != 0;
+        column.name = cursor.getString();
+        column.unit = cursor.getString();
+        column.statistic = cursor.getString();
+        column.precision = cursor.getString();
+
+        view(block);
+        if (!options_.compress && block.size != block.rawSize)
+        {
+            throw InvalidTable("invalid size of column `" + column.name + "`");
+        }
+        if (!IsValidPrecision(column.precision))
+        {
+            throw InvalidTable("invalid precision `" + column.precision + "`");
+        }
+        if (!column.notApplicable && block.rawSize != rowCount_ * valueSize)
+        {
+            throw InvalidTable("invalid size of column `" + column.name + "`");
+        }
+    }
+}
+
+std::string_view TableReader::view(const Block& block) const
+{
+    if (block.offset > content_.size() || block.size > content_.size() - block.offset)
+    {
+        throw InvalidTable("block out of bounds");
+    }
+    return content_.substr(block.offset, block.size);
+}
+
+void TableReader::uncompress(const Block& block, void* out) const
+{
+    auto data = view(block);
+    uLongf size = static_cast<uLongf>(block.rawSize);
+    if (::uncompress(static_cast<Bytef*>(out),
+                     &size,
+                     reinterpret_cast<const Bytef*>(data.data()),
+                     static_cast<uLong>(data.size()))
+          != Z_OK
+        || size != block.rawSize)
+    {
+        throw InvalidTable("corrupted data");
+    }
+}
+
+std::size_t TableReader::find(std::string_view name, std::string_view statistic) const
+{
+    for (std::size_t i = 0; i != columns_.size(); ++i)
+    {
+        if (columns_[i].name == name && columns_[i].statistic == statistic)
+        {
+            return i;
+        }
+    }
+    return npos;
+}
+
+std::span<const double> TableReader::values(std::size_t column,
+                                            std::vector<double>& storage) const
+{
+    const Block& block = blocks_.at(column);
+    if (columns_[column].notApplicable)
+    {
+        return {};
+    }
+
+    if (options_.valueType == ValueType::float64)
+    {
+        if (!options_.compress)
+        {
+            auto data = view(block);
+            if (reinterpret_cast<std::uintptr_t>(data.data()) % alignof(double) == 0)
+            {
+                return {reinterpret_cast<const double*>(data.data()), rowCount_};
+            }
+            storage.resize(rowCount_);
+            std::memcpy(storage.data(), data.data(), block.rawSize);
+            return storage;
+        }
+        storage.resize(rowCount_);
+        uncompress(block, storage.data());
+        return storage;
+    }
+
+    std::vector<float> floats(rowCount_);
+    if (options_.compress)
+    {
+        uncompress(block, floats.data());
+    }
+    else
+    {
+        std::memcpy(floats.data(), view(block).data(), block.rawSize);
+    }
+    storage.assign(floats.begin(), floats.end());
+    return storage;
+}
+
+void TableReader::toText(std::string& out) const
+{
+    std::string text(text_.rawSize, '\0');
+    if (!text.empty())
+    {
+        uncompress(text_, text.data());
+    }
+
+    std::vector<std::vector<double>> storage(columns_.size());
+    std::vector<std::span<const double>> values(columns_.size());
+    for (std::size_t i = 0; i != columns_.size(); ++i)
+    {
+        values[i] = this->values(i, storage[i]);
+    }
+
+    // The format of each column is parsed once for all rows
+    std::vector<int> decimals(columns_.size());
+    for (std::size_t i = 0; i != columns_.size(); ++i)
+    {
+        decimals[i] = Utils::FixedFormatDecimals(columns_[i].precision);
+    }
+
+    out.append(text, 0, preambleSize_);
+    std::size_t position = preambleSize_;
+    for (uint32_t row = 0; row != rowCount_; ++row)
+    {
+        const auto end = text.find('\n', position);
+        if (end == std::string::npos)
+        {
+            throw InvalidTable("missing row labels");
+        }
+        out.append(text, position, end - position);
+        position = end + 1;
+
+        for (std::size_t i = 0; i != columns_.size(); ++i)
+        {
+            if (columns_[i].notApplicable)
+            {
+                out.append("\tN/A", 4);
+                continue;
+            }
+            AppendValue(out, values[i][row], decimals[i], columns_[i]);
+        }
+        out += '\n';
+    }
+}
+
+} // namespace Antares::Columnar
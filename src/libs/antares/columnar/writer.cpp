@@ -0,0 +1,135 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/columnar/writer.h"
+
+#include <cstddef>
+#include <stdexcept>
+
+#include <zlib.h>
+
+#include "format.h"
+
+namespace Antares::Columnar
+{
+TableWriter::TableWriter(const Options& options, uint32_t rowCount):
+    options_(options),
+    rowCount_(rowCount)
+{
+    Format::Header header{};
+    std::memcpy(header.magic, Format::magic, sizeof(Format::magic));
+    header.rowCount = rowCount;
+    header.valueType = static_cast<uint8_t>(options.valueType);
+    header.compressed = options.compress;
+    Format::Put(buffer_, header);
+}
+
+TableWriter::Block TableWriter::append(const void* data, std::size_t size, bool compress)
+{
+    if (!compress)
+    {
+        // Aligned, so that the column can be read in place once mapped
+        buffer_.resize((buffer_.size() + Format::dataAlignment - 1) / Format::dataAlignment
+                         * Format::dataAlignment,
+                       '\0');
+        Block block{buffer_.size(), size, size};
+        buffer_.append(static_cast<const char*>(data), size);
+        return block;
+    }
+
+    uLongf compressedSize = compressBound(static_cast<uLong>(size));
+    Block block{buffer_.size(), 0, size};
+    buffer_.resize(buffer_.size() + compressedSize);
+    if (compress2(reinterpret_cast<Bytef*>(buffer_.data() + block.offset),
+                  &compressedSize,
+                  static_cast<const Bytef*>(data),
+                  static_cast<uLong>(size),
+                  Z_DEFAULT_COMPRESSION)
+        != Z_OK)
+    {
+        throw std::runtime_error("columnar table: compression failed");
+    }
+    block.size = compressedSize;
+    buffer_.resize(block.offset + compressedSize);
+    return block;
+}
+
+void TableWriter::setText(std::string_view preamble, std::string_view rowLabels)
+{
+    std::string text;
+    text.reserve(preamble.size() + rowLabels.size());
+    text.append(preamble).append(rowLabels);
+    preambleSize_ = preamble.size();
+    text_ = append(text.data(), text.size(), true);
+}
+
+void TableWriter::addColumn(const Column& column, const double* values)
+{
+    if (column.notApplicable || rowCount_ == 0)
+    {
+        columns_.emplace_back(column, Block{buffer_.size(), 0, 0});
+        return;
+    }
+
+    if (options_.valueType == ValueType::float32)
+    {
+        floats_.assign(values, values + rowCount_);
+        columns_.emplace_back(column,
+                              append(floats_.data(),
+                                     rowCount_ * sizeof(float),
+                                     options_.compress));
+        return;
+    }
+    columns_.emplace_back(column, append(values, rowCount_ * sizeof(double), options_.compress));
+}
+
+std::string& TableWriter::finalize()
+{
+    Format::Trailer trailer{};
+    trailer.textOffset = text_.offset;
+    trailer.textSize = text_.size;
+    trailer.textRawSize = text_.rawSize;
+    trailer.preambleSize = preambleSize_;
+    trailer.indexOffset = buffer_.size();
+    std::memcpy(trailer.magic, Format::magic, sizeof(Format::magic));
+
+    for (const auto& [column, block]: columns_)
+    {
+        Format::Put(buffer_, block.offset);
+        Format::Put(buffer_, block.size);
+        Format::Put(buffer_, block.rawSize);
+        const uint8_t flags = column.notApplicable ? Format::notApplicable : 0;
+        Format::Put(buffer_, flags);
+        Format::PutString(buffer_, column.name);
+        Format::PutString(buffer_, column.unit);
+        Format::PutString(buffer_, column.statistic);
+        Format::PutString(buffer_, column.precision);
+    }
+    Format::Put(buffer_, trailer);
+
+    const auto columnCount = static_cast<uint32_t>(columns_.size());
+    std::memcpy(buffer_.data() + offsetof(Format::Header, columnCount),
+                &columnCount,
+                sizeof(columnCount));
+    return buffer_;
+}
+
+} // namespace Antares::Columnar
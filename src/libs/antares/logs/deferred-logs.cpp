@@ -0,0 +1,63 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/logs/deferred-logs.h"
+
+namespace Antares
+{
+namespace
+{
+thread_local DeferredLogs* deferredLogsOfThread = nullptr;
+}
+
+DeferredLogs::Capture::Capture(DeferredLogs& deferred):
+    previous_(deferredLogsOfThread)
+{
+    deferredLogsOfThread = &deferred;
+}
+
+DeferredLogs::Capture::~Capture()
+{
+    deferredLogsOfThread = previous_;
+}
+
+void DeferredLogs::flush()
+{
+    // Messages are written by the logger, which may hold them back again for an outer capture
+    auto messages = std::move(messages_);
+    messages_.clear();
+    for (const auto& write: messages)
+    {
+        write();
+    }
+}
+
+DeferredLogs* DeferredLogs::OfCurrentThread()
+{
+    return deferredLogsOfThread;
+}
+
+void DeferredLogs::add(std::function<void()> write)
+{
+    messages_.push_back(std::move(write));
+}
+
+} // namespace Antares
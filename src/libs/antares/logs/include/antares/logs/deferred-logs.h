@@ -0,0 +1,99 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_LOGS_DEFERRED_LOGS_H__
+#define __ANTARES_LIBS_LOGS_DEFERRED_LOGS_H__
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include "yuni/core/logs/null.h"
+
+namespace Antares
+{
+/*!
+** \brief Messages held back instead of being written
+**
+** While a Capture is alive on a thread, the messages logged by this thread are kept here.
+** They are written by flush(), which can be called from another thread. This lets concurrent
+** tasks have their messages written in a stable order, whatever the order they ran in.
+*/
+class DeferredLogs
+{
+public:
+    //! Hold back the messages logged by the calling thread, as long as the capture is alive
+    class Capture
+    {
+    public:
+        explicit Capture(DeferredLogs& deferred);
+        ~Capture();
+
+        Capture(const Capture&) = delete;
+        Capture& operator=(const Capture&) = delete;
+
+    private:
+        DeferredLogs* previous_;
+    };
+
+    //! Write the messages held back, in the order they were logged, and forget them
+    void flush();
+
+    //! Where the messages of the calling thread are held back (null if they are written)
+    static DeferredLogs* OfCurrentThread();
+
+    //! Keep a message, `write` writes it
+    void add(std::function<void()> write);
+
+private:
+    std::vector<std::function<void()>> messages_;
+};
+
+/*!
+** \brief Log Handler: hold back the messages of the threads which have a DeferredLogs capture
+**
+** Must be the first handler : a message held back is given to the whole chain of handlers when
+** it is flushed.
+*/
+template<class NextHandler = Yuni::Logs::NullHandler>
+class DeferrableLogs: public NextHandler
+{
+public:
+    template<class LoggerT, class VerbosityType>
+    void internalDecoratorWriteWL(LoggerT& logger, const AnyString& s) const
+    {
+        if (auto* deferred = DeferredLogs::OfCurrentThread())
+        {
+            // A mutex is already locked : the message is only copied
+            deferred->add([&logger, message = std::string(s.c_str(), s.size())]
+                          { logger.template custom<VerbosityType>() << message; });
+            return;
+        }
+
+        // Transmit the message to the next handler
+        NextHandler::template internalDecoratorWriteWL<LoggerT, VerbosityType>(logger, s);
+    }
+};
+
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_LOGS_DEFERRED_LOGS_H__
@@ -63,13 +63,16 @@
 #include <yuni/core/logs/decorators/applicationname.h>
 #include <yuni/core/logs/handler/callback.h>
 
+#include "deferred-logs.h"
+
 namespace Antares
 {
 //! Handlers for logging
-using LoggingHandlers = Yuni::Logs::StdCout< // For writing to the standard output
-  Yuni::Logs::File<                          // For writing into a log file
-    Yuni::Logs::Callback<>                   // Callback
-    >>;
+using LoggingHandlers = DeferrableLogs< // For holding back the messages of some threads
+  Yuni::Logs::StdCout<                  // For writing to the standard output
+    Yuni::Logs::File<                   // For writing into a log file
+      Yuni::Logs::Callback<>            // Callback
+      >>>;
 
 //! Decorators for logging
 using LoggingDecorators = Yuni::Logs::Time< // Date/Time when the entry log is added
@@ -31,5 +31,23 @@ struct OptimizationOptions
     std::string ortoolsSolver = "sirius";
     bool solverLogs = false;
     std::string solverParameters;
+    //! Warm-start each weekly problem from the basis found for the same week in previous MC years
+    bool warmStartAcrossYears = false;
+    //! Reuse the weekly constraint matrix as long as its inputs are unchanged
+    bool reuseConstraintMatrix = false;
+    //! Solve the daily problems of a week in parallel (daily optimization only)
+    bool parallelDailyProblems = false;
+    //! Solve the curtailment sharing problems of the hours of a week in parallel
+    bool parallelCsrHours = false;
+    //! Experimental : share the optimal bases of the weekly problems between all MC years,
+    //! including the ones running in parallel
+    bool shareBasesAcrossYears = false;
+
+    //! Whether the LP resolutions of the solver start from a given basis (XPRESS only, see
+    //! solverSupportsWarmStart). The other solvers ignore the bases of the previous years.
+    bool solverSupportsWarmStart() const
+    {
+        return ortoolsSolver == "xpress";
+    }
 };
 } // namespace Antares::Solver::Optimization
@@ -30,6 +30,7 @@
 #include "antares/antares/antares.h"
 #include "antares/study//study.h"
 #include "antares/study/area/area.h"
+#include "antares/study/load-tasks.h"
 #include "antares/study/parts/load/prepro.h"
 #include "antares/study/parts/parts.h"
 #include "antares/utils/utils.h"
@@ -1146,103 +1147,145 @@ void AreaList::ensureDataIsInitialized(Parameters& params, bool loadOnlyNeeded)
     AreaListEnsureDataThermalPrepro(this);
 }
 
+// Run `load` for each area, on the loading thread pool. Once an area is loaded, `onAreaDone` is
+// called from the calling thread with its position, then the messages logged while loading the
+// area are written : areas are reported in their usual order
+static bool loadEachArea(AreaList& list,
+                         const StudyLoadOptions& options,
+                         const std::function<bool(Area&)>& load,
+                         const std::function<void(Area&, uint)>& onAreaDone = nullptr)
+{
+    std::vector<Area*> areas;
+    areas.reserve(list.size());
+    list.each([&areas](Area& area) { areas.push_back(&area); });
+
+    std::vector<LoadingTask> tasks;
+    tasks.reserve(areas.size());
+    for (Area* area: areas)
+    {
+        tasks.emplace_back([&load, area] { return load(*area); });
+    }
+
+    auto taskDone = [&areas, &onAreaDone](std::size_t i)
+    {
+        if (onAreaDone)
+        {
+            onAreaDone(*areas[i], static_cast<uint>(i));
+        }
+    };
+    return RunLoadingTasks(tasks, options.nbLoadingThreads, taskDone);
+}
+
 bool AreaList::loadFromFolder(const StudyLoadOptions& options)
 {
     bool ret = true;
-    Clob buffer;
     auto studyVersion = pStudy.header.version;
 
     // Load the list of all available areas
+    auto loadList = [this]()
     {
         logs.info() << "Loading the list of areas...";
         fs::path areaListPath = pStudy.folderInput / "areas" / "list.txt";
-        ret = loadListFromFile(areaListPath) && ret;
-    }
+        return loadListFromFile(areaListPath);
+    };
+    ret = RunLoadingPhase(options, "area_list", loadList) && ret;
 
     // Hydro
+    auto loadHydro = [this]()
     {
         logs.info() << "Loading global hydro data...";
         fs::path hydroPath = pStudy.folderInput / "hydro";
-        ret = PartHydro::LoadFromFolder(pStudy, hydroPath.string()) && ret;
-        ret = PartHydro::validate(pStudy) && ret;
-    }
+        bool r = PartHydro::LoadFromFolder(pStudy, hydroPath.string());
+        return PartHydro::validate(pStudy) && r;
+    };
+    ret = RunLoadingPhase(options, "hydro", loadHydro) && ret;
 
-    // Thermal data, specific to areas
+    // Clusters, specific to areas
+    // The cluster lists must be loaded before the method ensureDataIsInitialized is called
+    // in order to allocate data with all clusters.
+    auto loadClusters = [this, &options, &studyVersion]()
     {
+        bool r = true;
+
         logs.info() << "Loading thermal clusters...";
         fs::path thermalPath = pStudy.folderInput / "thermal";
         fs::path areaIniPath = thermalPath / "areas.ini";
-        ret = AreaListLoadThermalDataFromFile(*this, areaIniPath) && ret;
-
-        // The cluster list must be loaded before the method ensureDataIsInitialized is called
-        // in order to allocate data with all thermal clusters.
-        auto end = areas.end();
-        for (auto i = areas.begin(); i != end; ++i)
-        {
-            Area& area = *(i->second);
-            fs::path areaPath = thermalPath / "clusters" / area.id.to<std::string>();
-            ret = area.thermal.list.loadFromFolder(pStudy, areaPath, &area) && ret;
-            ret = area.thermal.list.validateClusters(pStudy.parameters) && ret;
-        }
-    }
+        r = AreaListLoadThermalDataFromFile(*this, areaIniPath) && r;
 
-    // Short term storage data, specific to areas
-    if (studyVersion >= StudyVersion(8, 6))
-    {
-        logs.info() << "Loading short term storage clusters...";
         fs::path stsFolder = pStudy.folderInput / "st-storage";
-
-        if (fs::exists(stsFolder))
+        bool loadSTStorage = false;
+        if (studyVersion >= StudyVersion(8, 6))
         {
-            for (const auto& area: areas | std::views::values)
+            logs.info() << "Loading short term storage clusters...";
+            loadSTStorage = fs::exists(stsFolder);
+            if (!loadSTStorage)
             {
-                fs::path cluster_folder = stsFolder / "clusters" / area->id.c_str();
-                ret = area->shortTermStorage.createSTStorageClustersFromIniFile(cluster_folder)
-                      && ret;
-
-                const auto constraints_folder = stsFolder / "constraints" / area->id.c_str();
-                ret = area->shortTermStorage.loadAdditionalConstraints(constraints_folder) && ret;
+                logs.info() << "Short term storage not found, skipping";
             }
         }
-        else
-        {
-            logs.info() << "Short term storage not found, skipping";
-        }
-    }
 
-    // Renewable data, specific to areas
-    if (studyVersion >= StudyVersion(8, 1))
-    {
-        // The cluster list must be loaded before the method ensureDataIsInitialized is called
-        // in order to allocate data with all renewable clusters.
+        const bool loadRenewables = studyVersion >= StudyVersion(8, 1);
         fs::path renewClusterPath = pStudy.folderInput / "renewables" / "clusters";
 
-        auto end = areas.end();
-        for (auto i = areas.begin(); i != end; ++i)
+        auto loadAreaClusters = [&](Area& area)
         {
-            Area& area = *(i->second);
-            fs::path areaPath = renewClusterPath / area.id.to<std::string>();
-            ret = area.renewable.list.loadFromFolder(areaPath, &area) && ret;
-            ret = area.renewable.list.validateClusters() && ret;
-        }
-    }
+            bool areaRet = true;
+            const auto areaId = area.id.to<std::string>();
+
+            fs::path areaPath = thermalPath / "clusters" / areaId;
+            areaRet = area.thermal.list.loadFromFolder(pStudy, areaPath, &area) && areaRet;
+            areaRet = area.thermal.list.validateClusters(pStudy.parameters) && areaRet;
+
+            if (loadSTStorage)
+            {
+                fs::path clusterFolder = stsFolder / "clusters" / areaId;
+                areaRet = area.shortTermStorage.createSTStorageClustersFromIniFile(clusterFolder)
+                          && areaRet;
+
+                const auto constraintsFolder = stsFolder / "constraints" / areaId;
+                areaRet = area.shortTermStorage.loadAdditionalConstraints(constraintsFolder)
+                          && areaRet;
+            }
+
+            if (loadRenewables)
+            {
+                areaPath = renewClusterPath / areaId;
+                areaRet = area.renewable.list.loadFromFolder(areaPath, &area) && areaRet;
+                areaRet = area.renewable.list.validateClusters() && areaRet;
+            }
+            return areaRet;
+        };
+        return loadEachArea(*this, options, loadAreaClusters) && r;
+    };
+    ret = RunLoadingPhase(options, "clusters", loadClusters) && ret;
 
     // Prepare
-    ensureDataIsInitialized(pStudy.parameters, options.loadOnlyNeeded);
+    auto prepare = [this, &options]()
+    {
+        ensureDataIsInitialized(pStudy.parameters, options.loadOnlyNeeded);
+        return true;
+    };
+    RunLoadingPhase(options, "allocation", prepare);
 
     // Load all nodes
-    uint indx = 0;
-    each(
-      [&options, &ret, &buffer, &indx, this](Data::Area& area)
-      {
-          // Progression
-          options.logMessage.clear()
-            << "Loading the area " << (++indx) << '/' << areas.size() << ": " << area.name;
-          logs.info() << options.logMessage;
+    auto loadAreas = [this, &options]()
+    {
+        auto loadArea = [this, &options](Area& area)
+        {
+            Clob buffer;
+            return AreaListLoadFromFolderSingleArea(pStudy, this, area, buffer, options);
+        };
 
-          // Load a single area
-          ret = AreaListLoadFromFolderSingleArea(pStudy, this, area, buffer, options) && ret;
-      });
+        // Progression, reported in order before the messages of each area
+        auto areaDone = [this, &options](Area& area, uint indx)
+        {
+            options.logMessage.clear()
+              << "Loading the area " << (indx + 1) << '/' << areas.size() << ": " << area.name;
+            logs.info() << options.logMessage;
+        };
+        return loadEachArea(*this, options, loadArea, areaDone);
+    };
+    ret = RunLoadingPhase(options, "areas", loadAreas) && ret;
 
     // update nameid set
     updateNameIDSet();
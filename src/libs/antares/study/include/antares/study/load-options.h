@@ -26,6 +26,7 @@
 
 #include <antares/optimization-options/options.h>
 
+#include "fwd.h"
 #include "parameters.h"
 
 namespace Antares
@@ -60,6 +61,15 @@ public:
     // This option might be useful for running old studies without upgrading
     bool noTimeseriesImportIntoInput;
 
+    //! Use the binary cache of the input matrices, next to the study
+    bool useInputCache = false;
+
+    //! Maximum number of threads used to load the study (0 for one per logical core)
+    uint nbLoadingThreads = 0;
+
+    //! Records the duration of each loading phase, if not null
+    Benchmarking::DurationCollector* durationCollector = nullptr;
+
     //! Simplex optimization range
     SimplexOptimization simplexOptimizationRange;
     //! Mps files export asked
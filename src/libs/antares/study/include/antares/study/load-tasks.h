@@ -0,0 +1,66 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_STUDY_LOAD_TASKS_H__
+#define __ANTARES_LIBS_STUDY_LOAD_TASKS_H__
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "load-options.h"
+
+namespace Antares::Data
+{
+//! A task of the study loading, returning false if some data could not be loaded
+using LoadingTask = std::function<bool()>;
+
+/*!
+** \brief Run independent loading tasks on at most `nbThreads` threads
+**
+** All tasks are run, even if some of them fail, and their outcome is reported in the order
+** they were given, whatever the order they actually finished in : `onTaskDone` is called from
+** the calling thread for each task in turn, and if some tasks threw, the exception of the
+** first of them is rethrown once all tasks are finished.
+**
+** The messages logged by a task are held back, and written right after `onTaskDone` is called
+** for it : the logs are the same whatever the number of threads.
+**
+** \param tasks The tasks to run
+** \param nbThreads The maximum number of threads (0 for one per logical core)
+** \param onTaskDone Called with the index of each task, once it is finished
+** \return True if all tasks succeeded
+*/
+bool RunLoadingTasks(const std::vector<LoadingTask>& tasks,
+                     uint nbThreads,
+                     const std::function<void(std::size_t)>& onTaskDone = nullptr);
+
+/*!
+** \brief Run a phase of the study loading
+**
+** Its duration is recorded as `study_loading_<name>` if the options provide a duration collector.
+*/
+bool RunLoadingPhase(const StudyLoadOptions& options,
+                     const std::string& name,
+                     const LoadingTask& phase);
+
+} // namespace Antares::Data
+
+#endif // __ANTARES_LIBS_STUDY_LOAD_TASKS_H__
@@ -500,6 +500,15 @@ public:
     // Format of results. Currently, only single files or zip archive are supported
     ResultFormat resultFormat = legacyFilesDirectories;
 
+    //! Options of the columnar result format
+    struct
+    {
+        //! Store the values as float32 instead of float64
+        bool float32 = false;
+        //! Compress each column
+        bool compress = false;
+    } columnarResults;
+
     // Naming constraints and variables in problems
     bool namedProblems;
 
@@ -399,6 +399,14 @@ public:
     */
     void getNumberOfCores(const bool forceParallel, const uint nbYearsParallelForced);
 
+    /*!
+    ** \brief Divides the MC years into sets of parallel years
+    **
+    ** A new set starts after each time-series refresh, or when the current set
+    ** contains maxSetSize years actually run.
+    */
+    std::vector<std::vector<uint>> buildSetsOfParallelYears(uint maxSetSize) const;
+
     /*!
     ** \brief Remove timeseries if ts-generator is enabled
     */
@@ -471,10 +479,23 @@ public:
     // Maximum number of years in a set of parallel years.
     // It is a possible reduction of the raw number of cores set by user (simulation cores level).
     // This raw number of cores is possibly reduced by the smallest TS refresh span or the total
-    // number of MC years. In GUI, used for RAM estimation only. In solver, it is the max number of
-    // years (actually run, not skipped) a set of parallel years can contain.
+    // number of MC years. In GUI, used for RAM estimation only. In solver, it is the number of
+    // spaces (numSpace) MC years are run on : years in progress at the same time, running or
+    // waiting for older years to be merged into the synthesis.
     uint maxNbYearsInParallel = 1;
 
+    // Used in solver only.
+    // --------------------
+    // Max number of years (actually run, not skipped) a set of parallel years can contain, that
+    // is, the number of MC years computed at the same time.
+    uint maxNbYearsRunning = 1;
+
+    // Used in solver only.
+    // --------------------
+    // Number of threads of the computations nested in the running years (hydro allocation, daily
+    // problems). When 0, the cores left by the years running in parallel are used.
+    uint nbNestedThreads = 0;
+
     // Used in GUI only.
     // ----------------
     // Allows storing the maximum number of years in a set of parallel years.
@@ -596,10 +617,8 @@ public:
     //@{
     //! A buffer for temporary operations on filename
     mutable YString buffer;
-    //! A buffer for temporary operations on large amount of data
+    //! A buffer for temporary operations on large amount of data (not used by concurrent loading)
     mutable Matrix<>::BufferType dataBuffer;
-    //! A buffer used when loading time-series for dealing with filenames (prepro/series only)
-    mutable YString bufferLoadingTS;
     //@}
 
     //! The queue service that runs every set of parallel years
@@ -0,0 +1,122 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/study/load-tasks.h"
+
+#include <algorithm>
+#include <thread>
+
+#include <antares/benchmarking/DurationCollector.h>
+#include <antares/concurrency/concurrency.h>
+#include <antares/logs/deferred-logs.h>
+
+namespace Antares::Data
+{
+bool RunLoadingTasks(const std::vector<LoadingTask>& tasks,
+                     uint nbThreads,
+                     const std::function<void(std::size_t)>& onTaskDone)
+{
+    if (nbThreads == 0)
+    {
+        nbThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    nbThreads = std::min<std::size_t>(nbThreads, tasks.size());
+
+    std::vector<char> results(tasks.size(), true);
+    std::vector<std::exception_ptr> errors(tasks.size());
+    // The messages of each task are written once it is reported, so that they don't interleave
+    std::vector<DeferredLogs> messages(tasks.size());
+    auto runTask = [&tasks, &results, &errors, &messages](std::size_t i)
+    {
+        DeferredLogs::Capture capture(messages[i]);
+        try
+        {
+            results[i] = tasks[i]();
+        }
+        catch (...)
+        {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    auto taskDone = [&onTaskDone, &messages](std::size_t i)
+    {
+        if (onTaskDone)
+        {
+            onTaskDone(i);
+        }
+        messages[i].flush();
+    };
+
+    if (nbThreads <= 1)
+    {
+        for (std::size_t i = 0; i != tasks.size(); ++i)
+        {
+            runTask(i);
+            taskDone(i);
+        }
+    }
+    else
+    {
+        Yuni::Job::QueueService threadPool;
+        threadPool.maximumThreadCount(nbThreads);
+
+        // Exceptions are caught by the tasks themselves, the futures are only used to wait
+        std::vector<Concurrency::TaskFuture> futures;
+        futures.reserve(tasks.size());
+        for (std::size_t i = 0; i != tasks.size(); ++i)
+        {
+            futures.push_back(Concurrency::AddTask(threadPool, [&runTask, i] { runTask(i); }));
+        }
+
+        threadPool.start();
+        for (std::size_t i = 0; i != futures.size(); ++i)
+        {
+            futures[i].wait();
+            taskDone(i);
+        }
+        threadPool.wait(Yuni::qseIdle);
+        threadPool.stop();
+    }
+
+    if (auto firstError = std::ranges::find_if(errors, [](const auto& e) { return bool(e); });
+        firstError != errors.end())
+    {
+        std::rethrow_exception(*firstError);
+    }
+    return std::ranges::all_of(results, [](char r) { return r != 0; });
+}
+
+bool RunLoadingPhase(const StudyLoadOptions& options,
+                     const std::string& name,
+                     const LoadingTask& phase)
+{
+    if (!options.durationCollector)
+    {
+        return phase();
+    }
+
+    bool ret = true;
+    (*options.durationCollector)("study_loading_" + name) << [&ret, &phase] { ret = phase(); };
+    return ret;
+}
+
+} // namespace Antares::Data
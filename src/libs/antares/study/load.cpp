@@ -20,7 +20,9 @@
 */
 #include <fstream>
 
+#include <antares/array/matrix-cache.h>
 #include <antares/benchmarking/DurationCollector.h>
+#include "antares/study/load-tasks.h"
 #include "antares/study/scenario-builder/sets.h"
 #include "antares/study/study.h"
 #include "antares/study/ui-runtimeinfos.h"
@@ -185,10 +187,17 @@ bool Study::internalLoadFromFolder(const fs::path& path, const StudyLoadOptions&
     // Initialize all internal paths
     relocate(path.string());
 
+    // Binary cache of the input matrices. Reset on each load, so that a study loaded without
+    // the cache never uses the one of a previous study.
+    MatrixCache::folder.clear();
+    if (options.useInputCache)
+    {
+        MatrixCache::folder = path / ".input-cache";
+        logs.info() << "  input cache: " << MatrixCache::folder;
+    }
+
     // Reserving enough space in buffer to avoid several calls to realloc
     this->dataBuffer.reserve(4 * 1024 * 1024); // For matrices, reserving 4Mo
-    this->bufferLoadingTS.reserve(2096);
-    assert(this->bufferLoadingTS.capacity() > 0);
 
     if (!internalLoadIni(path, options))
     {
@@ -206,6 +215,7 @@ bool Study::internalLoadFromFolder(const fs::path& path, const StudyLoadOptions&
     if (!options.enableParallel && !options.forceParallel)
     {
         maxNbYearsInParallel = 1;
+        maxNbYearsRunning = 1;
     }
 
     // End logical core --------
@@ -213,13 +223,20 @@ bool Study::internalLoadFromFolder(const fs::path& path, const StudyLoadOptions&
     // Areas - Raw Data
     bool ret = areas.loadFromFolder(options);
 
-    logs.info() << "Loading correlation matrices...";
-    // Correlation matrices
-    ret = internalLoadCorrelationMatrices(options) && ret;
-    // Binding constraints
-    ret = internalLoadBindingConstraints(options) && ret;
+    // Correlation matrices and binding constraints only read the areas, and are independent
+    auto loadConstraints = [this, &options]()
+    {
+        logs.info() << "Loading correlation matrices...";
+        const std::vector<LoadingTask> tasks{
+          [this, &options] { return internalLoadCorrelationMatrices(options); },
+          [this, &options] { return internalLoadBindingConstraints(options); }};
+        return RunLoadingTasks(tasks, options.nbLoadingThreads);
+    };
+    ret = RunLoadingPhase(options, "constraints", loadConstraints) && ret;
+
     // Sets of areas & links
-    ret = internalLoadSets() && ret;
+    auto loadSets = [this]() { return internalLoadSets(); };
+    ret = RunLoadingPhase(options, "sets", loadSets) && ret;
 
     parameterFiller(options);
     return ret;
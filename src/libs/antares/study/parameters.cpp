@@ -134,6 +134,11 @@ static bool ConvertCStrToResultFormat(const AnyString& text, ResultFormat& out)
         out = inMemory;
         return true;
     }
+    if (s == "columnar")
+    {
+        out = columnar;
+        return true;
+    }
 
     logs.warning() << "parameters:  invalid result format. Got '" << text << "'";
     out = legacyFilesDirectories;
@@ -152,6 +157,9 @@ static void ParametersSaveResultFormat(IniFile::Section* section, ResultFormat f
     case inMemory:
         section->add(name, "in-memory");
         break;
+    case columnar:
+        section->add(name, "columnar");
+        break;
     default:
         section->add(name, "txt-files");
     }
@@ -380,6 +388,7 @@ void Parameters::reset()
     hydroDebug = false;
 
     resultFormat = legacyFilesDirectories;
+    columnarResults = {};
 
     // Adequacy patch parameters
     adqPatchParams.reset();
@@ -665,6 +674,14 @@ static bool SGDIntLoadFamily_Output(Parameters& d,
     {
         return ConvertCStrToResultFormat(value, d.resultFormat);
     }
+    if (key == "columnar-float32")
+    {
+        return value.to<bool>(d.columnarResults.float32);
+    }
+    if (key == "columnar-compression")
+    {
+        return value.to<bool>(d.columnarResults.compress);
+    }
     return false;
 }
 
@@ -1285,6 +1302,11 @@ void Parameters::handleOptimizationOptions(const StudyLoadOptions& options)
     // Options only set from the command-line
     optOptions.ortoolsSolver = options.optOptions.ortoolsSolver;
     optOptions.solverParameters = options.optOptions.solverParameters;
+    optOptions.warmStartAcrossYears = options.optOptions.warmStartAcrossYears;
+    optOptions.reuseConstraintMatrix = options.optOptions.reuseConstraintMatrix;
+    optOptions.parallelDailyProblems = options.optOptions.parallelDailyProblems;
+    optOptions.parallelCsrHours = options.optOptions.parallelCsrHours;
+    optOptions.shareBasesAcrossYears = options.optOptions.shareBasesAcrossYears;
 
     // Options that can be set both in command-line and file
     optOptions.solverLogs = options.optOptions.solverLogs || optOptions.solverLogs;
@@ -1491,6 +1513,13 @@ void Parameters::prepareForSimulation(const StudyLoadOptions& options)
     // We don't care of the variable `horizon` since it is not used by the solver
     horizon.clear();
 
+    if (options.optOptions.warmStartAcrossYears && !options.optOptions.solverSupportsWarmStart())
+    {
+        logs.warning() << "  The solver " << options.optOptions.ortoolsSolver
+                       << " does not start from a given basis : --warm-start-across-years has"
+                       << " no effect";
+    }
+
     // Simplex optimization range
     switch (simplexOptimizationRange)
     {
@@ -1788,6 +1817,27 @@ void Parameters::prepareForSimulation(const StudyLoadOptions& options)
     {
         logs.info() << "  :: The problems will contain named variables and constraints";
     }
+    if (optOptions.warmStartAcrossYears)
+    {
+        logs.info() << "  :: Weekly problems are warm-started from previous MC years";
+    }
+    if (optOptions.reuseConstraintMatrix)
+    {
+        logs.info() << "  :: The constraint matrix is reused across weeks when unchanged";
+    }
+    if (optOptions.parallelDailyProblems)
+    {
+        logs.info() << "  :: The daily problems of a week are solved in parallel";
+    }
+    if (optOptions.parallelCsrHours)
+    {
+        logs.info() << "  :: The curtailment sharing problems of a week are solved in parallel";
+    }
+    if (optOptions.shareBasesAcrossYears)
+    {
+        logs.info() << "  :: The bases of the weekly problems are shared between MC years"
+                    << " (experimental, results are not reproducible)";
+    }
     // indicated whether solver logs will be printed
     logs.info() << "  :: Printing solver logs : " << (optOptions.solverLogs ? "True" : "False");
 }
@@ -1868,6 +1918,11 @@ void Parameters::saveToINI(IniFile& ini) const
         }
         ParametersSaveTimeSeries(section, "archives", timeSeriesToArchive);
         ParametersSaveResultFormat(section, resultFormat);
+        if (resultFormat == columnar)
+        {
+            section->add("columnar-float32", columnarResults.float32);
+            section->add("columnar-compression", columnarResults.compress);
+        }
     }
 
     // Optimization
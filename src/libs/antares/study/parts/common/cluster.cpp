@@ -93,12 +93,12 @@ bool Cluster::loadDataSeriesFromFolder(Study& s, const fs::path& folder)
         return true;
     }
 
-    auto& buffer = s.bufferLoadingTS;
-
     bool ret = true;
     fs::path seriesPath = folder / parentArea->id.to<std::string>() / id() / "series.txt";
 
-    ret = series.timeSeries.loadFromCSVFile(seriesPath.string(), 1, HOURS_PER_YEAR, &s.dataBuffer)
+    // Clusters may be loaded from several threads at once, the buffer can't be shared
+    Matrix<>::BufferType dataBuffer;
+    ret = series.timeSeries.loadFromCSVFile(seriesPath.string(), 1, HOURS_PER_YEAR, &dataBuffer)
           && ret;
 
     if (s.usedByTheSolver && s.parameters.derated)
@@ -142,7 +142,9 @@ bool PreproHydro::saveToFolder(const AreaName& areaID, const char* folder)
     return false;
 }
 
-bool PreproHydro::loadFromFolder(Study& s, const std::string& areaID, const fs::path& folder)
+bool PreproHydro::loadFromFolder(Study& /* study */,
+                                 const std::string& areaID,
+                                 const fs::path& folder)
 {
     enum
     {
@@ -156,11 +158,12 @@ bool PreproHydro::loadFromFolder(Study& s, const std::string& areaID, const fs::
     bool ret = PreproHydroLoadSettings(this, preproPath);
 
     fs::path energyPath = folder / areaID / "energy.txt";
+    Matrix<>::BufferType dataBuffer;
     ret = data.loadFromCSVFile(energyPath.string(),
                                hydroPreproMax,
                                maxNbOfLineToLoad,
                                mtrxOption,
-                               &s.dataBuffer)
+                               &dataBuffer)
           && ret;
 
     return ret;
@@ -21,6 +21,7 @@
 
 #include "antares/study/study.h"
 
+#include <algorithm>
 #include <cassert>
 #include <climits>
 #include <cmath> // For use of floor(...) and ceil(...)
@@ -184,7 +185,6 @@ void Study::reduceMemoryUsage()
 {
     ClearAndShrink(buffer);
     ClearAndShrink(dataBuffer);
-    ClearAndShrink(bufferLoadingTS);
 }
 
 unsigned Study::getNumberOfCoresPerMode(unsigned nbLogicalCores, int ncMode)
@@ -215,6 +215,16 @@ unsigned Study::getNumberOfCoresPerMode(unsigned nbLogicalCores, int ncMode)
     return 0;
 }
 
+static uint LargestSetSize(const std::vector<std::vector<uint>>& setsOfParallelYears)
+{
+    uint largest = 0;
+    for (const auto& set: setsOfParallelYears)
+    {
+        largest = std::max(largest, (uint)set.size());
+    }
+    return largest;
+}
+
 void Study::getNumberOfCores(const bool forceParallel, const uint nbYearsParallelForced)
 {
     /*
@@ -270,7 +280,47 @@ void Study::getNumberOfCores(const bool forceParallel, const uint nbYearsParalle
     // Getting the minimum number of years in a set of parallel years.
     // To get this number, we have to divide all years into sets of parallel
     // years and pick the size of the smallest set.
+    auto setsOfParallelYears = buildSetsOfParallelYears(maxNbYearsInParallel);
+
+    // Now finding the smallest size among all sets.
+    minNbYearsInParallel = maxNbYearsInParallel;
+    for (uint s = 0; s < setsOfParallelYears.size(); s++)
+    {
+        uint setSize = (uint)setsOfParallelYears[s].size();
+        // Empty sets are not taken into account because, on the solver side,
+        // they will contain only skipped years
+        if (setSize && (setSize < minNbYearsInParallel))
+        {
+            minNbYearsInParallel = setSize;
+        }
+    }
+
+    // GUI : storing minimum number of parallel years (in a set of parallel years).
+    //		 Useful in the run window's simulation cores field in case parallel mode is enabled
+    // by user.
+    minNbYearsInParallel_save = minNbYearsInParallel;
+
+    // The max number of years to run in parallel is limited by the max number years in a set of
+    // parallel years. This latter number can be limited by the smallest interval between 2 refresh
+    // points and determined by the unrun MC years in case of play-list.
+    maxNbYearsRunning = LargestSetSize(setsOfParallelYears);
+
+    // A year ending before older ones keeps its results in its space until they are merged into
+    // the synthesis. As many spare spaces as running years let the threads go on with the next
+    // years meanwhile, within the same bounds.
+    maxNbYearsInParallel = maxNbYearsRunning > 1
+                             ? LargestSetSize(buildSetsOfParallelYears(2 * maxNbYearsRunning))
+                             : maxNbYearsRunning;
+
+    // GUI : storing max nb of parallel years (in a set of parallel years) in case parallel mode is
+    // enabled.
+    //		 Useful for RAM estimation.
+    maxNbYearsInParallel_save = maxNbYearsInParallel;
+}
 
+std::vector<std::vector<uint>> Study::buildSetsOfParallelYears(uint maxSetSize) const
+{
+    const auto& p = parameters;
     std::vector<uint>* set = nullptr;
     bool buildNewSet = true;
     std::vector<std::vector<uint>> setsOfParallelYears;
@@ -326,7 +376,7 @@ void Study::getNumberOfCores(const bool forceParallel, const uint nbYearsParalle
         }
 
         // Do we build a new set at next iteration (for years to be executed or not) ?
-        if (set->size() == maxNbYearsInParallel)
+        if (set->size() == maxSetSize)
         {
             buildNewSet = true;
         }
@@ -336,41 +386,7 @@ void Study::getNumberOfCores(const bool forceParallel, const uint nbYearsParalle
         }
     } // End of loop over years
 
-    // Now finding the smallest size among all sets.
-    minNbYearsInParallel = maxNbYearsInParallel;
-    for (uint s = 0; s < setsOfParallelYears.size(); s++)
-    {
-        uint setSize = (uint)setsOfParallelYears[s].size();
-        // Empty sets are not taken into account because, on the solver side,
-        // they will contain only skipped years
-        if (setSize && (setSize < minNbYearsInParallel))
-        {
-            minNbYearsInParallel = setSize;
-        }
-    }
-
-    // GUI : storing minimum number of parallel years (in a set of parallel years).
-    //		 Useful in the run window's simulation cores field in case parallel mode is enabled
-    // by user.
-    minNbYearsInParallel_save = minNbYearsInParallel;
-
-    // The max number of years to run in parallel is limited by the max number years in a set of
-    // parallel years. This latter number can be limited by the smallest interval between 2 refresh
-    // points and determined by the unrun MC years in case of play-list.
-    uint maxNbYearsOverAllSets = 0;
-    for (uint s = 0; s < setsOfParallelYears.size(); s++)
-    {
-        if (setsOfParallelYears[s].size() > maxNbYearsOverAllSets)
-        {
-            maxNbYearsOverAllSets = (uint)setsOfParallelYears[s].size();
-        }
-    }
-    maxNbYearsInParallel = maxNbYearsOverAllSets;
-
-    // GUI : storing max nb of parallel years (in a set of parallel years) in case parallel mode is
-    // enabled.
-    //		 Useful for RAM estimation.
-    maxNbYearsInParallel_save = maxNbYearsInParallel;
+    return setsOfParallelYears;
 }
 
 bool Study::initializeRuntimeInfos()
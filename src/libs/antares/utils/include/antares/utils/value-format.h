@@ -0,0 +1,86 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_UTILS_VALUE_FORMAT_H__
+#define __ANTARES_LIBS_UTILS_VALUE_FORMAT_H__
+
+#include <charconv>
+#include <cstdio>
+#include <string_view>
+
+namespace Antares::Utils
+{
+/*!
+** \brief Number of decimals of a printf format like "%.3f"
+**
+** \return The number of decimals, -1 if the format has any other shape
+*/
+inline int FixedFormatDecimals(std::string_view format)
+{
+    if (format.size() != 4 || format[0] != '%' || format[1] != '.' || format[3] != 'f'
+        || format[2] < '0' || format[2] > '9')
+    {
+        return -1;
+    }
+    return format[2] - '0';
+}
+
+/*!
+** \brief Append a tab and a value, formatted exactly like printf(format, v) would
+**
+** The conversion is done by std::to_chars when the format is a fixed notation
+** (`decimals` >= 0, see FixedFormatDecimals()), which gives the same characters
+** as printf, without parsing the format for each value.
+**
+** \return False if the value could not be converted
+*/
+template<class StringT>
+inline bool AppendFixedValue(StringT& buffer, double v, int decimals, const char* format)
+{
+    // Large enough for "%.9f" of the largest double
+    char conversion[512];
+    conversion[0] = '\t';
+    char* const first = conversion + 1;
+    char* const last = conversion + sizeof(conversion);
+
+    if (decimals >= 0)
+    {
+        auto result = std::to_chars(first, last, v, std::chars_format::fixed, decimals);
+        if (result.ec != std::errc())
+        {
+            return false;
+        }
+        buffer.append(conversion, result.ptr - conversion);
+        return true;
+    }
+
+    // The snprintf routine is required since we may not have the ending zero
+    // with the standard printf.
+    int size = ::snprintf(first, last - first, format, v);
+    if (size < 0 || size >= last - first)
+    {
+        return false;
+    }
+    buffer.append(conversion, 1 + size);
+    return true;
+}
+} // namespace Antares::Utils
+
+#endif // __ANTARES_LIBS_UTILS_VALUE_FORMAT_H__
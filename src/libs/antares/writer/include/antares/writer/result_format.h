@@ -35,6 +35,9 @@ enum ResultFormat
     // Store outputs inside a single zip archive
     zipArchive,
     // Store outputs in-memory
-    inMemory
+    inMemory,
+    // Store outputs as files inside directories, with the values of the variables stored as
+    // binary columns instead of text
+    columnar
 };
 } // namespace Antares::Data
@@ -20,6 +20,7 @@
 */
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <string>
 
@@ -43,6 +44,9 @@ class ZipWriter;
 /*!
  * In charge of writing one entry into the underlying zip.
  * May be used as a function object.
+ *
+ * The entry is compressed without holding the zip mutex, so that several entries
+ * may be compressed in parallel. Only the append of the compressed data is serialized.
  */
 template<class ContentT>
 class ZipWriteJob
@@ -51,6 +55,7 @@ public:
     ZipWriteJob(ZipWriter& writer,
                 const std::string& entryPath,
                 ContentT& content,
+                std::size_t reservedBytes,
                 Benchmarking::DurationCollector& duration_collector);
     void writeEntry();
 
@@ -60,6 +65,8 @@ public:
     }
 
 private:
+    // Writer owning the zip
+    ZipWriter& pWriter;
     // Pointer to Zip handle
     void* pZipHandle;
     // Protect pZipHandle against concurrent writes, since minizip-ng isn't thread-safe
@@ -70,6 +77,8 @@ private:
     const std::string pEntryPath;
     // Content of the new file
     ContentT pContent;
+    // Bytes reserved on the memory budget of the writer, released once the entry is written
+    std::size_t pReservedBytes;
     // Benchmarking. How long do we wait ? How long does the zip write take ?
     Benchmarking::DurationCollector& pDurationCollector;
 };
@@ -105,13 +114,21 @@ private:
     const std::filesystem::path pArchivePath;
     // Benchmarking. Passed to jobs
     Benchmarking::DurationCollector& pDurationCollector;
+    // Level of compression of the entries, used by the jobs
+    int pCompressionLevel;
 
     Concurrency::FutureSet pendingTasks_;
 
+    // Size of the entries waiting to be compressed and written
+    std::atomic<std::size_t> pPendingBytes = 0;
+
 private:
     template<class ContentType>
     void addEntryFromBufferHelper(const std::filesystem::path& entryPath,
                                   ContentType& entryContent);
+
+    // Reserve room for an entry in the memory budget. Fails if the budget is exceeded.
+    bool tryReservePendingBytes(std::size_t size);
 };
 } // namespace Antares::Solver
 
@@ -35,10 +35,20 @@ void ZipWriter::addEntryFromBufferHelper(const std::filesystem::path& entryPath,
         return;
     }
 
+    const std::size_t size = entryContent.size();
+    if (!tryReservePendingBytes(size))
+    {
+        // Too much data is already waiting to be written: write this entry right away,
+        // which slows down the producers until the queue has caught up.
+        ZipWriteJob<ContentType>(*this, entryPath.string(), entryContent, 0, pDurationCollector)
+          .writeEntry();
+        return;
+    }
+
     EnsureQueueStartedIfNeeded ensureQueue(this, pQueueService);
     pendingTasks_.add(Concurrency::AddTask(
       *pQueueService,
-      ZipWriteJob<ContentType>(*this, entryPath.string(), entryContent, pDurationCollector),
+      ZipWriteJob<ContentType>(*this, entryPath.string(), entryContent, size, pDurationCollector),
       Yuni::Job::priorityLow));
 }
 
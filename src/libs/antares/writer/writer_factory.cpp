@@ -41,6 +41,7 @@ IResultWriter::Ptr resultWriterFactory(Antares::Data::ResultFormat fmt,
     case inMemory:
         return std::make_shared<InMemoryWriter>(duration_collector);
     case legacyFilesDirectories:
+    case columnar:
     default:
         return std::make_shared<ImmediateFileResultWriter>(folderOutput);
     }
@@ -20,6 +20,7 @@
 */
 #include "zip_writer.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iterator>
 #include <memory>
@@ -36,6 +37,8 @@ extern "C"
 #include <mz_zip_rw.h>
 }
 
+#include <zlib.h>
+
 #include <ctime> // std::time
 #include <sstream>
 #include <utility>
@@ -56,16 +59,105 @@ template<class ContentT>
 ZipWriteJob<ContentT>::ZipWriteJob(ZipWriter& writer,
                                    const std::string& entryPath,
                                    ContentT& content,
+                                   std::size_t reservedBytes,
                                    Benchmarking::DurationCollector& duration_collector):
+    pWriter(writer),
     pZipHandle(writer.pZipHandle),
     pZipMutex(writer.pZipMutex),
     pState(writer.pState),
     pEntryPath(entryPath),
     pContent(std::move(content)),
+    pReservedBytes(reservedBytes),
     pDurationCollector(duration_collector)
 {
 }
 
+namespace
+{
+// Size of the pieces given to zlib and minizip-ng, whose lengths are 32 bits
+constexpr std::size_t chunkSize = 64 * 1024 * 1024;
+
+struct DeflatedEntry
+{
+    std::string data;
+    uLong crc;
+    std::size_t uncompressedSize;
+};
+
+// Raw deflate stream, as expected inside a zip entry
+DeflatedEntry deflateEntry(const char* content,
+                           std::size_t size,
+                           int compressionLevel,
+                           const std::string& entryPath)
+{
+    DeflatedEntry entry{.data = {}, .crc = crc32(0L, Z_NULL, 0), .uncompressedSize = size};
+
+    z_stream stream;
+    memset(&stream, 0, sizeof(z_stream));
+    if (deflateInit2(&stream, compressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY)
+        != Z_OK)
+    {
+        logErrorAndThrow("Error compressing entry " + entryPath);
+    }
+
+    int ret = Z_OK;
+    int flush = Z_NO_FLUSH;
+    std::size_t offset = 0;
+    std::size_t written = 0;
+    do
+    {
+        const std::size_t chunk = std::min(chunkSize, size - offset);
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(content + offset));
+        stream.avail_in = static_cast<uInt>(chunk);
+        entry.crc = crc32(entry.crc, stream.next_in, stream.avail_in);
+        offset += chunk;
+        flush = offset == size ? Z_FINISH : Z_NO_FLUSH;
+
+        // Until the whole chunk is consumed
+        do
+        {
+            if (written == entry.data.size())
+            {
+                entry.data.resize(written + deflateBound(&stream, static_cast<uLong>(chunk)));
+            }
+            stream.next_out = reinterpret_cast<Bytef*>(entry.data.data() + written);
+            stream.avail_out = static_cast<uInt>(entry.data.size() - written);
+            ret = deflate(&stream, flush);
+            written = entry.data.size() - stream.avail_out;
+        } while (stream.avail_out == 0 && ret != Z_STREAM_ERROR);
+    } while (flush != Z_FINISH && ret != Z_STREAM_ERROR);
+
+    entry.data.resize(written);
+    deflateEnd(&stream);
+    if (ret != Z_STREAM_END)
+    {
+        logErrorAndThrow("Error compressing entry " + entryPath + " (" + std::to_string(ret)
+                         + ")");
+    }
+    return entry;
+}
+
+// Give the reserved bytes back to the writer, whatever happens when writing the entry
+class PendingBytesRelease
+{
+public:
+    PendingBytesRelease(std::atomic<std::size_t>& pendingBytes, std::size_t size):
+        pendingBytes_(pendingBytes),
+        size_(size)
+    {
+    }
+
+    ~PendingBytesRelease()
+    {
+        pendingBytes_ -= size_;
+    }
+
+private:
+    std::atomic<std::size_t>& pendingBytes_;
+    std::size_t size_;
+};
+} // namespace
+
 static std::unique_ptr<mz_zip_file> createInfo(const std::string& entryPath)
 {
     auto info = std::make_unique<mz_zip_file>();
@@ -80,13 +172,26 @@ static std::unique_ptr<mz_zip_file> createInfo(const std::string& entryPath)
 template<class ContentT>
 void ZipWriteJob<ContentT>::writeEntry()
 {
+    PendingBytesRelease release(pWriter.pPendingBytes, pReservedBytes);
+
     // Don't write data if finalize() has been called
     if (pState != ZipState::can_receive_data)
     {
         return;
     }
 
+    Benchmarking::Timer timer_deflate;
+    const auto deflated = deflateEntry(pContent.data(),
+                                       pContent.size(),
+                                       pWriter.pCompressionLevel,
+                                       pEntryPath);
+    timer_deflate.stop();
+    pDurationCollector.addDuration("zip_deflate", timer_deflate.get_duration());
+
     auto file_info = createInfo(pEntryPath);
+    file_info->crc = static_cast<uint32_t>(deflated.crc);
+    file_info->uncompressed_size = static_cast<int64_t>(deflated.uncompressedSize);
+    file_info->compressed_size = static_cast<int64_t>(deflated.data.size());
 
     Benchmarking::Timer timer_wait;
     std::lock_guard guard(pZipMutex); // Wait
@@ -99,13 +204,23 @@ void ZipWriteJob<ContentT>::writeEntry()
     {
         logErrorAndThrow("Error opening entry " + pEntryPath + " (" + std::to_string(ret) + ")");
     }
-    int32_t bw = mz_zip_writer_entry_write(pZipHandle,
-                                           pContent.data(),
-                                           static_cast<int32_t>(pContent.size()));
-    if (static_cast<unsigned int>(bw) != pContent.size())
+    for (std::size_t offset = 0; offset < deflated.data.size();)
     {
-        logErrorAndThrow("Error writing entry " + pEntryPath + "(written = " + std::to_string(bw)
-                         + ", size = " + std::to_string(pContent.size()) + ")");
+        const std::size_t chunk = std::min(chunkSize, deflated.data.size() - offset);
+        int32_t bw = mz_zip_writer_entry_write(pZipHandle,
+                                               deflated.data.data() + offset,
+                                               static_cast<int32_t>(chunk));
+        if (bw < 0 || static_cast<std::size_t>(bw) != chunk)
+        {
+            logErrorAndThrow("Error writing entry " + pEntryPath + "(written = "
+                             + std::to_string(offset + std::max(bw, 0))
+                             + ", size = " + std::to_string(deflated.data.size()) + ")");
+        }
+        offset += chunk;
+    }
+    if (int32_t ret = mz_zip_writer_entry_close(pZipHandle); ret != MZ_OK)
+    {
+        logErrorAndThrow("Error closing entry " + pEntryPath + " (" + std::to_string(ret) + ")");
     }
 
     timer_write.stop();
@@ -132,7 +247,9 @@ ZipWriter::ZipWriter(std::shared_ptr<Yuni::Job::QueueService> qs,
                          + std::to_string(ret) + ")");
     }
     // TODO : make level of compression configurable
-    mz_zip_writer_set_compress_level(pZipHandle, MZ_COMPRESS_LEVEL_FAST);
+    pCompressionLevel = MZ_COMPRESS_LEVEL_FAST;
+    // Entries are compressed by the write jobs, the archive only receives deflated data
+    mz_zip_writer_set_raw(pZipHandle, 1);
 }
 
 ZipWriter::~ZipWriter()
@@ -187,6 +304,22 @@ void ZipWriter::addEntryFromFile(const fs::path& entryPath, const fs::path& file
     addEntryFromBufferHelper<std::string>(entryPath.string(), buffer);
 }
 
+bool ZipWriter::tryReservePendingBytes(std::size_t size)
+{
+    // Uncompressed data waiting in the queue. A single entry may exceed it.
+    constexpr std::size_t maxPendingBytes = 512 * 1024 * 1024;
+
+    std::size_t pending = pPendingBytes.load();
+    do
+    {
+        if (pending > 0 && pending + size > maxPendingBytes)
+        {
+            return false;
+        }
+    } while (!pPendingBytes.compare_exchange_weak(pending, pending + size));
+    return true;
+}
+
 bool ZipWriter::needsTheJobQueue() const
 {
     return true;
@@ -20,6 +20,10 @@
  */
 #include "antares/application/application.h"
 
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
 #include <antares/antares/fatal-error.h>
 #include <antares/application/ScenarioBuilderOwner.h>
 #include <antares/benchmarking/timer.h>
@@ -107,6 +111,7 @@ void Application::readDataForTheStudy(Data::StudyLoadOptions& options)
     options.prepareOutput = !pSettings.noOutput;
     options.ignoreConstraints = pSettings.ignoreConstraints;
     options.loadOnlyNeeded = true;
+    options.durationCollector = &pDurationCollector;
 
     // Load the study from a folder
     Benchmarking::Timer timer;
@@ -455,6 +460,20 @@ static void logTotalTime(unsigned duration)
                              seconds.count());
 }
 
+// MC years performed per hour, to compare runs of a study with different settings
+static std::optional<double> mcYearsPerHour(const Data::Study& study,
+                                            const Benchmarking::DurationCollector& durations)
+{
+    const auto statistics = durations.getAllStatistics();
+    const auto mcYears = statistics.find("mc_years");
+    if (mcYears == statistics.end() || mcYears->second.total <= 0)
+    {
+        return std::nullopt;
+    }
+    const auto nbPerformedYears = std::ranges::count(study.parameters.yearsFilter, true);
+    return nbPerformedYears * 3'600'000. / mcYears->second.total;
+}
+
 void Application::writeExectutionInfo()
 {
     if (!pStudy)
@@ -467,6 +486,12 @@ void Application::writeExectutionInfo()
 
     logTotalTime(pTotalTimer.get_duration());
 
+    const auto yearsPerHour = mcYearsPerHour(*pStudy, pDurationCollector);
+    if (yearsPerHour)
+    {
+        logs.info() << "Throughput: " << *yearsPerHour << " MC years per hour";
+    }
+
     // If no writer is available, we can't write
     if (!resultWriter)
     {
@@ -482,11 +507,22 @@ void Application::writeExectutionInfo()
     pDurationCollector.toFileContent(file_content);
     study_info_collector.toFileContent(file_content);
     simulation_info_collector.toFileContent(file_content);
+    if (yearsPerHour)
+    {
+        file_content.addItemToSection("throughput",
+                                      "mc years per hour",
+                                      static_cast<int>(std::round(*yearsPerHour)));
+    }
 
     // Flush previous info into a record file
     const std::string exec_info_path = "execution_info.ini";
     std::string content = file_content.saveToBufferAsIni();
     resultWriter->addEntryFromBuffer(exec_info_path, content);
+
+    // Same info, machine-readable
+    const std::string exec_info_json_path = "execution_info.json";
+    std::string json_content = file_content.saveToBufferAsJson();
+    resultWriter->addEntryFromBuffer(exec_info_json_path, json_content);
 }
 
 Application::~Application()
@@ -0,0 +1,89 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "antares/solver/hydro/monthly/h2o_m_donnees_annuelles.h"
+
+namespace Antares
+{
+
+/*!
+** \brief Monthly hydro allocation problems, shared by the areas optimized concurrently
+**
+** The structure of the monthly problem does not depend on the area, so a problem is
+** instantiated once per thread and reused by all the areas this thread optimizes. The
+** simplex problem is released after each area : starting from the basis of another
+** area would make the results depend on the order the areas are handled in.
+*/
+class MonthlyProblemPool
+{
+public:
+    /*!
+    ** \brief A problem taken from the pool, given back to it when destroyed
+    **
+    ** The problem returns to the pool even if its optimization throws.
+    */
+    class BorrowedProblem
+    {
+    public:
+        BorrowedProblem(MonthlyProblemPool& pool, std::unique_ptr<DONNEES_ANNUELLES> problem);
+        ~BorrowedProblem();
+
+        BorrowedProblem(const BorrowedProblem&) = delete;
+        BorrowedProblem& operator=(const BorrowedProblem&) = delete;
+
+        DONNEES_ANNUELLES& operator*() const
+        {
+            return *problem_;
+        }
+
+        DONNEES_ANNUELLES* operator->() const
+        {
+            return problem_.get();
+        }
+
+        DONNEES_ANNUELLES* get() const
+        {
+            return problem_.get();
+        }
+
+    private:
+        MonthlyProblemPool& pool_;
+        std::unique_ptr<DONNEES_ANNUELLES> problem_;
+    };
+
+    //! Take a problem from the pool, or instantiate a new one if none is available
+    BorrowedProblem acquire();
+
+private:
+    //! Give a problem back to the pool, once its results have been read
+    void release(std::unique_ptr<DONNEES_ANNUELLES> problem);
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<DONNEES_ANNUELLES>> problems_;
+};
+
+} // namespace Antares
@@ -21,8 +21,12 @@
 #ifndef __ANTARES_SOLVER_HYDRO_MANAGEMENT_MANAGEMENT_H__
 #define __ANTARES_SOLVER_HYDRO_MANAGEMENT_MANAGEMENT_H__
 
+#include <functional>
+#include <memory>
 #include <unordered_map>
 
+#include <yuni/job/queue/service.h>
+
 #include <antares/mersenne-twister/mersenne-twister.h>
 #include <antares/study/area/area.h>
 #include <antares/study/fwd.h>
@@ -58,13 +62,22 @@ using HYDRO_VENTILATION_RESULTS = std::vector<VENTILATION_HYDRO_RESULTS_BY_AREA>
 using HydroSpecificMap = std::unordered_map<const Antares::Data::Area*,
                                             Antares::Data::TimeDependantHydroManagementData>;
 
+class MonthlyProblemPool;
+
 class HydroManagement final
 {
 public:
+    /*!
+    ** \brief Constructor
+    **
+    ** \param threadPool Threads optimizing the areas concurrently (sequential if null)
+    */
     HydroManagement(const Data::AreaList& areas,
                     const Data::Parameters& params,
                     const Date::Calendar& calendar,
-                    Solver::IResultWriter& resultWriter);
+                    Solver::IResultWriter& resultWriter,
+                    std::shared_ptr<Yuni::Job::QueueService> threadPool = nullptr);
+    ~HydroManagement();
 
     //! Perform the hydro ventilation
     void makeVentilation(double* randomReservoirLevel,
@@ -77,6 +90,9 @@ public:
     }
 
 private:
+    //! Run a task for each area (with the index of the area), on the thread pool if any
+    void forEachArea(const std::function<void(Data::Area&, uint)>& task) const;
+
     //! Prepare the net demand for each area
     void prepareNetDemand(uint year,
                           Data::SimulationMode mode,
@@ -112,6 +128,9 @@ private:
     const Date::Calendar& calendar_;
     const Data::Parameters& parameters_;
     Solver::IResultWriter& resultWriter_;
+    std::shared_ptr<Yuni::Job::QueueService> threadPool_;
+    //! Monthly problems, reused from an area to another
+    std::unique_ptr<MonthlyProblemPool> monthlyProblems_;
 
     HYDRO_VENTILATION_RESULTS ventilationResults_;
 }; // class HydroManagement
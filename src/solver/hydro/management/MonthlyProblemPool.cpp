@@ -0,0 +1,63 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/solver/hydro/management/MonthlyProblemPool.h"
+
+#include "antares/solver/hydro/monthly/h2o_m_fonctions.h"
+
+namespace Antares
+{
+
+MonthlyProblemPool::BorrowedProblem::BorrowedProblem(MonthlyProblemPool& pool,
+                                                     std::unique_ptr<DONNEES_ANNUELLES> problem):
+    pool_(pool),
+    problem_(std::move(problem))
+{
+}
+
+MonthlyProblemPool::BorrowedProblem::~BorrowedProblem()
+{
+    pool_.release(std::move(problem_));
+}
+
+MonthlyProblemPool::BorrowedProblem MonthlyProblemPool::acquire()
+{
+    {
+        std::lock_guard lock(mutex_);
+        if (!problems_.empty())
+        {
+            auto problem = std::move(problems_.back());
+            problems_.pop_back();
+            return BorrowedProblem(*this, std::move(problem));
+        }
+    }
+    return BorrowedProblem(*this,
+                           std::make_unique<DONNEES_ANNUELLES>(H2O_M_Instanciation(1)));
+}
+
+void MonthlyProblemPool::release(std::unique_ptr<DONNEES_ANNUELLES> problem)
+{
+    H2O_M_Free(*problem);
+    std::lock_guard lock(mutex_);
+    problems_.push_back(std::move(problem));
+}
+
+} // namespace Antares
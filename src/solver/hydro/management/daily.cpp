@@ -552,8 +552,8 @@ void HydroManagement::prepareDailyOptimalGenerations(uint y,
                                                      Antares::Data::Area::ScratchMap& scratchmap,
                                                      HydroSpecificMap& hydro_specific_map)
 {
-    areas_.each(
-      [this, &scratchmap, &y, &hydro_specific_map](Data::Area& area)
-      { prepareDailyOptimalGenerations(area, y, scratchmap, hydro_specific_map[&area]); });
+    forEachArea(
+      [this, &scratchmap, &y, &hydro_specific_map](Data::Area& area, uint)
+      { prepareDailyOptimalGenerations(area, y, scratchmap, hydro_specific_map.at(&area)); });
 }
 } // namespace Antares
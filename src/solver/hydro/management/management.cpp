@@ -24,7 +24,9 @@
 #include <cmath>
 #include <limits>
 
+#include <antares/concurrency/concurrency.h>
 #include <antares/study/area/scratchpad.h>
+#include "antares/solver/hydro/management/MonthlyProblemPool.h"
 
 namespace Antares
 {
@@ -110,11 +112,14 @@ double BetaVariable(double a, double b, MersenneTwister& random)
 HydroManagement::HydroManagement(const Data::AreaList& areas,
                                  const Data::Parameters& params,
                                  const Date::Calendar& calendar,
-                                 Solver::IResultWriter& resultWriter):
+                                 Solver::IResultWriter& resultWriter,
+                                 std::shared_ptr<Yuni::Job::QueueService> threadPool):
     areas_(areas),
     calendar_(calendar),
     parameters_(params),
-    resultWriter_(resultWriter)
+    resultWriter_(resultWriter),
+    threadPool_(std::move(threadPool)),
+    monthlyProblems_(std::make_unique<MonthlyProblemPool>())
 {
     // Ventilation results memory allocation
     uint nbDaysPerYear = 365;
@@ -266,6 +271,34 @@ void HydroManagement::prepareEffectiveDemand(uint year, HydroSpecificMap& hydro_
       });
 }
 
+HydroManagement::~HydroManagement() = default;
+
+void HydroManagement::forEachArea(const std::function<void(Data::Area&, uint)>& task) const
+{
+    std::vector<Data::Area*> areas;
+    areas.reserve(areas_.size());
+    areas_.each([&areas](Data::Area& area) { areas.push_back(&area); });
+
+    if (!threadPool_ || areas.size() < 2)
+    {
+        for (uint i = 0; i != areas.size(); ++i)
+        {
+            task(*areas[i], i);
+        }
+        return;
+    }
+
+    // The areas are independent from each other. The first error raised is re-thrown
+    // once all the tasks have ended.
+    Concurrency::FutureSet results;
+    for (uint i = 0; i != areas.size(); ++i)
+    {
+        Concurrency::Task areaTask = [&task, &areas, i]() { task(*areas[i], i); };
+        results.add(Concurrency::AddTask(*threadPool_, areaTask));
+    }
+    results.join();
+}
+
 void HydroManagement::makeVentilation(double* randomReservoirLevel,
                                       uint y,
                                       Antares::Data::Area::ScratchMap& scratchmap)
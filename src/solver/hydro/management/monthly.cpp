@@ -24,6 +24,7 @@
 #include <sstream>
 
 #include <antares/antares/fatal-error.h>
+#include "antares/solver/hydro/management/MonthlyProblemPool.h"
 #include "antares/solver/hydro/management/management.h"
 #include "antares/solver/hydro/monthly/h2o_m_donnees_annuelles.h"
 #include "antares/solver/hydro/monthly/h2o_m_fonctions.h"
@@ -146,12 +147,13 @@ void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_rese
                                                        uint y,
                                                        HydroSpecificMap& hydro_specific_map)
 {
-    uint indexArea = 0;
-    areas_.each(
-      [this, &random_reservoir_level, &y, &indexArea, &hydro_specific_map](Data::Area& area)
+    // All the areas are already in the map, which is only read here : the areas can be
+    // optimized concurrently
+    forEachArea(
+      [this, &random_reservoir_level, &y, &hydro_specific_map](Data::Area& area, uint indexArea)
       {
           auto& data = area.hydro.managementData[y];
-          auto& hydro_specific = hydro_specific_map[&area];
+          auto& hydro_specific = hydro_specific_map.at(&area);
 
           auto& minLvl = area.hydro.reservoirLevel[Data::PartHydro::minimum];
           auto& maxLvl = area.hydro.reservoirLevel[Data::PartHydro::maximum];
@@ -169,7 +171,9 @@ void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_rese
 
           if (area.hydro.reservoirManagement)
           {
-              auto problem = H2O_M_Instanciation(1);
+              // Given back to the pool at the end of the scope, even if the optimization throws
+              auto problemHandle = monthlyProblems_->acquire();
+              auto& problem = *problemHandle;
 
               double totalInflowsYear = prepareMonthlyTargetGenerations(area, data, hydro_specific);
               assert(totalInflowsYear >= 0.);
@@ -194,9 +198,8 @@ void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_rese
               }
 
               H2O_M_OptimiserUneAnnee(problem, 0);
-              switch (problem.ResultatsValides)
-              {
-              case OUI:
+              char resultatsValides = problem.ResultatsValides;
+              if (resultatsValides == OUI)
               {
 #ifndef NDEBUG
                   CheckHydroAllocationProblem(area, problem, initReservoirLvlMonth, lvi);
@@ -213,9 +216,12 @@ void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_rese
                   hydro_specific.monthly[initReservoirLvlMonth].MOL = lvi;
                   solutionCost = problem.ProblemeHydraulique.CoutDeLaSolution;
                   solutionCostNoised = problem.ProblemeHydraulique.CoutDeLaSolutionBruite;
+              }
 
+              switch (resultatsValides)
+              {
+              case OUI:
                   break;
-              }
               case NON:
               {
                   std::ostringstream msg;
@@ -230,8 +236,6 @@ void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_rese
                   throw FatalError(msg.str());
               }
               }
-
-              H2O_M_Free(problem);
           }
 
           else
@@ -306,7 +310,6 @@ void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_rese
               auto content = buffer.str();
               resultWriter_.addEntryFromBuffer(path, content);
           }
-          indexArea++;
       });
 }
 
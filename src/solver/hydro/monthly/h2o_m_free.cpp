@@ -44,6 +44,7 @@ void H2O_M_Free(DONNEES_ANNUELLES& DonneesAnnuelles)
         if (ProbSpx)
         {
             SPX_LibererProbleme(ProbSpx);
+            ProblemeHydraulique.ProblemeSpx[i] = nullptr;
         }
     }
 
@@ -23,6 +23,7 @@
 #include <regex>
 
 #include <antares/logs/logs.h>
+#include <antares/solver/utils/lp_names.h>
 #include "antares/solver/infeasible-problem-analysis/report.h"
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -44,6 +45,11 @@ constexpr unsigned int nbMaxSlackVarsToKeep = 10;
 namespace Antares::Optimization
 {
 
+ConstraintSlackAnalysis::ConstraintSlackAnalysis(const LpNames& constraintNames):
+    constraintNames_(&constraintNames)
+{
+}
+
 void ConstraintSlackAnalysis::run(MPSolver* problem)
 {
     selectConstraintsToWatch(problem);
@@ -73,6 +79,25 @@ void ConstraintSlackAnalysis::run(MPSolver* problem)
 
 void ConstraintSlackAnalysis::selectConstraintsToWatch(MPSolver* problem)
 {
+    if (constraintNames_)
+    {
+        const int nbConstraints = problem->NumConstraints();
+        if (constraintNames_->size() == static_cast<std::size_t>(nbConstraints))
+        {
+            for (int i = 0; i < nbConstraints; ++i)
+            {
+                if (ConstraintsFactory::isWatched(*constraintNames_, i))
+                {
+                    constraintsToWatch_.push_back(problem->constraint(i));
+                }
+            }
+            return;
+        }
+        logs.warning() << title() << " : the descriptions of the constraints do not match the "
+                       << "problem, selecting the constraints from their names";
+        constraintNames_ = nullptr;
+    }
+
     ConstraintsFactory factory;
     std::regex rgx = factory.constraintsFilter();
     std::ranges::copy_if(problem->constraints(),
@@ -89,21 +114,31 @@ void ConstraintSlackAnalysis::addSlackVariablesToConstraints(MPSolver* problem)
     */
     const unsigned int selectedConstraintsInverseRatio = 3;
     slackVariables_.reserve(problem->NumConstraints() / selectedConstraintsInverseRatio);
+    slackConstraints_.reserve(problem->NumConstraints() / selectedConstraintsInverseRatio);
+    firstSlackVariable_ = problem->NumVariables();
     const double infinity = MPSolver::infinity();
+    // Without names, the name of a slack variable is only built if it is reported
+    const bool named = !constraintNames_;
     for (MPConstraint* c: constraintsToWatch_)
     {
         if (c->lb() > -infinity)
         {
-            const MPVariable* slack = problem->MakeNumVar(0, infinity, c->name() + "::low");
+            const MPVariable* slack = problem->MakeNumVar(0,
+                                                          infinity,
+                                                          named ? c->name() + "::low" : "");
             c->SetCoefficient(slack, 1.);
             slackVariables_.push_back(slack);
+            slackConstraints_.push_back(c);
         }
 
         if (c->ub() < infinity)
         {
-            const MPVariable* slack = problem->MakeNumVar(0, infinity, c->name() + "::up");
+            const MPVariable* slack = problem->MakeNumVar(0,
+                                                          infinity,
+                                                          named ? c->name() + "::up" : "");
             c->SetCoefficient(slack, -1.);
             slackVariables_.push_back(slack);
+            slackConstraints_.push_back(c);
         }
     }
 }
@@ -144,9 +179,35 @@ ConstraintSlackAnalysis::largestSlackVariables()
     return slackVariables_;
 }
 
+std::string ConstraintSlackAnalysis::slackVariableName(const MPVariable* slack) const
+{
+    if (!constraintNames_)
+    {
+        return slack->name();
+    }
+    const MPConstraint* c = slackConstraints_[slack->index() - firstSlackVariable_];
+    return (*constraintNames_)[c->index()] + (c->GetCoefficient(slack) > 0 ? "::low" : "::up");
+}
+
+std::vector<std::shared_ptr<WatchedConstraint>>
+ConstraintSlackAnalysis::largestSlackConstraints() const
+{
+    const ConstraintsFactory factory;
+    std::vector<std::shared_ptr<WatchedConstraint>> constraints;
+    for (const MPVariable* slack: slackVariables_)
+    {
+        auto constraint = factory.create(slackVariableName(slack), slack->solution_value());
+        if (constraint)
+        {
+            constraints.push_back(std::move(constraint));
+        }
+    }
+    return constraints;
+}
+
 void ConstraintSlackAnalysis::printReport() const
 {
-    InfeasibleProblemReport report(slackVariables_);
+    InfeasibleProblemReport report(largestSlackConstraints());
     report.storeSuspiciousConstraints();
     report.storeInfeasibilityCauses();
     std::ranges::for_each(report.getLogs(), [](auto& line) { logs.notice() << line; });
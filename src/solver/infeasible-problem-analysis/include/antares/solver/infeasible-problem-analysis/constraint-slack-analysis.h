@@ -20,6 +20,8 @@
  */
 #pragma once
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "unfeasibility-analysis.h"
@@ -34,14 +36,21 @@ class MPSolver;
 
 namespace Antares::Optimization
 {
+class LpNames;
 
 /*!
  * That particular analysis relaxes all constraints by
  * adding slack variables for each one.
+ *
+ * When the descriptions of the constraints given by the constraint builders are available,
+ * the constraints are selected from them and only the names of the reported constraints are
+ * built : the problem does not need to be named.
  */
 class ConstraintSlackAnalysis: public UnfeasibilityAnalysis
 {
 public:
+    ConstraintSlackAnalysis() = default;
+    explicit ConstraintSlackAnalysis(const LpNames& constraintNames);
     ~ConstraintSlackAnalysis() override = default;
 
     void run(operations_research::MPSolver* problem) override;
@@ -53,6 +62,8 @@ public:
     }
 
     const std::vector<const operations_research::MPVariable*>& largestSlackVariables();
+    //! The constraints relaxed by the largest slack variables
+    std::vector<std::shared_ptr<WatchedConstraint>> largestSlackConstraints() const;
 
 private:
     void selectConstraintsToWatch(operations_research::MPSolver* problem);
@@ -61,9 +72,14 @@ private:
     void sortSlackVariablesByValue();
     void trimSlackVariables();
     bool anySlackVariableNonZero();
+    std::string slackVariableName(const operations_research::MPVariable* slack) const;
 
     std::vector<operations_research::MPConstraint*> constraintsToWatch_;
     std::vector<const operations_research::MPVariable*> slackVariables_;
+    //! Constraint relaxed by each slack variable, from the first slack variable
+    std::vector<const operations_research::MPConstraint*> slackConstraints_;
+    int firstSlackVariable_ = 0;
+    const LpNames* constraintNames_ = nullptr;
     const double thresholdNonZero = 1e-06;
 };
 
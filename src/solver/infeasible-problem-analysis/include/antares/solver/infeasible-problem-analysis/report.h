@@ -40,6 +40,7 @@ class InfeasibleProblemReport
 public:
     InfeasibleProblemReport() = delete;
     explicit InfeasibleProblemReport(const std::vector<const operations_research::MPVariable*>&);
+    explicit InfeasibleProblemReport(std::vector<std::shared_ptr<WatchedConstraint>> constraints);
     void storeSuspiciousConstraints();
     void storeInfeasibilityCauses();
     std::vector<std::string> getLogs();
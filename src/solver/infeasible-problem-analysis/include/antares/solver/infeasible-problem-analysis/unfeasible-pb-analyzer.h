@@ -33,6 +33,7 @@ class MPSolver;
 
 namespace Antares::Optimization
 {
+class LpNames;
 
 /*!
  * In charge of anayzing the possible reasons for the unfeasibility of an optimization problem.
@@ -51,6 +52,11 @@ private:
     std::vector<std::unique_ptr<UnfeasibilityAnalysis>> analysisList_;
 };
 
-std::unique_ptr<UnfeasiblePbAnalyzer> makeUnfeasiblePbAnalyzer();
+/*!
+ * The analysis relies on the descriptions of the variables and constraints given by the problem
+ * builders : the problem does not need to be named.
+ */
+std::unique_ptr<UnfeasiblePbAnalyzer> makeUnfeasiblePbAnalyzer(const LpNames& variableNames,
+                                                               const LpNames& constraintNames);
 
 } // namespace Antares::Optimization
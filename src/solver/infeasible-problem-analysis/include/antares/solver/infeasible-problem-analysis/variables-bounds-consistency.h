@@ -24,8 +24,14 @@
 
 #include "unfeasibility-analysis.h"
 
+namespace operations_research
+{
+class MPVariable;
+}
+
 namespace Antares::Optimization
 {
+class LpNames;
 
 struct VariableBounds
 {
@@ -44,11 +50,15 @@ struct VariableBounds
 /*!
  * That particular analysis simply checks that all variables
  * are within their minimum and maximum bounds.
+ *
+ * When the names of the variables are given, only the names of the incorrect variables are built,
+ * and the problem itself does not need to be named.
  */
 class VariablesBoundsConsistency: public UnfeasibilityAnalysis
 {
 public:
     VariablesBoundsConsistency() = default;
+    explicit VariablesBoundsConsistency(const LpNames& variableNames);
     ~VariablesBoundsConsistency() override = default;
 
     void run(operations_research::MPSolver* problem) override;
@@ -67,7 +77,9 @@ public:
 private:
     void storeIncorrectVariable(std::string name, double lowBound, double upBound);
     bool foundIncorrectVariables();
+    std::string variableName(const operations_research::MPVariable* var) const;
 
     std::vector<VariableBounds> incorrectVars_;
+    const LpNames* variableNames_ = nullptr;
 };
 } // namespace Antares::Optimization
@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <memory>
@@ -10,6 +11,8 @@
 
 namespace Antares::Optimization
 {
+class LpNames;
+
 class WatchedConstraint
 {
 public:
@@ -104,6 +107,14 @@ public:
     std::unique_ptr<WatchedConstraint> create(const std::string&, const double) const;
     std::regex constraintsFilter();
 
+    /*!
+     * Does a constraint belong to one of the watched types ?
+     *
+     * Same selection as constraintsFilter(), but from the description of the constraint given by
+     * the constraint builders, without building its name.
+     */
+    static bool isWatched(const LpNames& constraintNames, std::size_t index);
+
 private:
     std::map<std::string,
              std::function<std::unique_ptr<WatchedConstraint>(const std::string&, const double)>>
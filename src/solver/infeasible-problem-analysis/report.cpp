@@ -32,6 +32,12 @@ InfeasibleProblemReport::InfeasibleProblemReport(
     buildConstraintsFromSlackVars(slackVariables);
 }
 
+InfeasibleProblemReport::InfeasibleProblemReport(
+  std::vector<std::shared_ptr<WatchedConstraint>> constraints):
+    constraints_(std::move(constraints))
+{
+}
+
 void InfeasibleProblemReport::buildConstraintsFromSlackVars(
   const std::vector<const operations_research::MPVariable*>& slackVariables)
 {
@@ -32,11 +32,12 @@ using namespace operations_research;
 namespace Antares::Optimization
 {
 
-std::unique_ptr<UnfeasiblePbAnalyzer> makeUnfeasiblePbAnalyzer()
+std::unique_ptr<UnfeasiblePbAnalyzer> makeUnfeasiblePbAnalyzer(const LpNames& variableNames,
+                                                               const LpNames& constraintNames)
 {
     std::vector<std::unique_ptr<UnfeasibilityAnalysis>> analysisList;
-    analysisList.push_back(std::make_unique<VariablesBoundsConsistency>());
-    analysisList.push_back(std::make_unique<ConstraintSlackAnalysis>());
+    analysisList.push_back(std::make_unique<VariablesBoundsConsistency>(variableNames));
+    analysisList.push_back(std::make_unique<ConstraintSlackAnalysis>(constraintNames));
 
     return std::make_unique<UnfeasiblePbAnalyzer>(std::move(analysisList));
 }
@@ -21,6 +21,7 @@
 #include "antares/solver/infeasible-problem-analysis/variables-bounds-consistency.h"
 
 #include <antares/logs/logs.h>
+#include <antares/solver/utils/lp_names.h>
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #include "ortools/linear_solver/linear_solver.h"
@@ -31,16 +32,20 @@ using namespace operations_research;
 namespace Antares::Optimization
 {
 
+VariablesBoundsConsistency::VariablesBoundsConsistency(const LpNames& variableNames):
+    variableNames_(&variableNames)
+{
+}
+
 void VariablesBoundsConsistency::run(MPSolver* problem)
 {
     for (const auto& var: problem->variables())
     {
         double lowBound = var->lb();
         double upBound = var->ub();
-        std::string name = var->name();
         if (lowBound > upBound)
         {
-            storeIncorrectVariable(name, lowBound, upBound);
+            storeIncorrectVariable(variableName(var), lowBound, upBound);
         }
     }
 
@@ -57,6 +62,16 @@ void VariablesBoundsConsistency::storeIncorrectVariable(std::string name,
     incorrectVars_.push_back(VariableBounds(name, lowBound, upBound));
 }
 
+std::string VariablesBoundsConsistency::variableName(const MPVariable* var) const
+{
+    // Variables added to the problem afterwards are not described
+    if (variableNames_ && static_cast<std::size_t>(var->index()) < variableNames_->size())
+    {
+        return (*variableNames_)[var->index()];
+    }
+    return var->name();
+}
+
 bool VariablesBoundsConsistency::foundIncorrectVariables()
 {
     return !incorrectVars_.empty();
@@ -6,6 +6,8 @@
 #include <boost/algorithm/string/regex.hpp>
 #include <boost/regex.hpp>
 
+#include <antares/solver/utils/lp_names.h>
+
 class StringIsNotWellFormated: public std::runtime_error
 {
 public:
@@ -181,6 +183,26 @@ std::unique_ptr<WatchedConstraint> ConstraintsFactory::create(const std::string&
     return nullptr;
 }
 
+bool ConstraintsFactory::isWatched(const LpNames& constraintNames, std::size_t index)
+{
+    const LpNames::Descriptor& descriptor = constraintNames.descriptor(index);
+    switch (descriptor.location)
+    {
+    case LpNames::Location::Granularity:
+        // Hourly, daily and weekly binding constraints
+        return true;
+    case LpNames::Location::Area:
+    {
+        const std::string_view type = constraintNames.text(descriptor.type);
+        return type == "FictiveLoads" || type == "AreaHydroLevel" || type == "HydroPower";
+    }
+    case LpNames::Location::ShortTermStorage:
+        return constraintNames.text(descriptor.type) == "Level";
+    default:
+        return false;
+    }
+}
+
 std::regex ConstraintsFactory::constraintsFilter()
 {
     auto keyView = std::views::keys(regex_to_ctypes_);
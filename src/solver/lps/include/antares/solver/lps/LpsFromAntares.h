@@ -109,6 +109,23 @@ struct WeeklyDataFromAntares
     auto operator<=>(const WeeklyDataFromAntares& other) const = default;
 };
 
+/**
+ * @class WeeklySolutionFromAntares
+ * @brief The WeeklySolutionFromAntares class is used to store the solution of an Antares weekly
+ * problem.
+ */
+struct WeeklySolutionFromAntares
+{
+    std::vector<double> X; // Valeurs optimales des variables, taille = NombreDeVariables
+    std::vector<double> ReducedCosts; // Couts reduits des variables, taille =
+    // NombreDeVariables
+    std::vector<double> MarginalCosts; // Couts marginaux des contraintes, taille =
+    // NombreDeContraintes
+    std::string name;
+
+    auto operator<=>(const WeeklySolutionFromAntares& other) const = default;
+};
+
 using WeeklyDataByYearWeek = std::map<WeeklyProblemId, WeeklyDataFromAntares>;
 
 /**
@@ -131,6 +131,18 @@ std::unique_ptr<Yuni::GetOpt::Parser> CreateParser(Settings& settings, StudyLoad
                     "zip-output",
                     "Force the write output into a single zip archive");
 
+    // --input-cache
+    parser->addFlag(options.useInputCache,
+                    ' ',
+                    "input-cache",
+                    "Keep a binary copy of the parsed input matrices next to the study, and reuse "
+                    "it as long as the input files are unchanged");
+    // --loading-threads
+    parser->add(options.nbLoadingThreads,
+                ' ',
+                "loading-threads",
+                "Maximum number of threads used to load the study (default: one per logical core)");
+
     parser->addParagraph("\nOptimization");
 
     // --optimization-range
@@ -164,6 +176,43 @@ std::unique_ptr<Yuni::GetOpt::Parser> CreateParser(Settings& settings, StudyLoad
     // --solver-logs
     parser->addFlag(options.optOptions.solverLogs, ' ', "solver-logs", "Print solver logs.");
 
+    // --warm-start-across-years
+    parser->addFlag(options.optOptions.warmStartAcrossYears,
+                    ' ',
+                    "warm-start-across-years",
+                    "Warm-start each weekly problem from the optimal basis found for the same "
+                    "week in previous MC years (XPRESS only).");
+
+    // --reuse-constraint-matrix
+    parser->addFlag(options.optOptions.reuseConstraintMatrix,
+                    ' ',
+                    "reuse-constraint-matrix",
+                    "Build the weekly constraint matrix once and reuse it as long as its inputs "
+                    "are unchanged.");
+
+    // --parallel-daily-problems
+    parser->addFlag(options.optOptions.parallelDailyProblems,
+                    ' ',
+                    "parallel-daily-problems",
+                    "Solve the daily problems of a week in parallel, on the cores left by the "
+                    "MC years running in parallel (daily optimization only).");
+
+    // --parallel-csr-hours
+    parser->addFlag(options.optOptions.parallelCsrHours,
+                    ' ',
+                    "parallel-csr-hours",
+                    "Solve the curtailment sharing problems of the hours of a week in parallel, "
+                    "on the cores left by the MC years running in parallel (adequacy patch "
+                    "only).");
+
+    // --share-bases-across-years
+    parser->addFlag(options.optOptions.shareBasesAcrossYears,
+                    ' ',
+                    "share-bases-across-years",
+                    "Experimental. Start each weekly problem from the best optimal basis found "
+                    "for the same week by any MC year, including the ones running in parallel. "
+                    "Results are not reproducible from one run to another (XPRESS only).");
+
     parser->addParagraph("\nMisc.");
     // --progress
     parser->addFlag(settings.displayProgression,
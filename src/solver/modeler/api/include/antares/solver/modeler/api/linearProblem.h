@@ -21,8 +21,8 @@
 
 #pragma once
 
-#include <map>
 #include <string>
+#include <vector>
 
 #include "mipConstraint.h"
 #include "mipSolution.h"
@@ -32,6 +32,35 @@
 namespace Antares::Solver::Modeler::Api
 {
 
+/**
+ * Variables added at once, one element per variable in each vector
+ * names is either empty (anonymous variables) or holds one name per variable
+ */
+struct VariableBatch
+{
+    std::vector<double> lb;
+    std::vector<double> ub;
+    std::vector<bool> integer;
+    std::vector<std::string> names;
+};
+
+/**
+ * Constraints added at once, one element per constraint in lb, ub and names
+ * The coefficients are given in CSR form: those of the i-th constraint are
+ * coefficients[rowStart[i]] .. coefficients[rowStart[i + 1] - 1], on the variables whose
+ * indices are at the same positions in columns. rowStart is non-decreasing, starts at 0 and
+ * holds one more element than lb.
+ */
+struct ConstraintBatch
+{
+    std::vector<double> lb;
+    std::vector<double> ub;
+    std::vector<int> rowStart;
+    std::vector<int> columns;
+    std::vector<double> coefficients;
+    std::vector<std::string> names;
+};
+
 /**
  * Linear Problem
  * This class is aimed at creating and manipulating variables/constraints
@@ -49,12 +78,20 @@ public:
     /// Create a continuous or integer variable
     virtual IMipVariable* addVariable(double lb, double ub, bool integer, const std::string& name)
       = 0;
+    /// Create all variables of a batch, returns the index of the first one
+    virtual int addVariables(const VariableBatch& batch) = 0;
     virtual IMipVariable* getVariable(const std::string& name) const = 0;
+    /// Variables are indexed from 0, in their order of creation
+    virtual IMipVariable* getVariable(int index) const = 0;
     virtual int variableCount() const = 0;
 
     /// Add a bounded constraint to the problem
     virtual IMipConstraint* addConstraint(double lb, double ub, const std::string& name) = 0;
+    /// Create all constraints of a batch, returns the index of the first one
+    virtual int addConstraints(const ConstraintBatch& batch) = 0;
     virtual IMipConstraint* getConstraint(const std::string& name) const = 0;
+    /// Constraints are indexed from 0, in their order of creation
+    virtual IMipConstraint* getConstraint(int index) const = 0;
     virtual int constraintCount() const = 0;
 
     /// Set the objective coefficient for a given variable
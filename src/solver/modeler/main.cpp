@@ -20,6 +20,8 @@
  */
 
 #include <fstream>
+#include <map>
+#include <memory>
 
 #include <antares/logs/logs.h>
 #include <antares/solver/modeler/api/linearProblemBuilder.h>
@@ -69,9 +71,19 @@ int main(int argc, const char** argv)
         // Fillers, etc.
         std::vector<Antares::Solver::Modeler::Api::LinearProblemFiller*> fillers;
         // TODO memory
+        // Components of the same model share its compiled form
+        std::map<const Antares::Study::SystemModel::Model*,
+                 std::shared_ptr<const Antares::Optimization::CompiledModel>>
+          compiledModels;
         for (auto& [_, component]: system.Components())
         {
-            fillers.push_back(new Antares::Optimization::ComponentFiller(component));
+            auto& compiledModel = compiledModels[component.getModel()];
+            if (!compiledModel)
+            {
+                compiledModel = std::make_shared<Antares::Optimization::CompiledModel>(
+                  *component.getModel());
+            }
+            fillers.push_back(new Antares::Optimization::ComponentFiller(component, compiledModel));
         }
 
         Antares::Solver::Modeler::Api::LinearProblemData LP_Data;
@@ -21,6 +21,9 @@
 
 #pragma once
 
+#include <memory>
+#include <unordered_map>
+
 #include <antares/solver/modeler/api/linearProblem.h>
 #include <antares/solver/modeler/ortoolsImpl/mipConstraint.h>
 #include <antares/solver/modeler/ortoolsImpl/mipSolution.h>
@@ -48,11 +51,15 @@ public:
                                     double ub,
                                     bool integer,
                                     const std::string& name) override;
+    int addVariables(const Api::VariableBatch& batch) override;
     OrtoolsMipVariable* getVariable(const std::string& name) const override;
+    OrtoolsMipVariable* getVariable(int index) const override;
     int variableCount() const override;
 
     OrtoolsMipConstraint* addConstraint(double lb, double ub, const std::string& name) override;
+    int addConstraints(const Api::ConstraintBatch& batch) override;
     OrtoolsMipConstraint* getConstraint(const std::string& name) const override;
+    OrtoolsMipConstraint* getConstraint(int index) const override;
     int constraintCount() const override;
 
     void setObjectiveCoefficient(Api::IMipVariable* var, double coefficient) override;
@@ -72,13 +79,20 @@ public:
 protected:
     operations_research::MPSolver* MpSolver() const;
 
+private:
+    int makeVariable(double lb, double ub, bool integer, const std::string& name);
+    int makeConstraint(double lb, double ub, const std::string& name);
+
 private:
     operations_research::MPSolver* mpSolver_;
     operations_research::MPObjective* objective_;
     operations_research::MPSolverParameters params_;
 
-    std::map<std::string, std::unique_ptr<OrtoolsMipVariable>> variables_;
-    std::map<std::string, std::unique_ptr<OrtoolsMipConstraint>> constraints_;
+    // Indexed as in the MPSolver, named elements are also indexed by name
+    std::vector<std::unique_ptr<OrtoolsMipVariable>> variables_;
+    std::vector<std::unique_ptr<OrtoolsMipConstraint>> constraints_;
+    std::unordered_map<std::string, int> variableIndexes_;
+    std::unordered_map<std::string, int> constraintIndexes_;
 
     std::unique_ptr<OrtoolsMipSolution> solution_;
 };
@@ -19,9 +19,11 @@
  * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
  */
 
+#include <algorithm>
 #include <exception>
 #include <fstream>
 #include <memory>
+#include <stdexcept>
 #include <ortools/linear_solver/linear_solver.h>
 
 #include <antares/logs/logs.h>
@@ -46,12 +48,13 @@ public:
     }
 };
 
-OrtoolsMipVariable* OrtoolsLinearProblem::addVariable(double lb,
-                                                      double ub,
-                                                      bool integer,
-                                                      const std::string& name)
+int OrtoolsLinearProblem::makeVariable(double lb,
+                                       double ub,
+                                       bool integer,
+                                       const std::string& name)
 {
-    if (variables_.contains(name))
+    const int index = static_cast<int>(variables_.size());
+    if (!name.empty() && !variableIndexes_.emplace(name, index).second)
     {
         logs.error() << "This variable already exists: " << name;
         throw ElemAlreadyExists();
@@ -64,8 +67,16 @@ OrtoolsMipVariable* OrtoolsLinearProblem::addVariable(double lb,
         logs.error() << "Couldn't add variable to Ortools MPSolver: " << name;
     }
 
-    const auto& pair = variables_.emplace(name, std::make_unique<OrtoolsMipVariable>(mpVar));
-    return pair.first->second.get(); // <<name, var>, bool>
+    variables_.push_back(std::make_unique<OrtoolsMipVariable>(mpVar));
+    return index;
+}
+
+OrtoolsMipVariable* OrtoolsLinearProblem::addVariable(double lb,
+                                                      double ub,
+                                                      bool integer,
+                                                      const std::string& name)
+{
+    return variables_[makeVariable(lb, ub, integer, name)].get();
 }
 
 OrtoolsMipVariable* OrtoolsLinearProblem::addNumVariable(double lb,
@@ -82,9 +93,35 @@ OrtoolsMipVariable* OrtoolsLinearProblem::addIntVariable(double lb,
     return addVariable(lb, ub, true, name);
 }
 
+int OrtoolsLinearProblem::addVariables(const Api::VariableBatch& batch)
+{
+    const auto count = batch.lb.size();
+    if (batch.ub.size() != count || batch.integer.size() != count
+        || (!batch.names.empty() && batch.names.size() != count))
+    {
+        throw std::invalid_argument("Inconsistent sizes in a batch of variables");
+    }
+
+    static const std::string anonymous;
+    const int first = static_cast<int>(variables_.size());
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        makeVariable(batch.lb[i],
+                     batch.ub[i],
+                     batch.integer[i],
+                     batch.names.empty() ? anonymous : batch.names[i]);
+    }
+    return first;
+}
+
 OrtoolsMipVariable* OrtoolsLinearProblem::getVariable(const std::string& name) const
 {
-    return variables_.at(name).get();
+    return variables_[variableIndexes_.at(name)].get();
+}
+
+OrtoolsMipVariable* OrtoolsLinearProblem::getVariable(int index) const
+{
+    return variables_.at(index).get();
 }
 
 int OrtoolsLinearProblem::variableCount() const
@@ -92,11 +129,10 @@ int OrtoolsLinearProblem::variableCount() const
     return mpSolver_->NumVariables();
 }
 
-OrtoolsMipConstraint* OrtoolsLinearProblem::addConstraint(double lb,
-                                                          double ub,
-                                                          const std::string& name)
+int OrtoolsLinearProblem::makeConstraint(double lb, double ub, const std::string& name)
 {
-    if (constraints_.contains(name))
+    const int index = static_cast<int>(constraints_.size());
+    if (!name.empty() && !constraintIndexes_.emplace(name, index).second)
     {
         logs.error() << "This constraint already exists: " << name;
         throw ElemAlreadyExists();
@@ -109,14 +145,56 @@ OrtoolsMipConstraint* OrtoolsLinearProblem::addConstraint(double lb,
         logs.error() << "Couldn't add variable to Ortools MPSolver: " << name;
     }
 
-    const auto& pair = constraints_.emplace(name,
-                                            std::make_unique<OrtoolsMipConstraint>(mpConstraint));
-    return pair.first->second.get(); // <<name, constraint>, bool>
+    constraints_.push_back(std::make_unique<OrtoolsMipConstraint>(mpConstraint));
+    return index;
+}
+
+OrtoolsMipConstraint* OrtoolsLinearProblem::addConstraint(double lb,
+                                                          double ub,
+                                                          const std::string& name)
+{
+    return constraints_[makeConstraint(lb, ub, name)].get();
+}
+
+int OrtoolsLinearProblem::addConstraints(const Api::ConstraintBatch& batch)
+{
+    const auto count = batch.lb.size();
+    if (batch.ub.size() != count || batch.rowStart.size() != count + 1
+        || (!batch.names.empty() && batch.names.size() != count)
+        || batch.columns.size() != batch.coefficients.size()
+        || batch.rowStart.front() != 0
+        || batch.rowStart.back() != static_cast<int>(batch.columns.size())
+        || !std::ranges::is_sorted(batch.rowStart))
+    {
+        throw std::invalid_argument("Inconsistent sizes in a batch of constraints");
+    }
+
+    static const std::string anonymous;
+    const auto& mpVariables = mpSolver_->variables();
+    const int first = static_cast<int>(constraints_.size());
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        const int index = makeConstraint(batch.lb[i],
+                                         batch.ub[i],
+                                         batch.names.empty() ? anonymous : batch.names[i]);
+        auto* mpConstraint = mpSolver_->constraints()[index];
+        for (int k = batch.rowStart[i]; k < batch.rowStart[i + 1]; ++k)
+        {
+            mpConstraint->SetCoefficient(mpVariables.at(batch.columns[k]),
+                                         batch.coefficients[k]);
+        }
+    }
+    return first;
 }
 
 OrtoolsMipConstraint* OrtoolsLinearProblem::getConstraint(const std::string& name) const
 {
-    return constraints_.at(name).get();
+    return constraints_[constraintIndexes_.at(name)].get();
+}
+
+OrtoolsMipConstraint* OrtoolsLinearProblem::getConstraint(int index) const
+{
+    return constraints_.at(index).get();
 }
 
 int OrtoolsLinearProblem::constraintCount() const
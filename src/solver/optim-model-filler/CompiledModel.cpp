@@ -0,0 +1,453 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <antares/solver/expressions/nodes/ExpressionsNodes.h>
+#include <antares/solver/expressions/visitors/EvalVisitor.h>
+#include <antares/solver/expressions/visitors/NodeVisitor.h>
+#include <antares/solver/optim-model-filler/CompiledModel.h>
+
+using namespace Antares::Solver::Nodes;
+
+namespace Antares::Optimization
+{
+namespace
+{
+/// Same check as EvalVisitor
+double divide(double left, double right)
+{
+    const double result = left / right;
+    if (!std::isfinite(result))
+    {
+        throw Solver::Visitors::EvalVisitorDivisionException(left,
+                                                             right,
+                                                             "is not a finite number");
+    }
+    return result;
+}
+} // namespace
+
+ParametricValue ParametricValue::literal(double value)
+{
+    ParametricValue result;
+    result.code_.front().value = value;
+    return result;
+}
+
+ParametricValue ParametricValue::parameter(unsigned slot)
+{
+    ParametricValue result;
+    result.code_.front() = {.operation = Operation::Parameter, .slot = slot};
+    return result;
+}
+
+bool ParametricValue::isLiteral() const
+{
+    return code_.size() == 1 && code_.front().operation == Operation::Literal;
+}
+
+ParametricValue ParametricValue::combine(const ParametricValue& other, Operation operation) const
+{
+    ParametricValue result;
+    result.code_.clear();
+    result.code_.reserve(code_.size() + other.code_.size() + 1);
+    result.code_.insert(result.code_.end(), code_.begin(), code_.end());
+    result.code_.insert(result.code_.end(), other.code_.begin(), other.code_.end());
+    result.code_.push_back({.operation = operation});
+    // The right operand is evaluated on top of the result of the left one
+    result.stackDepth_ = std::max(stackDepth_, other.stackDepth_ + 1);
+    return result;
+}
+
+ParametricValue ParametricValue::operator+(const ParametricValue& other) const
+{
+    if (isLiteral() && other.isLiteral())
+    {
+        return literal(code_.front().value + other.code_.front().value);
+    }
+    return combine(other, Operation::Add);
+}
+
+ParametricValue ParametricValue::operator-(const ParametricValue& other) const
+{
+    if (isLiteral() && other.isLiteral())
+    {
+        return literal(code_.front().value - other.code_.front().value);
+    }
+    return combine(other, Operation::Subtract);
+}
+
+ParametricValue ParametricValue::operator*(const ParametricValue& other) const
+{
+    if (isLiteral() && other.isLiteral())
+    {
+        return literal(code_.front().value * other.code_.front().value);
+    }
+    return combine(other, Operation::Multiply);
+}
+
+ParametricValue ParametricValue::operator/(const ParametricValue& other) const
+{
+    if (isLiteral() && other.isLiteral())
+    {
+        return literal(divide(code_.front().value, other.code_.front().value));
+    }
+    return combine(other, Operation::Divide);
+}
+
+ParametricValue ParametricValue::negate() const
+{
+    if (isLiteral())
+    {
+        return literal(-code_.front().value);
+    }
+    ParametricValue result = *this;
+    result.code_.push_back({.operation = Operation::Negate});
+    return result;
+}
+
+double ParametricValue::evaluate(const std::vector<double>& parameters) const
+{
+    if (code_.size() == 1)
+    {
+        const auto& instruction = code_.front();
+        return instruction.operation == Operation::Literal ? instruction.value
+                                                           : parameters[instruction.slot];
+    }
+
+    if (stackDepth_ <= maxLocalStackDepth)
+    {
+        std::array<double, maxLocalStackDepth> stack;
+        return execute(parameters, stack.data());
+    }
+    std::vector<double> stack(stackDepth_);
+    return execute(parameters, stack.data());
+}
+
+double ParametricValue::execute(const std::vector<double>& parameters, double* stack) const
+{
+    double* top = stack - 1;
+    for (const auto& instruction: code_)
+    {
+        if (instruction.operation == Operation::Literal)
+        {
+            *++top = instruction.value;
+            continue;
+        }
+        if (instruction.operation == Operation::Parameter)
+        {
+            *++top = parameters[instruction.slot];
+            continue;
+        }
+        if (instruction.operation == Operation::Negate)
+        {
+            *top = -*top;
+            continue;
+        }
+
+        const double right = *top--;
+        double& left = *top;
+        switch (instruction.operation)
+        {
+        case Operation::Add:
+            left += right;
+            break;
+        case Operation::Subtract:
+            left -= right;
+            break;
+        case Operation::Multiply:
+            left *= right;
+            break;
+        case Operation::Divide:
+            left = divide(left, right);
+            break;
+        default:
+            break;
+        }
+    }
+    return *top;
+}
+
+namespace
+{
+std::map<int, ParametricValue> addCoefficients(const std::map<int, ParametricValue>& left,
+                                               const std::map<int, ParametricValue>& right,
+                                               bool subtract)
+{
+    std::map result(left);
+    for (const auto& [var, coef]: right)
+    {
+        if (auto it = result.find(var); it != result.end())
+        {
+            it->second = subtract ? it->second - coef : it->second + coef;
+        }
+        else
+        {
+            result.emplace(var, subtract ? coef.negate() : coef);
+        }
+    }
+    return result;
+}
+
+std::map<int, ParametricValue> scaleCoefficients(const std::map<int, ParametricValue>& coefs,
+                                                 const ParametricValue& scale,
+                                                 bool divide)
+{
+    std::map<int, ParametricValue> result;
+    for (const auto& [var, coef]: coefs)
+    {
+        result.emplace(var, divide ? coef / scale : scale * coef);
+    }
+    return result;
+}
+} // namespace
+
+/**
+ * Compile Expression Visitor
+ * Same rules as ReadLinearExpressionVisitor, but parameters are kept as slots instead of being
+ * replaced by the values of a given component.
+ */
+class CompileExpressionVisitor: public Solver::Visitors::NodeVisitor<ParametricLinearExpression>
+{
+public:
+    explicit CompileExpressionVisitor(CompiledModel& model):
+        model_(model)
+    {
+    }
+
+    std::string name() const override
+    {
+        return "CompileExpressionVisitor";
+    }
+
+    /// Compile a variable bound, which can not depend on any variable
+    ParametricValue bound(const Node* node)
+    {
+        auto expression = dispatch(node);
+        if (!expression.coefPerVar.empty())
+        {
+            throw std::out_of_range("A variable bound can't depend on a variable.");
+        }
+        return expression.offset;
+    }
+
+    /// Compile a constraint, whose root node is a comparison
+    CompiledModel::Constraint constraint(const std::string& id, const Node* node)
+    {
+        const auto* comparison = dynamic_cast<const ComparisonNode*>(node);
+        if (!comparison)
+        {
+            throw std::invalid_argument("Root node of a constraint must be a comparator.");
+        }
+
+        auto leftMinusRight = subtract(dispatch(comparison->left()),
+                                       dispatch(comparison->right()));
+        const auto minusOffset = leftMinusRight.offset.negate();
+        const auto infinity = std::numeric_limits<double>::infinity();
+        CompiledModel::Constraint result{.id = id,
+                                         .lb = ParametricValue::literal(-infinity),
+                                         .ub = ParametricValue::literal(infinity),
+                                         .expression = std::move(leftMinusRight)};
+        if (!dynamic_cast<const LessThanOrEqualNode*>(node))
+        {
+            result.lb = minusOffset;
+        }
+        if (!dynamic_cast<const GreaterThanOrEqualNode*>(node))
+        {
+            result.ub = minusOffset;
+        }
+        return result;
+    }
+
+private:
+    static ParametricLinearExpression add(const ParametricLinearExpression& left,
+                                          const ParametricLinearExpression& right)
+    {
+        return {left.offset + right.offset,
+                addCoefficients(left.coefPerVar, right.coefPerVar, false)};
+    }
+
+    static ParametricLinearExpression subtract(const ParametricLinearExpression& left,
+                                               const ParametricLinearExpression& right)
+    {
+        return {left.offset - right.offset,
+                addCoefficients(left.coefPerVar, right.coefPerVar, true)};
+    }
+
+    ParametricLinearExpression visit(const SumNode* node) override
+    {
+        ParametricLinearExpression sum;
+        for (auto* operand: node->getOperands())
+        {
+            sum = add(sum, dispatch(operand));
+        }
+        return sum;
+    }
+
+    ParametricLinearExpression visit(const SubtractionNode* node) override
+    {
+        return subtract(dispatch(node->left()), dispatch(node->right()));
+    }
+
+    ParametricLinearExpression visit(const MultiplicationNode* node) override
+    {
+        auto left = dispatch(node->left());
+        auto right = dispatch(node->right());
+        if (left.coefPerVar.empty())
+        {
+            return {left.offset * right.offset,
+                    scaleCoefficients(right.coefPerVar, left.offset, false)};
+        }
+        if (right.coefPerVar.empty())
+        {
+            return {left.offset * right.offset,
+                    scaleCoefficients(left.coefPerVar, right.offset, false)};
+        }
+        throw std::invalid_argument("A linear expression can't have quadratic terms.");
+    }
+
+    ParametricLinearExpression visit(const DivisionNode* node) override
+    {
+        auto left = dispatch(node->left());
+        auto right = dispatch(node->right());
+        if (!right.coefPerVar.empty())
+        {
+            throw std::invalid_argument("A linear expression can't have a variable as a dividend.");
+        }
+        return {left.offset / right.offset,
+                scaleCoefficients(left.coefPerVar, right.offset, true)};
+    }
+
+    ParametricLinearExpression visit(const EqualNode*) override
+    {
+        throw std::invalid_argument("A linear expression can't contain comparison operators.");
+    }
+
+    ParametricLinearExpression visit(const LessThanOrEqualNode*) override
+    {
+        throw std::invalid_argument("A linear expression can't contain comparison operators.");
+    }
+
+    ParametricLinearExpression visit(const GreaterThanOrEqualNode*) override
+    {
+        throw std::invalid_argument("A linear expression can't contain comparison operators.");
+    }
+
+    ParametricLinearExpression visit(const NegationNode* node) override
+    {
+        auto child = dispatch(node->child());
+        return {child.offset.negate(),
+                scaleCoefficients(child.coefPerVar, ParametricValue::literal(-1), false)};
+    }
+
+    ParametricLinearExpression visit(const VariableNode* node) override
+    {
+        return {ParametricValue::literal(0),
+                {{model_.variableIndex(node->value()), ParametricValue::literal(1)}}};
+    }
+
+    ParametricLinearExpression visit(const ParameterNode* node) override
+    {
+        return {ParametricValue::parameter(model_.parameterSlot(node->value())), {}};
+    }
+
+    ParametricLinearExpression visit(const LiteralNode* node) override
+    {
+        return {ParametricValue::literal(node->value()), {}};
+    }
+
+    ParametricLinearExpression visit(const PortFieldNode*) override
+    {
+        throw std::invalid_argument("CompileExpressionVisitor cannot visit PortFieldNodes");
+    }
+
+    ParametricLinearExpression visit(const PortFieldSumNode*) override
+    {
+        throw std::invalid_argument("CompileExpressionVisitor cannot visit PortFieldSumNodes");
+    }
+
+    ParametricLinearExpression visit(const ComponentVariableNode*) override
+    {
+        throw std::invalid_argument("CompileExpressionVisitor cannot visit ComponentVariableNodes");
+    }
+
+    ParametricLinearExpression visit(const ComponentParameterNode*) override
+    {
+        throw std::invalid_argument(
+          "CompileExpressionVisitor cannot visit ComponentParameterNodes");
+    }
+
+    CompiledModel& model_;
+};
+
+CompiledModel::CompiledModel(const Study::SystemModel::Model& model)
+{
+    for (const auto& [id, variable]: model.Variables())
+    {
+        variableIndexes_.emplace(id, static_cast<int>(variableIndexes_.size()));
+    }
+
+    CompileExpressionVisitor visitor(*this);
+    for (const auto& [id, variable]: model.Variables())
+    {
+        variables_.push_back({.id = id,
+                              .integer = variable.Type() != Study::SystemModel::ValueType::FLOAT,
+                              .lb = visitor.bound(variable.LowerBound().RootNode()),
+                              .ub = visitor.bound(variable.UpperBound().RootNode())});
+    }
+    for (const auto& [id, constraint]: model.getConstraints())
+    {
+        constraints_.push_back(visitor.constraint(id, constraint.expression().RootNode()));
+    }
+    if (!model.Objective().Empty())
+    {
+        objective_ = visitor.dispatch(model.Objective().RootNode());
+    }
+}
+
+unsigned CompiledModel::parameterSlot(const std::string& id)
+{
+    return parameterSlots_.try_emplace(id, static_cast<unsigned>(parameterSlots_.size()))
+      .first->second;
+}
+
+int CompiledModel::variableIndex(const std::string& id) const
+{
+    return variableIndexes_.at(id);
+}
+
+std::vector<double> CompiledModel::parameterValues(
+  const Study::SystemModel::Component& component) const
+{
+    std::vector<double> values(parameterSlots_.size());
+    for (const auto& [id, slot]: parameterSlots_)
+    {
+        values[slot] = component.getParameterValues().at(id);
+    }
+    return values;
+}
+
+} // namespace Antares::Optimization
@@ -19,20 +19,24 @@
  * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
  */
 
-#include <ranges>
+#include <cmath>
+#include <stdexcept>
 
-#include <antares/solver/expressions/nodes/ExpressionsNodes.h>
-#include <antares/solver/expressions/visitors/EvalVisitor.h>
 #include <antares/solver/optim-model-filler/ComponentFiller.h>
-#include <antares/solver/optim-model-filler/ReadLinearConstraintVisitor.h>
-#include <antares/study/system-model/variable.h>
 
 namespace Antares::Optimization
 {
 
 ComponentFiller::ComponentFiller(const Study::SystemModel::Component& component):
+    ComponentFiller(component, std::make_shared<CompiledModel>(*component.getModel()))
+{
+}
+
+ComponentFiller::ComponentFiller(const Study::SystemModel::Component& component,
+                                 std::shared_ptr<const CompiledModel> model):
     component_(component),
-    evaluationContext_(component_.getParameterValues(), {})
+    model_(std::move(model)),
+    parameters_(model_->parameterValues(component_))
 {
 }
 
@@ -40,55 +44,57 @@ void ComponentFiller::addVariables(Solver::Modeler::Api::ILinearProblem& pb,
                                    Solver::Modeler::Api::LinearProblemData& data,
                                    Solver::Modeler::Api::FillContext& ctx)
 {
-    auto evaluator = std::make_unique<Solver::Visitors::EvalVisitor>(evaluationContext_);
-    for (const auto& variable: component_.getModel()->Variables() | std::views::values)
+    Solver::Modeler::Api::VariableBatch batch;
+    for (const auto& variable: model_->variables())
     {
-        pb.addVariable(evaluator->dispatch(variable.LowerBound().RootNode()),
-                       evaluator->dispatch(variable.UpperBound().RootNode()),
-                       variable.Type() != Study::SystemModel::ValueType::FLOAT,
-                       component_.Id() + "." + variable.Id());
+        batch.lb.push_back(variable.lb.evaluate(parameters_));
+        batch.ub.push_back(variable.ub.evaluate(parameters_));
+        batch.integer.push_back(variable.integer);
+        batch.names.push_back(component_.Id() + "." + variable.id);
     }
+    firstVariable_ = pb.addVariables(batch);
 }
 
 void ComponentFiller::addConstraints(Solver::Modeler::Api::ILinearProblem& pb,
                                      Solver::Modeler::Api::LinearProblemData& data,
                                      Solver::Modeler::Api::FillContext& ctx)
 {
-    ReadLinearConstraintVisitor visitor(evaluationContext_);
-    for (const auto& constraint: component_.getModel()->getConstraints() | std::views::values)
+    Solver::Modeler::Api::ConstraintBatch batch;
+    batch.rowStart.push_back(0);
+    for (const auto& constraint: model_->constraints())
     {
-        auto linear_constraint = visitor.dispatch(constraint.expression().RootNode());
-        auto* ct = pb.addConstraint(linear_constraint.lb,
-                                    linear_constraint.ub,
-                                    component_.Id() + "." + constraint.Id());
-        for (auto [var_id, coef]: linear_constraint.coef_per_var)
+        batch.lb.push_back(constraint.lb.evaluate(parameters_));
+        batch.ub.push_back(constraint.ub.evaluate(parameters_));
+        batch.names.push_back(component_.Id() + "." + constraint.id);
+        for (const auto& [var, coef]: constraint.expression.coefPerVar)
         {
-            auto* variable = pb.getVariable(component_.Id() + "." + var_id);
-            ct->setCoefficient(variable, coef);
+            batch.columns.push_back(firstVariable_ + var);
+            batch.coefficients.push_back(coef.evaluate(parameters_));
         }
+        batch.rowStart.push_back(static_cast<int>(batch.columns.size()));
     }
+    pb.addConstraints(batch);
 }
 
 void ComponentFiller::addObjective(Solver::Modeler::Api::ILinearProblem& pb,
                                    Solver::Modeler::Api::LinearProblemData& data,
                                    Solver::Modeler::Api::FillContext& ctx)
 {
-    if (component_.getModel()->Objective().Empty())
+    const auto& objective = model_->objective();
+    if (!objective)
     {
         return;
     }
-    ReadLinearExpressionVisitor visitor(evaluationContext_);
-    auto linear_expression = visitor.dispatch(component_.getModel()->Objective().RootNode());
-    if (abs(linear_expression.offset()) > 1e-10)
+    if (std::abs(objective->offset.evaluate(parameters_)) > 1e-10)
     {
         throw std::invalid_argument("Antares does not support objective offsets (found in model '"
                                     + component_.getModel()->Id() + "' of component '"
                                     + component_.Id() + "').");
     }
-    for (auto [var_id, coef]: linear_expression.coefPerVar())
+    for (const auto& [var, coef]: objective->coefPerVar)
     {
-        auto* variable = pb.getVariable(component_.Id() + "." + var_id);
-        pb.setObjectiveCoefficient(variable, coef);
+        pb.setObjectiveCoefficient(pb.getVariable(firstVariable_ + var),
+                                   coef.evaluate(parameters_));
     }
 }
 
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <antares/study/system-model/component.h>
+
+namespace Antares::Optimization
+{
+/**
+ * Parametric Value
+ * Scalar expression of the parameters of a model, stored in postfix form.
+ * Parameters are referred to by slot, so that evaluating the value for a component does not
+ * visit any tree nor look up any name.
+ */
+class ParametricValue
+{
+public:
+    ParametricValue() = default;
+    static ParametricValue literal(double value);
+    static ParametricValue parameter(unsigned slot);
+
+    ParametricValue operator+(const ParametricValue& other) const;
+    ParametricValue operator-(const ParametricValue& other) const;
+    ParametricValue operator*(const ParametricValue& other) const;
+    ParametricValue operator/(const ParametricValue& other) const;
+    ParametricValue negate() const;
+
+    /// Evaluate with the parameter values of a component, indexed by slot.
+    /// Throws EvalVisitorDivisionException if a division does not give a finite number.
+    double evaluate(const std::vector<double>& parameters) const;
+
+private:
+    enum class Operation : unsigned char
+    {
+        Literal,
+        Parameter,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Negate
+    };
+
+    struct Instruction
+    {
+        Operation operation;
+        unsigned slot = 0;
+        double value = 0;
+    };
+
+    /// Deepest evaluation stack kept on the call stack of evaluate()
+    static constexpr unsigned maxLocalStackDepth = 32;
+
+    bool isLiteral() const;
+    ParametricValue combine(const ParametricValue& other, Operation operation) const;
+    double execute(const std::vector<double>& parameters, double* stack) const;
+
+    std::vector<Instruction> code_ = {{Operation::Literal}};
+    /// Size of the evaluation stack, known from the compilation
+    unsigned stackDepth_ = 1;
+};
+
+/**
+ * Parametric Linear Expression
+ * Linear expression whose offset and coefficients are parametric values.
+ * Variables are referred to by their index in the model.
+ */
+struct ParametricLinearExpression
+{
+    ParametricValue offset;
+    std::map<int, ParametricValue> coefPerVar;
+};
+
+/**
+ * Compiled Model
+ * Variables, constraints and objective of a model, read once from the expression trees and
+ * shared by all the components of this model.
+ */
+class CompiledModel
+{
+public:
+    struct Variable
+    {
+        std::string id;
+        bool integer;
+        ParametricValue lb;
+        ParametricValue ub;
+    };
+
+    struct Constraint
+    {
+        std::string id;
+        ParametricValue lb;
+        ParametricValue ub;
+        ParametricLinearExpression expression;
+    };
+
+    /// Read a model, throws std::invalid_argument if one of its expressions is not linear
+    explicit CompiledModel(const Study::SystemModel::Model& model);
+
+    const std::vector<Variable>& variables() const
+    {
+        return variables_;
+    }
+
+    const std::vector<Constraint>& constraints() const
+    {
+        return constraints_;
+    }
+
+    const std::optional<ParametricLinearExpression>& objective() const
+    {
+        return objective_;
+    }
+
+    /// Values of the parameter slots for a component, throws std::out_of_range if one is missing
+    std::vector<double> parameterValues(const Study::SystemModel::Component& component) const;
+
+private:
+    friend class CompileExpressionVisitor;
+
+    /// Slot of a parameter, allocated on first use
+    unsigned parameterSlot(const std::string& id);
+
+    /// Index of a variable in the model, throws std::out_of_range if it does not exist
+    int variableIndex(const std::string& id) const;
+
+    std::vector<Variable> variables_;
+    std::vector<Constraint> constraints_;
+    std::optional<ParametricLinearExpression> objective_;
+
+    std::map<std::string, int> variableIndexes_;
+    std::map<std::string, unsigned> parameterSlots_;
+};
+} // namespace Antares::Optimization
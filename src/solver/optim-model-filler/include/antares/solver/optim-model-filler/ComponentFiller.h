@@ -21,9 +21,12 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include <antares/solver/modeler/api/linearProblemFiller.h>
 #include <antares/study/system-model/component.h>
-#include "antares/solver/expressions/visitors/EvaluationContext.h"
+#include "antares/solver/optim-model-filler/CompiledModel.h"
 
 namespace Antares::Study::SystemModel
 {
@@ -44,6 +47,9 @@ public:
     ComponentFiller(ComponentFiller& other) = delete;
     /// Create a ComponentFiller for a Component
     explicit ComponentFiller(const Study::SystemModel::Component& component);
+    /// Create a ComponentFiller sharing the compiled model of other components of the same model
+    ComponentFiller(const Study::SystemModel::Component& component,
+                    std::shared_ptr<const CompiledModel> model);
 
     void addVariables(Solver::Modeler::Api::ILinearProblem& pb,
                       Solver::Modeler::Api::LinearProblemData& data,
@@ -57,6 +63,10 @@ public:
 
 private:
     const Study::SystemModel::Component& component_;
-    Solver::Visitors::EvaluationContext evaluationContext_;
+    std::shared_ptr<const CompiledModel> model_;
+    /// Values of the parameter slots of the model for this component
+    std::vector<double> parameters_;
+    /// Index in the problem of the first variable of the component, set by addVariables
+    int firstVariable_ = 0;
 };
 } // namespace Antares::Optimization
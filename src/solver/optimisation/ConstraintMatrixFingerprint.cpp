@@ -0,0 +1,150 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/solver/optimisation/ConstraintMatrixFingerprint.h"
+
+#include <functional>
+#include <vector>
+
+#include "antares/solver/optimisation/opt_structure_probleme_a_resoudre.h"
+#include "antares/solver/simulation/sim_structure_probleme_economique.h"
+
+namespace
+{
+template<class T>
+void combine(std::size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+template<class T>
+void combine(std::size_t& seed, const std::vector<T>& values)
+{
+    combine(seed, values.size());
+    for (const auto& value: values)
+    {
+        combine(seed, value);
+    }
+}
+
+void combine(std::size_t& seed, const std::vector<bool>& values)
+{
+    combine(seed, std::hash<std::vector<bool>>{}(values));
+}
+
+void combine(std::size_t& seed, const PALIERS_THERMIQUES& clusters)
+{
+    combine(seed, clusters.NombreDePaliersThermiques);
+    combine(seed, clusters.NumeroDuPalierDansLEnsembleDesPaliersThermiques);
+    combine(seed, clusters.pminDUnGroupeDuPalierThermique);
+    combine(seed, clusters.PmaxDUnGroupeDuPalierThermique);
+    combine(seed, clusters.DureeMinimaleDeMarcheDUnGroupeDuPalierThermique);
+    combine(seed, clusters.DureeMinimaleDArretDUnGroupeDuPalierThermique);
+}
+
+void combine(std::size_t& seed, const ENERGIES_ET_PUISSANCES_HYDRAULIQUES& hydro)
+{
+    combine(seed, hydro.PresenceDHydrauliqueModulable);
+    combine(seed, hydro.PresenceDePompageModulable);
+    combine(seed, hydro.TurbinageEntreBornes);
+    combine(seed, hydro.SuiviNiveauHoraire);
+    combine(seed, hydro.DirectLevelAccess);
+    combine(seed, hydro.AccurateWaterValue);
+    combine(seed, hydro.PumpingRatio);
+}
+
+void combine(std::size_t& seed, const CONTRAINTES_COUPLANTES& constraint)
+{
+    combine(seed, constraint.TypeDeContrainteCouplante);
+    combine(seed, constraint.SensDeLaContrainteCouplante);
+    combine(seed, constraint.NombreDInterconnexionsDansLaContrainteCouplante);
+    combine(seed, constraint.PoidsDeLInterconnexion);
+    combine(seed, constraint.NumeroDeLInterconnexion);
+    combine(seed, constraint.OffsetTemporelSurLInterco);
+    combine(seed, constraint.NombreDePaliersDispatchDansLaContrainteCouplante);
+    combine(seed, constraint.PoidsDuPalierDispatch);
+    combine(seed, constraint.PaysDuPalierDispatch);
+    combine(seed, constraint.NumeroDuPalierDispatch);
+    combine(seed, constraint.OffsetTemporelSurLePalierDispatch);
+}
+
+void combine(std::size_t& seed, const ::ShortTermStorage::PROPERTIES& storage)
+{
+    combine(seed, storage.clusterGlobalIndex);
+    combine(seed, storage.injectionEfficiency);
+    combine(seed, storage.withdrawalEfficiency);
+    combine(seed, storage.additionalConstraints.size());
+    for (const auto& additionalConstraints: storage.additionalConstraints)
+    {
+        combine(seed, additionalConstraints.variable);
+        combine(seed, additionalConstraints.operatorType);
+        for (const auto& constraint: additionalConstraints.constraints)
+        {
+            combine(seed, constraint.globalIndex);
+            for (const auto& hour: constraint.hours)
+            {
+                combine(seed, hour);
+            }
+        }
+    }
+}
+} // namespace
+
+std::size_t ConstraintMatrixFingerprint(const PROBLEME_HEBDO& problemeHebdo)
+{
+    std::size_t seed = 0;
+
+    combine(seed, problemeHebdo.ProblemeAResoudre->NombreDeVariables);
+    combine(seed, problemeHebdo.NombreDePasDeTemps);
+    combine(seed, problemeHebdo.NombreDePasDeTempsPourUneOptimisation);
+    combine(seed, problemeHebdo.NumeroDeJourDuPasDeTemps);
+    combine(seed, problemeHebdo.OptimisationAvecCoutsDeDemarrage);
+    combine(seed, problemeHebdo.TypeDeLissageHydraulique);
+
+    combine(seed, problemeHebdo.NombreDePays);
+    combine(seed, problemeHebdo.DefaillanceNegativeUtiliserHydro);
+    for (uint32_t pays = 0; pays < problemeHebdo.NombreDePays; pays++)
+    {
+        combine(seed, problemeHebdo.PaliersThermiquesDuPays[pays]);
+        combine(seed, problemeHebdo.CaracteristiquesHydrauliques[pays]);
+        combine(seed, problemeHebdo.ShortTermStorage[pays].size());
+        for (const auto& storage: problemeHebdo.ShortTermStorage[pays])
+        {
+            combine(seed, storage);
+        }
+    }
+
+    combine(seed, problemeHebdo.NombreDInterconnexions);
+    combine(seed, problemeHebdo.PaysOrigineDeLInterconnexion);
+    combine(seed, problemeHebdo.PaysExtremiteDeLInterconnexion);
+    for (const auto& transportCost: problemeHebdo.CoutDeTransport)
+    {
+        combine(seed, transportCost.IntercoGereeAvecDesCouts);
+    }
+
+    combine(seed, problemeHebdo.NombreDeContraintesCouplantes);
+    for (const auto& constraint: problemeHebdo.MatriceDesContraintesCouplantes)
+    {
+        combine(seed, constraint);
+    }
+
+    return seed;
+}
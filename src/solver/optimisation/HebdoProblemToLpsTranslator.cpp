@@ -65,8 +65,8 @@ WeeklyDataFromAntares HebdoProblemToLpsTranslator::translate(
     copy(problem->CoutLineaire, ret.LinearCost);
     copy(problem->Xmax, ret.Xmax);
     copy(problem->Xmin, ret.Xmin);
-    copy(problem->NomDesVariables, ret.variables);
-    copy(problem->NomDesContraintes, ret.constraints);
+    copy(problem->NomDesVariables.materialize(), ret.variables);
+    copy(problem->NomDesContraintes.materialize(), ret.constraints);
     copy(problem->SecondMembre, ret.RHS);
     copy(problem->Sens, ret.Direction);
 
@@ -75,6 +75,25 @@ WeeklyDataFromAntares HebdoProblemToLpsTranslator::translate(
     return ret;
 }
 
+WeeklySolutionFromAntares HebdoProblemToLpsTranslator::translateSolution(
+  const PROBLEME_ANTARES_A_RESOUDRE* problem,
+  std::string_view name) const
+{
+    if (problem == nullptr)
+    {
+        return {};
+    }
+    auto ret = WeeklySolutionFromAntares();
+
+    copy(problem->X, ret.X);
+    copy(problem->CoutsReduits, ret.ReducedCosts);
+    copy(problem->CoutsMarginauxDesContraintes, ret.MarginalCosts);
+
+    copy(name, ret.name);
+
+    return ret;
+}
+
 ConstantDataFromAntares HebdoProblemToLpsTranslator::commonProblemData(
   const PROBLEME_ANTARES_A_RESOUDRE* problem) const
 {
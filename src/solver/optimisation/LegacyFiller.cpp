@@ -99,21 +99,30 @@ void LegacyFiller::CopyRows(ILinearProblem& pb) const
 
 std::string LegacyFiller::GetVariableName(unsigned int index) const
 {
-    if (!problemeSimplexe_->UseNamedProblems()
-        || problemeSimplexe_->VariableNames().at(index).empty())
+    if (!problemeSimplexe_->UseNamedProblems())
     {
         return 'x' + std::to_string(index);
     }
-    return problemeSimplexe_->VariableNames().at(index);
+    // Names are built on demand from the descriptors of the problem
+    auto name = problemeSimplexe_->VariableNames().at(index);
+    if (name.empty())
+    {
+        return 'x' + std::to_string(index);
+    }
+    return name;
 }
 
 std::string LegacyFiller::GetConstraintName(unsigned int index) const
 {
-    if (!problemeSimplexe_->UseNamedProblems()
-        || problemeSimplexe_->ConstraintNames().at(index).empty())
+    if (!problemeSimplexe_->UseNamedProblems())
+    {
+        return 'c' + std::to_string(index);
+    }
+    auto name = problemeSimplexe_->ConstraintNames().at(index);
+    if (name.empty())
     {
         return 'c' + std::to_string(index);
     }
-    return problemeSimplexe_->ConstraintNames().at(index);
+    return name;
 }
 } // namespace Antares::Optimization
@@ -23,9 +23,13 @@
 
 #include <cmath>
 
+#include <antares/concurrency/concurrency.h>
+
 #include "antares/solver/optimisation/adequacy_patch_csr/count_constraints_variables.h"
 #include "antares/solver/optimisation/adequacy_patch_csr/csr_quadratic_problem.h"
+#include "antares/solver/optimisation/opt_fonctions.h"
 #include "antares/solver/simulation/adequacy_patch_runtime_data.h"
+#include "antares/solver/simulation/sim_structure_probleme_economique.h"
 
 #include "solve_problem.h"
 
@@ -198,18 +202,78 @@ void HourlyCSRProblem::setProblemCost()
     }
 }
 
-void HourlyCSRProblem::solveProblem(uint week, int year)
-{
-    ADQ_PATCH_CSR(problemeAResoudre_, *this, adqPatchParams_, week, year);
-}
-
-void HourlyCSRProblem::run(uint week, uint year)
+void HourlyCSRProblem::prepareHour()
 {
     calculateCsrParameters();
+    // The variables have the same numbers whatever the hour, only the hour they are mapped to
+    // changes : the constraint matrix doesn't have to be rebuilt
     buildProblemVariables();
-    buildProblemConstraintsLHS();
+    if (!constraintMatrixBuilt_)
+    {
+        buildProblemConstraintsLHS();
+        constraintMatrixBuilt_ = true;
+    }
     setVariableBounds();
     buildProblemConstraintsRHS();
     setProblemCost();
-    solveProblem(week, year);
+}
+
+void HourlyCSRProblem::run(const std::set<int>& hours, uint week, uint year)
+{
+    const std::vector<int> hourList(hours.begin(), hours.end());
+    const size_t nbHours = hourList.size();
+
+    auto& hoursData = problemeAResoudre_.ProblemesDesIntervalles;
+    if (hoursData.size() < nbHours)
+    {
+        hoursData.resize(nbHours);
+    }
+
+    // Building the problems writes to problemeHebdo_ and to the adequacy patch runtime data :
+    // it is done sequentially
+    for (size_t i = 0; i < nbHours; ++i)
+    {
+        setHour(hourList[i]);
+        prepareHour();
+
+        auto& hourData = hoursData[i];
+        if (!hourData)
+        {
+            hourData = std::make_unique<PROBLEME_ANTARES_A_RESOUDRE>();
+        }
+        OPT_CopierLesDonneesDeLIntervalle(problemeAResoudre_, *hourData);
+    }
+
+    std::vector<CsrResolution> resolutions(nbHours);
+    auto solve = [this, &hoursData, &resolutions](size_t i)
+    { resolutions[i] = ADQ_PATCH_CSR(*this, *hoursData[i], adqPatchParams_); };
+
+    if (problemeHebdo_->parallelCsrHours && problemeHebdo_->threadPool && nbHours > 1)
+    {
+        Antares::Concurrency::FutureSet results;
+        for (size_t i = 0; i < nbHours; ++i)
+        {
+            Antares::Concurrency::Task task = [&solve, i]() { solve(i); };
+            results.add(Antares::Concurrency::AddTask(*problemeHebdo_->threadPool, task));
+        }
+        results.join();
+    }
+    else
+    {
+        for (size_t i = 0; i < nbHours; ++i)
+        {
+            solve(i);
+        }
+    }
+
+    for (size_t i = 0; i < nbHours; ++i)
+    {
+        ADQ_PATCH_CSR_StoreResults(*this,
+                                   *hoursData[i],
+                                   resolutions[i],
+                                   adqPatchParams_,
+                                   hourList[i],
+                                   week,
+                                   year);
+    }
 }
@@ -24,6 +24,8 @@
 #include "antares/solver/simulation/sim_structure_probleme_economique.h"
 #include "antares/solver/simulation/simulation.h"
 
+#include "solve_problem.h"
+
 /*
  pi_define.h doesn't include this header, yet it uses struct jmp_buf.
  It would be nice to remove this include, but would require to change pi_define.h,
@@ -42,21 +44,24 @@ extern "C"
 
 using namespace Antares;
 
+// The constraint matrix, shared by all hours, is read from ProblemeAResoudre, and everything else
+// from HourData
 std::unique_ptr<PROBLEME_POINT_INTERIEUR> buildInteriorPointProblem(
-  PROBLEME_ANTARES_A_RESOUDRE& ProblemeAResoudre)
+  PROBLEME_ANTARES_A_RESOUDRE& ProblemeAResoudre,
+  PROBLEME_ANTARES_A_RESOUDRE& HourData)
 {
     auto Probleme = std::make_unique<PROBLEME_POINT_INTERIEUR>();
 
     Probleme->NombreMaxDIterations = -1;
-    Probleme->CoutQuadratique = ProblemeAResoudre.CoutQuadratique.data();
-    Probleme->CoutLineaire = ProblemeAResoudre.CoutLineaire.data();
-    Probleme->X = ProblemeAResoudre.X.data();
-    Probleme->Xmin = ProblemeAResoudre.Xmin.data();
-    Probleme->Xmax = ProblemeAResoudre.Xmax.data();
-    Probleme->NombreDeVariables = ProblemeAResoudre.NombreDeVariables;
-    Probleme->TypeDeVariable = ProblemeAResoudre.TypeDeVariable.data();
+    Probleme->CoutQuadratique = HourData.CoutQuadratique.data();
+    Probleme->CoutLineaire = HourData.CoutLineaire.data();
+    Probleme->X = HourData.X.data();
+    Probleme->Xmin = HourData.Xmin.data();
+    Probleme->Xmax = HourData.Xmax.data();
+    Probleme->NombreDeVariables = HourData.NombreDeVariables;
+    Probleme->TypeDeVariable = HourData.TypeDeVariable.data();
 
-    Probleme->VariableBinaire = (char*)ProblemeAResoudre.CoutsReduits.data();
+    Probleme->VariableBinaire = (char*)HourData.CoutsReduits.data();
 
     Probleme->NombreDeContraintes = ProblemeAResoudre.NombreDeContraintes;
     Probleme->IndicesDebutDeLigne = ProblemeAResoudre.IndicesDebutDeLigne.data();
@@ -66,7 +71,7 @@ std::unique_ptr<PROBLEME_POINT_INTERIEUR> buildInteriorPointProblem(
                                                         .CoefficientsDeLaMatriceDesContraintes
                                                         .data();
     Probleme->Sens = ProblemeAResoudre.Sens.data();
-    Probleme->SecondMembre = ProblemeAResoudre.SecondMembre.data();
+    Probleme->SecondMembre = HourData.SecondMembre.data();
 
     Probleme->AffichageDesTraces = NON_PI;
 
@@ -74,16 +79,16 @@ std::unique_ptr<PROBLEME_POINT_INTERIEUR> buildInteriorPointProblem(
     Probleme->UtiliserLaToleranceDeStationnariteParDefaut = OUI_PI;
     Probleme->UtiliserLaToleranceDeComplementariteParDefaut = OUI_PI;
 
-    Probleme->CoutsMarginauxDesContraintes = ProblemeAResoudre.CoutsMarginauxDesContraintes.data();
+    Probleme->CoutsMarginauxDesContraintes = HourData.CoutsMarginauxDesContraintes.data();
 
-    Probleme->CoutsMarginauxDesContraintesDeBorneInf = ProblemeAResoudre.CoutsReduits.data();
-    Probleme->CoutsMarginauxDesContraintesDeBorneSup = ProblemeAResoudre.CoutsReduits.data();
+    Probleme->CoutsMarginauxDesContraintesDeBorneInf = HourData.CoutsReduits.data();
+    Probleme->CoutsMarginauxDesContraintesDeBorneSup = HourData.CoutsReduits.data();
 
     return Probleme;
 }
 
 void setToZeroIfBelowThreshold(PROBLEME_ANTARES_A_RESOUDRE& ProblemeAResoudre,
-                               HourlyCSRProblem& hourlyCsrProblem)
+                               const HourlyCSRProblem& hourlyCsrProblem)
 {
     for (int var = 0; var < ProblemeAResoudre.NombreDeVariables; var++)
     {
@@ -111,8 +116,8 @@ void storeInteriorPointResults(const PROBLEME_ANTARES_A_RESOUDRE& ProblemeAResou
 }
 
 void storeOrDisregardInteriorPointResults(const PROBLEME_ANTARES_A_RESOUDRE& ProblemeAResoudre,
-                                          const HourlyCSRProblem& hourlyCsrProblem,
                                           const AdqPatchParams& adqPatchParams,
+                                          int hour,
                                           uint weekNb,
                                           int yearNb,
                                           double costPriorToCsr,
@@ -138,7 +143,7 @@ void storeOrDisregardInteriorPointResults(const PROBLEME_ANTARES_A_RESOUDRE& Pro
         logs.warning()
           << "[adq-patch] CSR optimization is providing solution with greater costs, optimum "
              "solution is set as LMR . year: "
-          << yearNb + 1 << ". hour: " << weekNb * hoursInWeek + hourlyCsrProblem.triggeredHour + 1;
+          << yearNb + 1 << ". hour: " << weekNb * hoursInWeek + hour + 1;
     }
 }
 
@@ -253,38 +258,50 @@ void handleInteriorPointError([[maybe_unused]] const PROBLEME_POINT_INTERIEUR& P
 #endif
 }
 
-bool ADQ_PATCH_CSR(PROBLEME_ANTARES_A_RESOUDRE& ProblemeAResoudre,
-                   HourlyCSRProblem& hourlyCsrProblem,
-                   const AdqPatchParams& adqPatchParams,
-                   uint weekNb,
-                   int yearNb)
+CsrResolution ADQ_PATCH_CSR(HourlyCSRProblem& hourlyCsrProblem,
+                            PROBLEME_ANTARES_A_RESOUDRE& hourData,
+                            const AdqPatchParams& adqPatchParams)
 {
-    auto interiorPointProblem = buildInteriorPointProblem(ProblemeAResoudre);
-    double costPriorToCsr = calculateCSRcost(*interiorPointProblem,
-                                             hourlyCsrProblem,
-                                             adqPatchParams);
+    CsrResolution resolution;
+    auto interiorPointProblem = buildInteriorPointProblem(hourlyCsrProblem.problemeAResoudre_,
+                                                          hourData);
+    resolution.costPriorToCsr = calculateCSRcost(*interiorPointProblem,
+                                                 hourlyCsrProblem,
+                                                 adqPatchParams);
     PI_Quamin(interiorPointProblem.get()); // resolution
-    if (interiorPointProblem->ExistenceDUneSolution == OUI_PI)
+    resolution.solved = interiorPointProblem->ExistenceDUneSolution == OUI_PI;
+    if (resolution.solved)
+    {
+        setToZeroIfBelowThreshold(hourData, hourlyCsrProblem);
+        resolution.costAfterCsr = calculateCSRcost(*interiorPointProblem,
+                                                   hourlyCsrProblem,
+                                                   adqPatchParams);
+    }
+    return resolution;
+}
+
+void ADQ_PATCH_CSR_StoreResults(HourlyCSRProblem& hourlyCsrProblem,
+                                PROBLEME_ANTARES_A_RESOUDRE& hourData,
+                                const CsrResolution& resolution,
+                                const AdqPatchParams& adqPatchParams,
+                                int hour,
+                                uint weekNb,
+                                int yearNb)
+{
+    if (resolution.solved)
     {
-        setToZeroIfBelowThreshold(ProblemeAResoudre, hourlyCsrProblem);
-        double costAfterCsr = calculateCSRcost(*interiorPointProblem,
-                                               hourlyCsrProblem,
-                                               adqPatchParams);
-        storeOrDisregardInteriorPointResults(ProblemeAResoudre,
-                                             hourlyCsrProblem,
+        storeOrDisregardInteriorPointResults(hourData,
                                              adqPatchParams,
+                                             hour,
                                              weekNb,
                                              yearNb,
-                                             costPriorToCsr,
-                                             costAfterCsr);
-        return true;
+                                             resolution.costPriorToCsr,
+                                             resolution.costAfterCsr);
     }
     else
     {
-        handleInteriorPointError(*interiorPointProblem,
-                                 hourlyCsrProblem.triggeredHour,
-                                 weekNb,
-                                 yearNb);
-        return false;
+        auto interiorPointProblem = buildInteriorPointProblem(hourlyCsrProblem.problemeAResoudre_,
+                                                              hourData);
+        handleInteriorPointError(*interiorPointProblem, hour, weekNb, yearNb);
     }
 }
@@ -1,4 +1,3 @@
-
 #pragma once
 
 #include "antares/solver/optimisation/adequacy_patch_csr/hourly_csr_problem.h"
@@ -7,8 +6,24 @@
 
 using namespace Antares::Data::AdequacyPatch;
 
-bool ADQ_PATCH_CSR(PROBLEME_ANTARES_A_RESOUDRE&,
-                   HourlyCSRProblem&,
-                   const AdqPatchParams&,
-                   unsigned int week,
-                   int year);
+struct CsrResolution
+{
+    bool solved = false;
+    double costPriorToCsr = 0.;
+    double costAfterCsr = 0.;
+};
+
+// The constraint matrix is the one of the HourlyCSRProblem, bounds, costs and right-hand sides are
+// read from the hour data, and the solution is written to it : hours can be solved concurrently.
+CsrResolution ADQ_PATCH_CSR(HourlyCSRProblem&,
+                            PROBLEME_ANTARES_A_RESOUDRE& hourData,
+                            const AdqPatchParams&);
+
+// Store the solution of an hour in the weekly results, unless it is disregarded
+void ADQ_PATCH_CSR_StoreResults(HourlyCSRProblem&,
+                                PROBLEME_ANTARES_A_RESOUDRE& hourData,
+                                const CsrResolution&,
+                                const AdqPatchParams&,
+                                int hour,
+                                unsigned int week,
+                                int year);
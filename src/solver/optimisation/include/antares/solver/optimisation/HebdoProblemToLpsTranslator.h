@@ -65,6 +65,20 @@ public:
     [[nodiscard]] WeeklyDataFromAntares translate(const PROBLEME_ANTARES_A_RESOUDRE* problem,
                                                   std::string_view name) const;
 
+    /**
+     * @brief Translates the solution of a weekly problem, once it has been solved.
+     *
+     * The primal values, the reduced costs of the variables and the marginal costs of the
+     * constraints are copied.
+     *
+     * @param problem A pointer to the solved weekly problem.
+     * @param name The name of the problem.
+     * @return WeeklySolutionFromAntares The translated solution.
+     */
+    [[nodiscard]] WeeklySolutionFromAntares translateSolution(
+      const PROBLEME_ANTARES_A_RESOUDRE* problem,
+      std::string_view name) const;
+
     /**
      * @brief Retrieves common problem data, the part common to every weekly problems
      *
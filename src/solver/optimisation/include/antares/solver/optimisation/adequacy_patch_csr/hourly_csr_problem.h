@@ -92,17 +92,26 @@ public:
         triggeredHour = hour;
     }
 
-    void run(uint week, uint year);
+    /*!
+    ** \brief Solve the curtailment sharing problems of some hours of a week
+    **
+    ** The constraint matrix doesn't depend on the hour, it is built the first time only.
+    ** The problems of the hours are solved concurrently on the thread pool of problemeHebdo
+    ** if parallelCsrHours is set, their results are stored in the order of the hours.
+    */
+    void run(const std::set<int>& hours, uint week, uint year);
 
 private:
     void calculateCsrParameters();
 
+    // Bounds, right-hand sides and costs of the triggered hour
+    void prepareHour();
+
     void buildProblemVariables();
     void setVariableBounds();
     void buildProblemConstraintsLHS();
     void buildProblemConstraintsRHS();
     void setProblemCost();
-    void solveProblem(uint week, int year);
     void allocateProblem();
 
     // variable construction
@@ -145,6 +154,8 @@ public:
 
     std::map<int, double> rhsAreaBalanceValues;
 
+    bool constraintMatrixBuilt_ = false;
+
     // links between two areas inside the adq-patch domain
     std::map<int, LinkVariable> linkInsideAdqPatch;
 };
@@ -74,6 +74,35 @@ bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
                          const int,
                          const OptPeriodStringGenerator&,
                          Antares::Solver::IResultWriter& writer);
+
+/*!
+** \brief Resolution du probleme d'un intervalle d'optimisation
+**
+** Same as OPT_AppelDuSimplexe, without reporting the solution to the weekly problem: the bounds,
+** costs and right-hand sides are read from `interval`, and the solution is written to it.
+** The constraint matrix and the solver are the ones of problemeHebdo->ProblemeAResoudre, so that
+** intervals can be solved concurrently, each with its own `interval`.
+**
+** \return True si l'operation s'est bien deroulee, false si le probleme n'a pas de solution
+*/
+bool OPT_ResoudreLeProblemeDeLIntervalle(const OptimizationOptions& options,
+                                         PROBLEME_HEBDO* problemeHebdo,
+                                         PROBLEME_ANTARES_A_RESOUDRE& interval,
+                                         int NumIntervalle,
+                                         const int optimizationNumber,
+                                         const OptPeriodStringGenerator&,
+                                         Antares::Solver::IResultWriter& writer,
+                                         TIME_MEASURE& timeMeasure);
+
+/*!
+** \brief Recuperation des resultats d'un intervalle d'optimisation
+**
+** The solution of the interval is read from problemeHebdo->ProblemeAResoudre.
+*/
+void OPT_RecupererLesResultatsDeLIntervalle(PROBLEME_HEBDO* problemeHebdo,
+                                            int NumIntervalle,
+                                            const int optimizationNumber,
+                                            const TIME_MEASURE& timeMeasure);
 void OPT_LiberationProblemesSimplexe(const PROBLEME_HEBDO*);
 
 bool OPT_OptimisationLineaire(const OptimizationOptions& options,
@@ -89,6 +118,15 @@ double OPT_CalculerAireMaxPminJour(int, int, int, int, std::vector<int>&, std::v
 void OPT_ChainagesDesIntercoPartantDUnNoeud(PROBLEME_HEBDO*);
 
 void OPT_AllocateFromNumberOfVariableConstraints(PROBLEME_ANTARES_A_RESOUDRE* ProblemeAResoudre);
+
+/*!
+** \brief Copie des donnees propres a un intervalle d'optimisation
+**
+** Bounds, costs, right-hand sides, where to put the results, and the results themselves : what
+** differs between two problems sharing the same constraint matrix.
+*/
+void OPT_CopierLesDonneesDeLIntervalle(const PROBLEME_ANTARES_A_RESOUDRE& from,
+                                       PROBLEME_ANTARES_A_RESOUDRE& to);
 void OPT_AllocDuProblemeAOptimiser(PROBLEME_HEBDO*);
 int OPT_DecompteDesVariablesEtDesContraintesDuProblemeAOptimiser(PROBLEME_HEBDO*);
 
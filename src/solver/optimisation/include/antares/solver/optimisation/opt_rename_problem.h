@@ -19,35 +19,26 @@
 ** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
 */
 #pragma once
-#include "antares/solver/optimisation/opt_structure_probleme_a_resoudre.h"
-
-#include "opt_export_structure.h"
-
-const std::string SEPARATOR = "::";
-const std::string AREA_SEP = "$$";
 
-class TargetVectorUpdater
-{
-public:
-    explicit TargetVectorUpdater(std::vector<std::string>& target):
-        target_(target)
-    {
-    }
+#include <string_view>
 
-    void UpdateTargetAtIndex(const std::string& full_name, unsigned int index)
-    {
-        target_[index] = full_name;
-    }
+#include "antares/solver/optimisation/opt_structure_probleme_a_resoudre.h"
 
-private:
-    std::vector<std::string>& target_;
-};
+#include "opt_export_structure.h"
 
+/*!
+** \brief Base class of the namers of variables and constraints
+**
+** Names are not built here: each element only gets a descriptor in the target LpNames,
+** the actual string being built when somebody asks for it.
+*/
 class Namer
 {
 public:
-    explicit Namer(std::vector<std::string>& target):
-        targetUpdater_(target)
+    using LpNames = Antares::Optimization::LpNames;
+
+    explicit Namer(LpNames& target):
+        target_(target)
     {
     }
 
@@ -56,53 +47,62 @@ public:
         timeStep_ = timeStep;
     }
 
-    void UpdateArea(const std::string& area)
+    void UpdateArea(std::string_view area)
     {
-        area_ = area;
+        area_ = target_.label(area);
     }
 
-    void SetLinkElementName(unsigned int variable, const std::string& variableType);
-    void SetAreaElementNameHour(unsigned int variable, const std::string& variableType);
-    void SetAreaElementNameWeek(unsigned int variable, const std::string& variableType);
-    void SetAreaElementName(unsigned int variable,
-                            const std::string& variableType,
-                            const std::string& timeStepType);
-    void SetThermalClusterElementName(unsigned int variable,
-                                      const std::string& variableType,
-                                      const std::string& clusterName);
+    void SetLinkElementName(unsigned int element,
+                            std::string_view elementType,
+                            std::string_view origin,
+                            std::string_view destination);
+    void SetAreaElementNameHour(unsigned int element, std::string_view elementType);
+    void SetAreaElementNameWeek(unsigned int element, std::string_view elementType);
+    void SetAreaElementName(unsigned int element,
+                            std::string_view elementType,
+                            LpNames::TimeStep timeStepType);
+    void SetThermalClusterElementName(unsigned int element,
+                                      std::string_view elementType,
+                                      std::string_view clusterName);
+    void SetShortTermStorageElementName(unsigned int element,
+                                        std::string_view elementType,
+                                        std::string_view shortTermStorageName);
+
+protected:
+    void set(unsigned int element,
+             std::string_view elementType,
+             LpNames::Location location,
+             uint32_t second = 0,
+             LpNames::TimeStep timeStepType = LpNames::TimeStep::Hour);
 
     unsigned int timeStep_ = 0;
-    std::string origin_;
-    std::string destination_;
-    std::string area_;
-    TargetVectorUpdater targetUpdater_;
+    LpNames::LabelId area_ = 0;
+    LpNames& target_;
 };
 
 class VariableNamer: public Namer
 {
 public:
     using Namer::Namer;
-    void DispatchableProduction(unsigned int variable, const std::string& clusterName);
-    void NODU(unsigned int variable, const std::string& clusterName);
-    void NumberStoppingDispatchableUnits(unsigned int variable, const std::string& clusterName);
-    void NumberStartingDispatchableUnits(unsigned int variable, const std::string& clusterName);
-    void NumberBreakingDownDispatchableUnits(unsigned int variable, const std::string& clusterName);
-    void NTCDirect(unsigned int variable,
-                   const std::string& origin,
-                   const std::string& destination);
+    void DispatchableProduction(unsigned int variable, std::string_view clusterName);
+    void NODU(unsigned int variable, std::string_view clusterName);
+    void NumberStoppingDispatchableUnits(unsigned int variable, std::string_view clusterName);
+    void NumberStartingDispatchableUnits(unsigned int variable, std::string_view clusterName);
+    void NumberBreakingDownDispatchableUnits(unsigned int variable, std::string_view clusterName);
+    void NTCDirect(unsigned int variable, std::string_view origin, std::string_view destination);
     void IntercoDirectCost(unsigned int variable,
-                           const std::string& origin,
-                           const std::string& destination);
+                           std::string_view origin,
+                           std::string_view destination);
     void IntercoIndirectCost(unsigned int variable,
-                             const std::string& origin,
-                             const std::string& destination);
-    void ShortTermStorageInjection(unsigned int variable, const std::string& shortTermStorageName);
-    void ShortTermStorageWithdrawal(unsigned int variable, const std::string& shortTermStorageName);
-    void ShortTermStorageLevel(unsigned int variable, const std::string& shortTermStorageName);
+                             std::string_view origin,
+                             std::string_view destination);
+    void ShortTermStorageInjection(unsigned int variable, std::string_view shortTermStorageName);
+    void ShortTermStorageWithdrawal(unsigned int variable, std::string_view shortTermStorageName);
+    void ShortTermStorageLevel(unsigned int variable, std::string_view shortTermStorageName);
     void ShortTermStorageCostVariationInjection(unsigned int variable,
-                                                const std::string& shortTermStorageName);
+                                                std::string_view shortTermStorageName);
     void ShortTermStorageCostVariationWithdrawal(unsigned int variable,
-                                                 const std::string& shortTermStorageName);
+                                                 std::string_view shortTermStorageName);
     void HydProd(unsigned int variable);
     void HydProdDown(unsigned int variable);
     void HydProdUp(unsigned int variable);
@@ -114,14 +114,6 @@ public:
     void PositiveUnsuppliedEnergy(unsigned int variable);
     void NegativeUnsuppliedEnergy(unsigned int variable);
     void AreaBalance(unsigned int variable);
-
-private:
-    void SetAreaVariableName(unsigned int variable,
-                             const std::string& variableType,
-                             int layerIndex);
-    void SetShortTermStorageVariableName(unsigned int variable,
-                                         const std::string& variableType,
-                                         const std::string& shortTermStorageName);
 };
 
 class ConstraintNamer: public Namer
@@ -130,8 +122,8 @@ public:
     using Namer::Namer;
 
     void FlowDissociation(unsigned int constraint,
-                          const std::string& origin,
-                          const std::string& destination);
+                          std::string_view origin,
+                          std::string_view destination);
 
     void AreaBalance(unsigned int constraint);
     void FictiveLoads(unsigned int constraint);
@@ -145,49 +137,34 @@ public:
     void AreaHydroLevel(unsigned int constraint);
     void FinalStockEquivalent(unsigned int constraint);
     void FinalStockExpression(unsigned int constraint);
-    void NbUnitsOutageLessThanNbUnitsStop(unsigned int constraint, const std::string& clusterName);
-    void NbDispUnitsMinBoundSinceMinUpTime(unsigned int constraint, const std::string& clusterName);
-    void MinDownTime(unsigned int constraint, const std::string& clusterName);
-    void PMaxDispatchableGeneration(unsigned int constraint, const std::string& clusterName);
-    void PMinDispatchableGeneration(unsigned int constraint, const std::string& clusterName);
-    void ConsistenceNODU(unsigned int constraint, const std::string& clusterName);
-    void ShortTermStorageLevel(unsigned int constraint, const std::string& name);
-    void BindingConstraintHour(unsigned int constraint, const std::string& name);
-    void BindingConstraintDay(unsigned int constraint, const std::string& name);
-    void BindingConstraintWeek(unsigned int constraint, const std::string& name);
+    void NbUnitsOutageLessThanNbUnitsStop(unsigned int constraint, std::string_view clusterName);
+    void NbDispUnitsMinBoundSinceMinUpTime(unsigned int constraint, std::string_view clusterName);
+    void MinDownTime(unsigned int constraint, std::string_view clusterName);
+    void PMaxDispatchableGeneration(unsigned int constraint, std::string_view clusterName);
+    void PMinDispatchableGeneration(unsigned int constraint, std::string_view clusterName);
+    void ConsistenceNODU(unsigned int constraint, std::string_view clusterName);
+    void ShortTermStorageLevel(unsigned int constraint, std::string_view name);
+    void BindingConstraintHour(unsigned int constraint, std::string_view name);
+    void BindingConstraintDay(unsigned int constraint, std::string_view name);
+    void BindingConstraintWeek(unsigned int constraint, std::string_view name);
     void CsrFlowDissociation(unsigned int constraint,
-                             const std::string& origin,
-                             const std::string& destination);
+                             std::string_view origin,
+                             std::string_view destination);
 
     void CsrAreaBalance(unsigned int constraint);
-    void CsrBindingConstraintHour(unsigned int constraint, const std::string& name);
+    void CsrBindingConstraintHour(unsigned int constraint, std::string_view name);
 
-    void ShortTermStorageCostVariation(const std::string& constraint_name,
+    void ShortTermStorageCostVariation(std::string_view constraint_name,
                                        unsigned int constraint,
-                                       const std::string& short_term_name);
+                                       std::string_view short_term_name);
 
-    void ShortTermStorageCumulation(const std::string& constraint_type,
+    void ShortTermStorageCumulation(std::string_view constraint_type,
                                     unsigned int constraint,
-                                    const std::string& short_term_name,
-                                    const std::string& constraint_name);
+                                    std::string_view short_term_name,
+                                    std::string_view constraint_name);
 
 private:
     void nameWithTimeGranularity(unsigned int constraint,
-                                 const std::string& name,
-                                 const std::string& type);
+                                 std::string_view name,
+                                 LpNames::TimeStep timeStepType);
 };
-
-inline std::string TimeIdentifier(unsigned int timeStep, const std::string& timeStepType)
-{
-    return timeStepType + "<" + std::to_string(timeStep) + ">";
-}
-
-inline std::string ShortTermStorageCumulationIdentifier(const std::string& name)
-{
-    return "Constraint<" + name + ">";
-}
-
-inline std::string LocationIdentifier(const std::string& location, const std::string& locationType)
-{
-    return locationType + "<" + location + ">";
-}
@@ -21,11 +21,15 @@
 #ifndef __SOLVER_OPTIMISATION_STRUCTURE_PROBLEME_A_RESOUDRE_H__
 #define __SOLVER_OPTIMISATION_STRUCTURE_PROBLEME_A_RESOUDRE_H__
 
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <antares/solver/utils/basis_status.h>
+#include <antares/solver/utils/lp_names.h>
 
 #include "SparseVector.hxx"
 #include "opt_constants.h"
@@ -102,13 +106,28 @@ struct PROBLEME_ANTARES_A_RESOUDRE
     std::vector<int> Colonne;
 
     /* Nommage des variables & contraintes */
-    std::vector<std::string> NomDesVariables;
-    std::vector<std::string> NomDesContraintes;
+    Antares::Optimization::LpNames NomDesVariables;
+    Antares::Optimization::LpNames NomDesContraintes;
 
     std::vector<bool> VariablesEntieres; // true = int, false = continuous
 
     // PIMPL is used to break dependency to OR-Tools' linear_solver.h (big header)
     Antares::Optimization::BasisStatus basisStatus;
+
+    // Optimal bases found in previous MC years, by (week, interval, optimization number).
+    // Only filled when warm-starting across MC years (see OptimizationOptions).
+    std::map<std::tuple<unsigned int, int, int>, Antares::Optimization::BasisStatus>
+      basisOfPreviousYears;
+
+    // Fingerprint of the inputs the constraint matrix was last built from.
+    // Only set when reusing the constraint matrix across weeks (see OptimizationOptions).
+    std::optional<std::size_t> constraintMatrixFingerprint;
+
+    // Bounds, costs, right-hand sides and results of each problem sharing the constraint matrix of
+    // this one, when they are solved in parallel (daily problems of a week, hourly curtailment
+    // sharing problems). The constraint matrix, the names and the solvers are the ones of this
+    // problem.
+    std::vector<std::unique_ptr<PROBLEME_ANTARES_A_RESOUDRE>> ProblemesDesIntervalles;
 };
 
 #endif /* __SOLVER_OPTIMISATION_STRUCTURE_PROBLEME_A_RESOUDRE_H__ */
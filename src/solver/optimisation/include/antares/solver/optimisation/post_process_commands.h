@@ -20,8 +20,12 @@
 */
 #pragma once
 
+#include <memory>
+
 #include "antares/solver/simulation/base_post_process.h"
 
+class HourlyCSRProblem;
+
 namespace Antares::Solver::Simulation
 {
 class DispatchableMarginPostProcessCmd: public basePostProcessCommand
@@ -125,6 +129,7 @@ public:
                                      PROBLEME_HEBDO* problemeHebdo,
                                      AreaList& areas,
                                      unsigned int numSpace);
+    ~CurtailmentSharingPostProcessCmd() override;
 
     void execute(const optRuntimeData& opt_runtime_data) override;
 
@@ -138,6 +143,8 @@ private:
     const AreaList& area_list_;
     const AdqPatchParams& adqPatchParams_;
     unsigned int numSpace_ = 0;
+    // Built at the first week needing curtailment sharing, then reused
+    std::unique_ptr<HourlyCSRProblem> hourlyCsrProblem_;
 };
 
 } // namespace Antares::Solver::Simulation
@@ -62,6 +62,31 @@ void OPT_AllocateFromNumberOfVariableConstraints(PROBLEME_ANTARES_A_RESOUDRE* Pr
     ProblemeAResoudre->VariablesEntieres.resize(nbVariables);
 }
 
+void OPT_CopierLesDonneesDeLIntervalle(const PROBLEME_ANTARES_A_RESOUDRE& from,
+                                       PROBLEME_ANTARES_A_RESOUDRE& to)
+{
+    to.NombreDeVariables = from.NombreDeVariables;
+    to.NombreDeContraintes = from.NombreDeContraintes;
+
+    to.CoutQuadratique = from.CoutQuadratique;
+    to.CoutLineaire = from.CoutLineaire;
+    to.TypeDeVariable = from.TypeDeVariable;
+    to.Xmin = from.Xmin;
+    to.Xmax = from.Xmax;
+    to.SecondMembre = from.SecondMembre;
+    to.AdresseOuPlacerLaValeurDesVariablesOptimisees
+      = from.AdresseOuPlacerLaValeurDesVariablesOptimisees;
+    to.AdresseOuPlacerLaValeurDesCoutsReduits = from.AdresseOuPlacerLaValeurDesCoutsReduits;
+    to.AdresseOuPlacerLaValeurDesCoutsMarginaux = from.AdresseOuPlacerLaValeurDesCoutsMarginaux;
+
+    to.X = from.X;
+    to.CoutsReduits = from.CoutsReduits;
+    to.CoutsMarginauxDesContraintes = from.CoutsMarginauxDesContraintes;
+    to.PositionDeLaVariable = from.PositionDeLaVariable;
+    to.ComplementDeLaBase = from.ComplementDeLaBase;
+    to.ExistenceDUneSolution = from.ExistenceDUneSolution;
+}
+
 static void optimisationAllocateProblem(PROBLEME_HEBDO* problemeHebdo)
 {
     const auto& ProblemeAResoudre = problemeHebdo->ProblemeAResoudre;
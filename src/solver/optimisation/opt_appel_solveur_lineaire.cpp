@@ -34,6 +34,7 @@
 #include "antares/solver/simulation/sim_structure_probleme_economique.h"
 #include "antares/solver/utils/filename.h"
 #include "antares/solver/utils/mps_utils.h"
+#include "antares/solver/utils/shared_bases.h"
 
 using namespace operations_research;
 using namespace Antares::Solver::Modeler::Api;
@@ -82,11 +83,13 @@ struct SimplexResult
 
 static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
                                           PROBLEME_HEBDO* problemeHebdo,
+                                          PROBLEME_ANTARES_A_RESOUDRE& interval,
                                           Optimization::PROBLEME_SIMPLEXE_NOMME& Probleme,
                                           const int NumIntervalle,
                                           const int optimizationNumber,
                                           const OptPeriodStringGenerator& optPeriodStringGenerator,
                                           bool PremierPassage,
+                                          Antares::Optimization::BasisStatus* basisForNextYears,
                                           IResultWriter& writer)
 {
     const auto& ProblemeAResoudre = problemeHebdo->ProblemeAResoudre;
@@ -128,34 +131,40 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
 
             TimeMeasurement updateMeasure;
 
-            ORTOOLS_ModifierLeVecteurCouts(solver,
-                                           ProblemeAResoudre->CoutLineaire.data(),
-                                           ProblemeAResoudre->NombreDeVariables);
-            ORTOOLS_ModifierLeVecteurSecondMembre(solver,
-                                                  ProblemeAResoudre->SecondMembre.data(),
-                                                  ProblemeAResoudre->Sens.data(),
-                                                  ProblemeAResoudre->NombreDeContraintes);
-            ORTOOLS_CorrigerLesBornes(solver,
-                                      ProblemeAResoudre->Xmin.data(),
-                                      ProblemeAResoudre->Xmax.data(),
-                                      ProblemeAResoudre->TypeDeVariable.data(),
-                                      ProblemeAResoudre->NombreDeVariables);
+            // Only the entries modified since the previous resolution are given to the solver
+            int nbUpdatedEntries = ORTOOLS_ModifierLeVecteurCouts(
+              solver,
+              interval.CoutLineaire.data(),
+              ProblemeAResoudre->NombreDeVariables);
+            nbUpdatedEntries += ORTOOLS_ModifierLeVecteurSecondMembre(
+              solver,
+              interval.SecondMembre.data(),
+              ProblemeAResoudre->Sens.data(),
+              ProblemeAResoudre->NombreDeContraintes);
+            nbUpdatedEntries += ORTOOLS_CorrigerLesBornes(solver,
+                                                          interval.Xmin.data(),
+                                                          interval.Xmax.data(),
+                                                          interval.TypeDeVariable.data(),
+                                                          ProblemeAResoudre->NombreDeVariables);
 
             updateMeasure.tick();
             timeMeasure.updateTime = updateMeasure.duration_ms();
             optimizationStatistics.addUpdateTime(timeMeasure.updateTime);
+            optimizationStatistics.addUpdatedEntries(nbUpdatedEntries,
+                                                     2 * ProblemeAResoudre->NombreDeVariables
+                                                       + ProblemeAResoudre->NombreDeContraintes);
         }
     }
 
     Probleme.NombreMaxDIterations = -1;
     Probleme.DureeMaxDuCalcul = -1.;
 
-    Probleme.CoutLineaire = ProblemeAResoudre->CoutLineaire.data();
-    Probleme.X = ProblemeAResoudre->X.data();
-    Probleme.Xmin = ProblemeAResoudre->Xmin.data();
-    Probleme.Xmax = ProblemeAResoudre->Xmax.data();
+    Probleme.CoutLineaire = interval.CoutLineaire.data();
+    Probleme.X = interval.X.data();
+    Probleme.Xmin = interval.Xmin.data();
+    Probleme.Xmax = interval.Xmax.data();
     Probleme.NombreDeVariables = ProblemeAResoudre->NombreDeVariables;
-    Probleme.TypeDeVariable = ProblemeAResoudre->TypeDeVariable.data();
+    Probleme.TypeDeVariable = interval.TypeDeVariable.data();
 
     Probleme.NombreDeContraintes = ProblemeAResoudre->NombreDeContraintes;
     Probleme.IndicesDebutDeLigne = ProblemeAResoudre->IndicesDebutDeLigne.data();
@@ -165,7 +174,7 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
                                                        ->CoefficientsDeLaMatriceDesContraintes
                                                        .data();
     Probleme.Sens = ProblemeAResoudre->Sens.data();
-    Probleme.SecondMembre = ProblemeAResoudre->SecondMembre.data();
+    Probleme.SecondMembre = interval.SecondMembre.data();
 
     Probleme.ChoixDeLAlgorithme = SPX_DUAL;
 
@@ -175,17 +184,17 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
 
     Probleme.StrategieAntiDegenerescence = AGRESSIF;
 
-    Probleme.PositionDeLaVariable = ProblemeAResoudre->PositionDeLaVariable.data();
+    Probleme.PositionDeLaVariable = interval.PositionDeLaVariable.data();
     Probleme.NbVarDeBaseComplementaires = 0;
-    Probleme.ComplementDeLaBase = ProblemeAResoudre->ComplementDeLaBase.data();
+    Probleme.ComplementDeLaBase = interval.ComplementDeLaBase.data();
 
     Probleme.LibererMemoireALaFin = NON_SPX;
 
     Probleme.UtiliserCoutMax = NON_SPX;
     Probleme.CoutMax = 0.0;
 
-    Probleme.CoutsMarginauxDesContraintes = ProblemeAResoudre->CoutsMarginauxDesContraintes.data();
-    Probleme.CoutsReduits = ProblemeAResoudre->CoutsReduits.data();
+    Probleme.CoutsMarginauxDesContraintes = interval.CoutsMarginauxDesContraintes.data();
+    Probleme.CoutsReduits = interval.CoutsReduits.data();
 
     Probleme.NombreDeContraintesCoupes = 0;
 
@@ -214,7 +223,9 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
     mps_writer->runIfNeeded(writer, filename);
 
     TimeMeasurement measure;
-    const bool keepBasis = (optimizationNumber == PREMIERE_OPTIMISATION);
+    // A basis coming from previous years is kept up to date for every optimization
+    const bool keepBasis = (optimizationNumber == PREMIERE_OPTIMISATION)
+                           || (&Probleme.basisStatus != &interval.basisStatus);
     solver = ORTOOLS_Simplexe(&Probleme, solver, keepBasis, options);
     if (solver != nullptr)
     {
@@ -225,10 +236,24 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
     timeMeasure.solveTime = measure.duration_ms();
     optimizationStatistics.addSolveTime(timeMeasure.solveTime);
 
-    ProblemeAResoudre->ExistenceDUneSolution = Probleme.ExistenceDUneSolution;
-    if (ProblemeAResoudre->ExistenceDUneSolution != OUI_SPX && PremierPassage)
+    if (solver != nullptr)
     {
-        if (ProblemeAResoudre->ExistenceDUneSolution != SPX_ERREUR_INTERNE)
+        timeMeasure.iterations = solver->iterations();
+        optimizationStatistics.addIterations(timeMeasure.iterations);
+
+        // First time this week is solved : its basis becomes the starting point of the next years.
+        // Only when the solver can start from it (see ORTOOLS_Simplexe).
+        if (basisForNextYears && Probleme.ExistenceDUneSolution == OUI_SPX
+            && solverSupportsWarmStart(solver->ProblemType()) && !Probleme.isMIP())
+        {
+            basisForNextYears->extractBasis(solver);
+        }
+    }
+
+    interval.ExistenceDUneSolution = Probleme.ExistenceDUneSolution;
+    if (interval.ExistenceDUneSolution != OUI_SPX && PremierPassage)
+    {
+        if (interval.ExistenceDUneSolution != SPX_ERREUR_INTERNE)
         {
             if (solver)
             {
@@ -252,18 +277,44 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
     return {.success = true, .timeMeasure = timeMeasure, .mps_writer_factory = mps_writer_factory};
 }
 
-bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
-                         PROBLEME_HEBDO* problemeHebdo,
-                         int NumIntervalle,
-                         const int optimizationNumber,
-                         const OptPeriodStringGenerator& optPeriodStringGenerator,
-                         IResultWriter& writer)
+bool OPT_ResoudreLeProblemeDeLIntervalle(const OptimizationOptions& options,
+                                         PROBLEME_HEBDO* problemeHebdo,
+                                         PROBLEME_ANTARES_A_RESOUDRE& interval,
+                                         int NumIntervalle,
+                                         const int optimizationNumber,
+                                         const OptPeriodStringGenerator& optPeriodStringGenerator,
+                                         IResultWriter& writer,
+                                         TIME_MEASURE& timeMeasure)
 {
     const auto& ProblemeAResoudre = problemeHebdo->ProblemeAResoudre;
+
+    // When warm-starting across MC years, the week starts from the basis found for the same
+    // week in a previous year. The first year, we start from the usual basis and save the
+    // optimal one for the next years.
+    // When bases are shared across MC years, the previous years include the ones running in
+    // parallel, and the best basis found by any of them is used.
+    const auto& sharedBases = problemeHebdo->basesSharedAcrossYears;
+    const std::tuple key{problemeHebdo->weekInTheYear, NumIntervalle, optimizationNumber};
+    Antares::Optimization::BasisStatus* basisOfPreviousYears = nullptr;
+    if (options.warmStartAcrossYears || sharedBases)
+    {
+        basisOfPreviousYears = &interval.basisOfPreviousYears[key];
+    }
+    if (sharedBases)
+    {
+        sharedBases->copyBestBasis(key, *basisOfPreviousYears);
+    }
+    const bool startFromPreviousYears = basisOfPreviousYears && basisOfPreviousYears->exists();
+    Antares::Optimization::BasisStatus* basisForNextYears = startFromPreviousYears
+                                                              ? nullptr
+                                                              : basisOfPreviousYears;
+
     Optimization::PROBLEME_SIMPLEXE_NOMME Probleme(ProblemeAResoudre->NomDesVariables,
                                                    ProblemeAResoudre->NomDesContraintes,
                                                    ProblemeAResoudre->VariablesEntieres,
-                                                   ProblemeAResoudre->basisStatus,
+                                                   startFromPreviousYears
+                                                     ? *basisOfPreviousYears
+                                                     : interval.basisStatus,
                                                    problemeHebdo->NamedProblems,
                                                    options.solverLogs);
 
@@ -271,11 +322,13 @@ bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
 
     SimplexResult simplexResult = OPT_TryToCallSimplex(options,
                                                        problemeHebdo,
+                                                       interval,
                                                        Probleme,
                                                        NumIntervalle,
                                                        optimizationNumber,
                                                        optPeriodStringGenerator,
                                                        PremierPassage,
+                                                       basisForNextYears,
                                                        writer);
 
     if (!simplexResult.success)
@@ -283,97 +336,133 @@ bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
         PremierPassage = false;
         simplexResult = OPT_TryToCallSimplex(options,
                                              problemeHebdo,
+                                             interval,
                                              Probleme,
                                              NumIntervalle,
                                              optimizationNumber,
                                              optPeriodStringGenerator,
                                              PremierPassage,
+                                             basisForNextYears,
                                              writer);
     }
+    timeMeasure = simplexResult.timeMeasure;
 
-    if (ProblemeAResoudre->ExistenceDUneSolution == OUI_SPX)
+    if (interval.ExistenceDUneSolution == OUI_SPX)
     {
         if (!PremierPassage)
         {
             logs.info() << " Solver: Safe resolution succeeded";
         }
+        if (sharedBases && basisOfPreviousYears->exists())
+        {
+            sharedBases->offer(key, *basisOfPreviousYears, timeMeasure.iterations);
+        }
+        return true;
+    }
 
-        double* pt;
-        double CoutOpt = 0.0;
+    if (!PremierPassage)
+    {
+        logs.info() << " Solver: Safe resolution failed";
+    }
 
-        for (int i = 0; i < ProblemeAResoudre->NombreDeVariables; i++)
-        {
-            CoutOpt += ProblemeAResoudre->CoutLineaire[i] * ProblemeAResoudre->X[i];
+    // Written first : the analysis modifies the problem
+    auto mps_writer_on_error = simplexResult.mps_writer_factory.createOnOptimizationError();
+    const std::string filename = createMPSfilename(optPeriodStringGenerator, optimizationNumber);
+    mps_writer_on_error->runIfNeeded(writer, filename);
 
-            pt = ProblemeAResoudre->AdresseOuPlacerLaValeurDesVariablesOptimisees[i];
-            if (pt != nullptr)
-            {
-                *pt = ProblemeAResoudre->X[i];
-            }
+    // The analysis is run on the problem which could not be solved, so that the solver starts
+    // from the state of the failed resolution instead of a new problem
+    auto solver = (MPSolver*)(ProblemeAResoudre->ProblemesSpx[NumIntervalle]);
+    if (solver)
+    {
+        auto analyzer = makeUnfeasiblePbAnalyzer(ProblemeAResoudre->NomDesVariables,
+                                                 ProblemeAResoudre->NomDesContraintes);
+        analyzer->run(solver);
+        analyzer->printReport();
 
-            pt = ProblemeAResoudre->AdresseOuPlacerLaValeurDesCoutsReduits[i];
-            if (pt != nullptr)
-            {
-                *pt = ProblemeAResoudre->CoutsReduits[i];
-            }
-        }
+        // The problem has been modified : it will be built again for the next resolution
+        ORTOOLS_LibererProbleme(solver);
+        ProblemeAResoudre->ProblemesSpx[NumIntervalle] = nullptr;
+    }
 
-        {
-            const int opt = optimizationNumber - 1;
-            assert(opt >= 0 && opt < 2);
-            problemeHebdo->timeMeasure[opt] = simplexResult.timeMeasure;
-        }
+    return false;
+}
 
-        // TODO remove this if..else
-        if (optimizationNumber == PREMIERE_OPTIMISATION)
-        {
-            problemeHebdo->coutOptimalSolution1[NumIntervalle] = CoutOpt;
-        }
-        else
+void OPT_RecupererLesResultatsDeLIntervalle(PROBLEME_HEBDO* problemeHebdo,
+                                            int NumIntervalle,
+                                            const int optimizationNumber,
+                                            const TIME_MEASURE& timeMeasure)
+{
+    const auto& ProblemeAResoudre = problemeHebdo->ProblemeAResoudre;
+
+    double* pt;
+    double CoutOpt = 0.0;
+
+    for (int i = 0; i < ProblemeAResoudre->NombreDeVariables; i++)
+    {
+        CoutOpt += ProblemeAResoudre->CoutLineaire[i] * ProblemeAResoudre->X[i];
+
+        pt = ProblemeAResoudre->AdresseOuPlacerLaValeurDesVariablesOptimisees[i];
+        if (pt != nullptr)
         {
-            problemeHebdo->coutOptimalSolution2[NumIntervalle] = CoutOpt;
+            *pt = ProblemeAResoudre->X[i];
         }
-        for (int Cnt = 0; Cnt < ProblemeAResoudre->NombreDeContraintes; Cnt++)
+
+        pt = ProblemeAResoudre->AdresseOuPlacerLaValeurDesCoutsReduits[i];
+        if (pt != nullptr)
         {
-            pt = ProblemeAResoudre->AdresseOuPlacerLaValeurDesCoutsMarginaux[Cnt];
-            if (pt != nullptr)
-            {
-                *pt = ProblemeAResoudre->CoutsMarginauxDesContraintes[Cnt];
-            }
+            *pt = ProblemeAResoudre->CoutsReduits[i];
         }
     }
 
+    {
+        const int opt = optimizationNumber - 1;
+        assert(opt >= 0 && opt < 2);
+        problemeHebdo->timeMeasure[opt] = timeMeasure;
+    }
+
+    // TODO remove this if..else
+    if (optimizationNumber == PREMIERE_OPTIMISATION)
+    {
+        problemeHebdo->coutOptimalSolution1[NumIntervalle] = CoutOpt;
+    }
     else
     {
-        if (!PremierPassage)
+        problemeHebdo->coutOptimalSolution2[NumIntervalle] = CoutOpt;
+    }
+    for (int Cnt = 0; Cnt < ProblemeAResoudre->NombreDeContraintes; Cnt++)
+    {
+        pt = ProblemeAResoudre->AdresseOuPlacerLaValeurDesCoutsMarginaux[Cnt];
+        if (pt != nullptr)
         {
-            logs.info() << " Solver: Safe resolution failed";
+            *pt = ProblemeAResoudre->CoutsMarginauxDesContraintes[Cnt];
         }
+    }
+}
 
-        Probleme.SetUseNamedProblems(true);
-
-        auto ortoolsProblem = std::make_unique<LegacyOrtoolsLinearProblem>(Probleme.isMIP(),
-                                                                           options.ortoolsSolver);
-        auto legacyOrtoolsFiller = std::make_unique<LegacyFiller>(&Probleme);
-        std::vector<LinearProblemFiller*> fillersCollection = {legacyOrtoolsFiller.get()};
-        LinearProblemData LP_Data;
-        FillContext fillCtx(0, 167);
-        LinearProblemBuilder linearProblemBuilder(fillersCollection);
-
-        linearProblemBuilder.build(*ortoolsProblem, LP_Data, fillCtx);
-        auto MPproblem = std::shared_ptr<MPSolver>(ortoolsProblem->getMpSolver());
-
-        auto analyzer = makeUnfeasiblePbAnalyzer();
-        analyzer->run(MPproblem.get());
-        analyzer->printReport();
-
-        auto mps_writer_on_error = simplexResult.mps_writer_factory.createOnOptimizationError();
-        const std::string filename = createMPSfilename(optPeriodStringGenerator,
-                                                       optimizationNumber);
-        mps_writer_on_error->runIfNeeded(writer, filename);
-
+bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
+                         PROBLEME_HEBDO* problemeHebdo,
+                         int NumIntervalle,
+                         const int optimizationNumber,
+                         const OptPeriodStringGenerator& optPeriodStringGenerator,
+                         IResultWriter& writer)
+{
+    TIME_MEASURE timeMeasure;
+    if (!OPT_ResoudreLeProblemeDeLIntervalle(options,
+                                             problemeHebdo,
+                                             *problemeHebdo->ProblemeAResoudre,
+                                             NumIntervalle,
+                                             optimizationNumber,
+                                             optPeriodStringGenerator,
+                                             writer,
+                                             timeMeasure))
+    {
         return false;
     }
 
+    OPT_RecupererLesResultatsDeLIntervalle(problemeHebdo,
+                                           NumIntervalle,
+                                           optimizationNumber,
+                                           timeMeasure);
     return true;
 }
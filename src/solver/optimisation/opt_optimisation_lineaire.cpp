@@ -19,7 +19,9 @@
  * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
  */
 
+#include <antares/concurrency/concurrency.h>
 #include <antares/logs/logs.h>
+#include "antares/solver/optimisation/ConstraintMatrixFingerprint.h"
 #include "antares/solver/optimisation/LinearProblemMatrix.h"
 #include "antares/solver/optimisation/constraints/constraint_builder_utils.h"
 #include "antares/solver/optimisation/opt_export_structure.h"
@@ -110,13 +112,89 @@ void notifyProblemHebdo(const PROBLEME_HEBDO* problemeHebdo,
                                           createMPSfilename(*optPeriodStringGenerator,
                                                             optimizationNumber));
 }
+
+void notifySolutionHebdo(const PROBLEME_HEBDO* problemeHebdo,
+                         int optimizationNumber,
+                         Solver::Simulation::ISimulationObserver& simulationObserver,
+                         const OptPeriodStringGenerator* optPeriodStringGenerator)
+{
+    simulationObserver.notifyHebdoSolution(*problemeHebdo,
+                                           optimizationNumber,
+                                           createMPSfilename(*optPeriodStringGenerator,
+                                                             optimizationNumber));
+}
 } // namespace
 
-bool runWeeklyOptimization(const OptimizationOptions& options,
-                           PROBLEME_HEBDO* problemeHebdo,
-                           Solver::IResultWriter& writer,
+void initializeInterval(PROBLEME_HEBDO* problemeHebdo,
+                        int PremierPdtDeLIntervalle,
+                        int DernierPdtDeLIntervalle,
+                        int numeroDeLIntervalle,
+                        int optimizationNumber)
+{
+    OPT_InitialiserLesBornesDesVariablesDuProblemeLineaire(problemeHebdo,
+                                                           PremierPdtDeLIntervalle,
+                                                           DernierPdtDeLIntervalle,
+                                                           optimizationNumber);
+
+    OPT_InitialiserLeSecondMembreDuProblemeLineaire(problemeHebdo,
+                                                    PremierPdtDeLIntervalle,
+                                                    DernierPdtDeLIntervalle,
+                                                    numeroDeLIntervalle,
+                                                    optimizationNumber);
+
+    OPT_InitialiserLesCoutsLineaire(problemeHebdo,
+                                    PremierPdtDeLIntervalle,
+                                    DernierPdtDeLIntervalle);
+}
+
+// An optimization period represents a sequence as <year>-<week> or <year>-<week>-<day>,
+// depending whether the optimization is daily or weekly.
+// These sequences are used when building the names of MPS or criterion files.
+std::shared_ptr<OptPeriodStringGenerator> createOptPeriod(const PROBLEME_HEBDO* problemeHebdo,
+                                                          int numeroDeLIntervalle)
+{
+    return createOptPeriodAsString(problemeHebdo->OptimisationAuPasHebdomadaire,
+                                   numeroDeLIntervalle,
+                                   problemeHebdo->weekInTheYear,
+                                   problemeHebdo->year);
+}
+
+void exportIntervalResults(PROBLEME_HEBDO* problemeHebdo,
+                           int numeroDeLIntervalle,
                            int optimizationNumber,
+                           const OptPeriodStringGenerator& optPeriodStringGenerator,
+                           Solver::IResultWriter& writer,
                            Solver::Simulation::ISimulationObserver& simulationObserver)
+{
+    notifySolutionHebdo(problemeHebdo,
+                        optimizationNumber,
+                        simulationObserver,
+                        &optPeriodStringGenerator);
+
+    if (problemeHebdo->ExportMPS != Data::mpsExportStatus::NO_EXPORT)
+    {
+        double optimalSolutionCost = OPT_ObjectiveFunctionResult(problemeHebdo,
+                                                                 numeroDeLIntervalle,
+                                                                 optimizationNumber);
+        OPT_EcrireResultatFonctionObjectiveAuFormatTXT(optimalSolutionCost,
+                                                       optPeriodStringGenerator,
+                                                       optimizationNumber,
+                                                       writer);
+    }
+    if (problemeHebdo->exportSolutions)
+    {
+        OPT_WriteSolution(*problemeHebdo->ProblemeAResoudre,
+                          optPeriodStringGenerator,
+                          optimizationNumber,
+                          writer);
+    }
+}
+
+bool runIntervalsSequentially(const OptimizationOptions& options,
+                              PROBLEME_HEBDO* problemeHebdo,
+                              Solver::IResultWriter& writer,
+                              int optimizationNumber,
+                              Solver::Simulation::ISimulationObserver& simulationObserver)
 {
     const int NombreDePasDeTempsPourUneOptimisation = problemeHebdo
                                                         ->NombreDePasDeTempsPourUneOptimisation;
@@ -128,29 +206,13 @@ bool runWeeklyOptimization(const OptimizationOptions& options,
         int PremierPdtDeLIntervalle = pdtHebdo;
         DernierPdtDeLIntervalle = pdtHebdo + NombreDePasDeTempsPourUneOptimisation;
 
-        OPT_InitialiserLesBornesDesVariablesDuProblemeLineaire(problemeHebdo,
-                                                               PremierPdtDeLIntervalle,
-                                                               DernierPdtDeLIntervalle,
-                                                               optimizationNumber);
-
-        OPT_InitialiserLeSecondMembreDuProblemeLineaire(problemeHebdo,
-                                                        PremierPdtDeLIntervalle,
-                                                        DernierPdtDeLIntervalle,
-                                                        numeroDeLIntervalle,
-                                                        optimizationNumber);
-
-        OPT_InitialiserLesCoutsLineaire(problemeHebdo,
-                                        PremierPdtDeLIntervalle,
-                                        DernierPdtDeLIntervalle);
-
-        // An optimization period represents a sequence as <year>-<week> or <year>-<week>-<day>,
-        // depending whether the optimization is daily or weekly.
-        // These sequences are used when building the names of MPS or criterion files.
-        auto optPeriodStringGenerator = createOptPeriodAsString(
-          problemeHebdo->OptimisationAuPasHebdomadaire,
-          numeroDeLIntervalle,
-          problemeHebdo->weekInTheYear,
-          problemeHebdo->year);
+        initializeInterval(problemeHebdo,
+                           PremierPdtDeLIntervalle,
+                           DernierPdtDeLIntervalle,
+                           numeroDeLIntervalle,
+                           optimizationNumber);
+
+        auto optPeriodStringGenerator = createOptPeriod(problemeHebdo, numeroDeLIntervalle);
 
         notifyProblemHebdo(problemeHebdo,
                            optimizationNumber,
@@ -167,27 +229,146 @@ bool runWeeklyOptimization(const OptimizationOptions& options,
             return false;
         }
 
-        if (problemeHebdo->ExportMPS != Data::mpsExportStatus::NO_EXPORT)
+        exportIntervalResults(problemeHebdo,
+                              numeroDeLIntervalle,
+                              optimizationNumber,
+                              *optPeriodStringGenerator,
+                              writer,
+                              simulationObserver);
+    }
+    return true;
+}
+
+// The daily problems of a week share the same constraint matrix and do not depend on each other.
+// They are built one after the other in ProblemeAResoudre (the builders are not thread-safe),
+// and each of them is saved into its own interval problem. These problems are then solved
+// concurrently. Each day is then reported to the weekly problem and to the observer in the
+// order of the days, as when solving sequentially : its problem, then its solution.
+bool runIntervalsInParallel(const OptimizationOptions& options,
+                            PROBLEME_HEBDO* problemeHebdo,
+                            Solver::IResultWriter& writer,
+                            int optimizationNumber,
+                            Solver::Simulation::ISimulationObserver& simulationObserver)
+{
+    auto& ProblemeAResoudre = *problemeHebdo->ProblemeAResoudre;
+    const int NombreDePasDeTempsPourUneOptimisation = problemeHebdo
+                                                        ->NombreDePasDeTempsPourUneOptimisation;
+    const int nbIntervals = problemeHebdo->NombreDePasDeTemps
+                            / NombreDePasDeTempsPourUneOptimisation;
+
+    auto& intervals = ProblemeAResoudre.ProblemesDesIntervalles;
+    if (intervals.size() < static_cast<size_t>(nbIntervals))
+    {
+        intervals.resize(nbIntervals);
+    }
+
+    struct IntervalResolution
+    {
+        std::shared_ptr<OptPeriodStringGenerator> optPeriodStringGenerator;
+        TIME_MEASURE timeMeasure;
+        bool solved = false;
+    };
+
+    std::vector<IntervalResolution> resolutions(nbIntervals);
+
+    for (int numeroDeLIntervalle = 0; numeroDeLIntervalle < nbIntervals; ++numeroDeLIntervalle)
+    {
+        const int PremierPdtDeLIntervalle = numeroDeLIntervalle
+                                            * NombreDePasDeTempsPourUneOptimisation;
+        initializeInterval(problemeHebdo,
+                           PremierPdtDeLIntervalle,
+                           PremierPdtDeLIntervalle + NombreDePasDeTempsPourUneOptimisation,
+                           numeroDeLIntervalle,
+                           optimizationNumber);
+
+        auto& resolution = resolutions[numeroDeLIntervalle];
+        resolution.optPeriodStringGenerator = createOptPeriod(problemeHebdo, numeroDeLIntervalle);
+
+        auto& interval = intervals[numeroDeLIntervalle];
+        if (!interval)
         {
-            double optimalSolutionCost = OPT_ObjectiveFunctionResult(problemeHebdo,
-                                                                     numeroDeLIntervalle,
-                                                                     optimizationNumber);
-            OPT_EcrireResultatFonctionObjectiveAuFormatTXT(optimalSolutionCost,
-                                                           *optPeriodStringGenerator,
-                                                           optimizationNumber,
-                                                           writer);
+            interval = std::make_unique<PROBLEME_ANTARES_A_RESOUDRE>();
         }
-        if (problemeHebdo->exportSolutions)
+        OPT_CopierLesDonneesDeLIntervalle(ProblemeAResoudre, *interval);
+    }
+
+    // Each task only uses its own interval problem and its own solver (ProblemesSpx)
+    Concurrency::FutureSet results;
+    for (int numeroDeLIntervalle = 0; numeroDeLIntervalle < nbIntervals; ++numeroDeLIntervalle)
+    {
+        Concurrency::Task task = [&, numeroDeLIntervalle]()
         {
-            OPT_WriteSolution(*problemeHebdo->ProblemeAResoudre,
-                              *optPeriodStringGenerator,
-                              optimizationNumber,
-                              writer);
+            auto& resolution = resolutions[numeroDeLIntervalle];
+            resolution.solved = OPT_ResoudreLeProblemeDeLIntervalle(
+              options,
+              problemeHebdo,
+              *intervals[numeroDeLIntervalle],
+              numeroDeLIntervalle,
+              optimizationNumber,
+              *resolution.optPeriodStringGenerator,
+              writer,
+              resolution.timeMeasure);
+        };
+        results.add(Concurrency::AddTask(*problemeHebdo->threadPool, task));
+    }
+    results.join();
+
+    for (int numeroDeLIntervalle = 0; numeroDeLIntervalle < nbIntervals; ++numeroDeLIntervalle)
+    {
+        const auto& resolution = resolutions[numeroDeLIntervalle];
+        OPT_CopierLesDonneesDeLIntervalle(*intervals[numeroDeLIntervalle], ProblemeAResoudre);
+
+        // The solver does not modify the data of the problem : the observer receives the same
+        // problem as when solving sequentially, right before its solution
+        notifyProblemHebdo(problemeHebdo,
+                           optimizationNumber,
+                           simulationObserver,
+                           resolution.optPeriodStringGenerator.get());
+
+        if (!resolution.solved)
+        {
+            return false;
         }
+
+        OPT_RecupererLesResultatsDeLIntervalle(problemeHebdo,
+                                               numeroDeLIntervalle,
+                                               optimizationNumber,
+                                               resolution.timeMeasure);
+
+        exportIntervalResults(problemeHebdo,
+                              numeroDeLIntervalle,
+                              optimizationNumber,
+                              *resolution.optPeriodStringGenerator,
+                              writer,
+                              simulationObserver);
     }
     return true;
 }
 
+bool runWeeklyOptimization(const OptimizationOptions& options,
+                           PROBLEME_HEBDO* problemeHebdo,
+                           Solver::IResultWriter& writer,
+                           int optimizationNumber,
+                           Solver::Simulation::ISimulationObserver& simulationObserver)
+{
+    const bool solveIntervalsInParallel = options.parallelDailyProblems
+                                          && problemeHebdo->threadPool
+                                          && !problemeHebdo->OptimisationAuPasHebdomadaire;
+    if (solveIntervalsInParallel)
+    {
+        return runIntervalsInParallel(options,
+                                      problemeHebdo,
+                                      writer,
+                                      optimizationNumber,
+                                      simulationObserver);
+    }
+    return runIntervalsSequentially(options,
+                                    problemeHebdo,
+                                    writer,
+                                    optimizationNumber,
+                                    simulationObserver);
+}
+
 void runThermalHeuristic(PROBLEME_HEBDO* problemeHebdo)
 {
     if (problemeHebdo->OptimisationAvecCoutsDeDemarrage)
@@ -225,6 +406,35 @@ void resizeProbleme(PROBLEME_ANTARES_A_RESOUDRE* ProblemeAResoudre,
     ProblemeAResoudre->ComplementDeLaBase.resize(nombreDeContraintes);
     ProblemeAResoudre->NomDesContraintes.resize(nombreDeContraintes);
 }
+
+// The constraint matrix only depends on the study and on the optimization options, so that
+// weeks usually share the same one. When the matrix built for a previous week is still valid,
+// there is no need to build it again.
+bool constraintMatrixIsUpToDate(const OptimizationOptions& options, PROBLEME_HEBDO* problemeHebdo)
+{
+    // Constraint names depend on the week
+    if (!options.reuseConstraintMatrix || problemeHebdo->NamedProblems)
+    {
+        return false;
+    }
+
+    auto& fingerprint = problemeHebdo->ProblemeAResoudre->constraintMatrixFingerprint;
+    const std::size_t current = ConstraintMatrixFingerprint(*problemeHebdo);
+    const bool upToDate = fingerprint == current;
+    fingerprint = current;
+    return upToDate;
+}
+
+void buildConstraintMatrix(PROBLEME_HEBDO* problemeHebdo)
+{
+    auto builder_data = NewGetConstraintBuilderFromProblemHebdo(problemeHebdo);
+    ConstraintBuilder builder(builder_data);
+    LinearProblemMatrix linearProblemMatrix(problemeHebdo, builder);
+    linearProblemMatrix.Run();
+    resizeProbleme(problemeHebdo->ProblemeAResoudre.get(),
+                   problemeHebdo->ProblemeAResoudre->NombreDeVariables,
+                   problemeHebdo->ProblemeAResoudre->NombreDeContraintes);
+}
 } // namespace
 
 bool OPT_OptimisationLineaire(const OptimizationOptions& options,
@@ -250,13 +460,11 @@ bool OPT_OptimisationLineaire(const OptimizationOptions& options,
 
     OPT_ConstruireLaListeDesVariablesOptimiseesDuProblemeLineaire(problemeHebdo);
 
-    auto builder_data = NewGetConstraintBuilderFromProblemHebdo(problemeHebdo);
-    ConstraintBuilder builder(builder_data);
-    LinearProblemMatrix linearProblemMatrix(problemeHebdo, builder);
-    linearProblemMatrix.Run();
-    resizeProbleme(problemeHebdo->ProblemeAResoudre.get(),
-                   problemeHebdo->ProblemeAResoudre->NombreDeVariables,
-                   problemeHebdo->ProblemeAResoudre->NombreDeContraintes);
+    if (!constraintMatrixIsUpToDate(options, problemeHebdo))
+    {
+        buildConstraintMatrix(problemeHebdo);
+    }
+
     if (problemeHebdo->ExportStructure && problemeHebdo->firstWeekOfSimulation)
     {
         OPT_ExportStructures(problemeHebdo, writer);
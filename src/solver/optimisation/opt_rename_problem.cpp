@@ -21,175 +21,149 @@
 
 #include "antares/solver/optimisation/opt_rename_problem.h"
 
-#include <map>
-#include <string>
+using LpNames = Antares::Optimization::LpNames;
 
-const std::string HOUR("hour");
-const std::string DAY("day");
-const std::string WEEK("week");
-const std::map<std::string, std::string> BindingConstraintTimeGranularity = {{HOUR, "hourly"},
-                                                                             {DAY, "daily"},
-                                                                             {WEEK, "weekly"}};
-const std::string LINK("link");
-const std::string AREA("area");
-
-std::string BuildName(const std::string& name,
-                      const std::string& location,
-                      const std::string& additional_identifier)
+void Namer::set(unsigned int element,
+                std::string_view elementType,
+                LpNames::Location location,
+                uint32_t second,
+                LpNames::TimeStep timeStepType)
 {
-    std::string result = name + SEPARATOR + location + SEPARATOR + additional_identifier;
-    std::replace(result.begin(), result.end(), ' ', '*');
-    return result;
+    LpNames::Descriptor descriptor;
+    descriptor.type = target_.label(elementType);
+    descriptor.first = area_;
+    descriptor.second = second;
+    descriptor.timeStep = timeStep_;
+    descriptor.location = location;
+    descriptor.timeStepType = timeStepType;
+    target_.set(element, descriptor);
 }
 
-void Namer::SetLinkElementName(unsigned int element, const std::string& elementType)
+void Namer::SetLinkElementName(unsigned int element,
+                               std::string_view elementType,
+                               std::string_view origin,
+                               std::string_view destination)
 {
-    const auto location = origin_ + AREA_SEP + destination_;
-    targetUpdater_.UpdateTargetAtIndex(BuildName(elementType,
-                                                 LocationIdentifier(location, LINK),
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       element);
+    LpNames::Descriptor descriptor;
+    descriptor.type = target_.label(elementType);
+    descriptor.first = target_.label(origin);
+    descriptor.second = target_.label(destination);
+    descriptor.timeStep = timeStep_;
+    descriptor.location = LpNames::Location::Link;
+    target_.set(element, descriptor);
 }
 
-void Namer::SetAreaElementNameHour(unsigned int element, const std::string& elementType)
+void Namer::SetAreaElementNameHour(unsigned int element, std::string_view elementType)
 {
-    SetAreaElementName(element, elementType, HOUR);
+    SetAreaElementName(element, elementType, LpNames::TimeStep::Hour);
 }
 
-void Namer::SetAreaElementNameWeek(unsigned int element, const std::string& elementType)
+void Namer::SetAreaElementNameWeek(unsigned int element, std::string_view elementType)
 {
-    SetAreaElementName(element, elementType, WEEK);
+    SetAreaElementName(element, elementType, LpNames::TimeStep::Week);
 }
 
 void Namer::SetAreaElementName(unsigned int element,
-                               const std::string& elementType,
-                               const std::string& timeStepType)
+                               std::string_view elementType,
+                               LpNames::TimeStep timeStepType)
 {
-    targetUpdater_.UpdateTargetAtIndex(BuildName(elementType,
-                                                 LocationIdentifier(area_, AREA),
-                                                 TimeIdentifier(timeStep_, timeStepType)),
-                                       element);
+    set(element, elementType, LpNames::Location::Area, 0, timeStepType);
 }
 
-void VariableNamer::SetAreaVariableName(unsigned int variable,
-                                        const std::string& variableType,
-                                        int layerIndex)
+void Namer::SetThermalClusterElementName(unsigned int element,
+                                         std::string_view elementType,
+                                         std::string_view clusterName)
 {
-    targetUpdater_.UpdateTargetAtIndex(BuildName(variableType,
-                                                 LocationIdentifier(area_, AREA) + SEPARATOR
-                                                   + "Layer<" + std::to_string(layerIndex) + ">",
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       variable);
+    set(element, elementType, LpNames::Location::ThermalCluster, target_.label(clusterName));
 }
 
-void Namer::SetThermalClusterElementName(unsigned int variable,
-                                         const std::string& elementType,
-                                         const std::string& clusterName)
+void Namer::SetShortTermStorageElementName(unsigned int element,
+                                           std::string_view elementType,
+                                           std::string_view shortTermStorageName)
 {
-    const auto location = LocationIdentifier(area_, AREA) + SEPARATOR + "ThermalCluster" + "<"
-                          + clusterName + ">";
-
-    targetUpdater_.UpdateTargetAtIndex(BuildName(elementType,
-                                                 location,
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       variable);
+    set(element,
+        elementType,
+        LpNames::Location::ShortTermStorage,
+        target_.label(shortTermStorageName));
 }
 
-void VariableNamer::DispatchableProduction(unsigned int variable, const std::string& clusterName)
+void VariableNamer::DispatchableProduction(unsigned int variable, std::string_view clusterName)
 {
     SetThermalClusterElementName(variable, "DispatchableProduction", clusterName);
 }
 
-void VariableNamer::NODU(unsigned int variable, const std::string& clusterName)
+void VariableNamer::NODU(unsigned int variable, std::string_view clusterName)
 {
     SetThermalClusterElementName(variable, "NODU", clusterName);
 }
 
 void VariableNamer::NumberStoppingDispatchableUnits(unsigned int variable,
-                                                    const std::string& clusterName)
+                                                    std::string_view clusterName)
 {
     SetThermalClusterElementName(variable, "NumberStoppingDispatchableUnits", clusterName);
 }
 
 void VariableNamer::NumberStartingDispatchableUnits(unsigned int variable,
-                                                    const std::string& clusterName)
+                                                    std::string_view clusterName)
 {
     SetThermalClusterElementName(variable, "NumberStartingDispatchableUnits", clusterName);
 }
 
 void VariableNamer::NumberBreakingDownDispatchableUnits(unsigned int variable,
-                                                        const std::string& clusterName)
+                                                        std::string_view clusterName)
 {
     SetThermalClusterElementName(variable, "NumberBreakingDownDispatchableUnits", clusterName);
 }
 
 void VariableNamer::NTCDirect(unsigned int variable,
-                              const std::string& origin,
-                              const std::string& destination)
+                              std::string_view origin,
+                              std::string_view destination)
 {
-    origin_ = origin;
-    destination_ = destination;
-    SetLinkElementName(variable, "NTCDirect");
+    SetLinkElementName(variable, "NTCDirect", origin, destination);
 }
 
 void VariableNamer::IntercoDirectCost(unsigned int variable,
-                                      const std::string& origin,
-                                      const std::string& destination)
+                                      std::string_view origin,
+                                      std::string_view destination)
 {
-    origin_ = origin;
-    destination_ = destination;
-    SetLinkElementName(variable, "IntercoDirectCost");
+    SetLinkElementName(variable, "IntercoDirectCost", origin, destination);
 }
 
 void VariableNamer::IntercoIndirectCost(unsigned int variable,
-                                        const std::string& origin,
-                                        const std::string& destination)
-{
-    origin_ = origin;
-    destination_ = destination;
-    SetLinkElementName(variable, "IntercoIndirectCost");
-}
-
-void VariableNamer::SetShortTermStorageVariableName(unsigned int variable,
-                                                    const std::string& variableType,
-                                                    const std::string& shortTermStorageName)
+                                        std::string_view origin,
+                                        std::string_view destination)
 {
-    const auto location = LocationIdentifier(area_, AREA) + SEPARATOR + "ShortTermStorage" + "<"
-                          + shortTermStorageName + ">";
-    targetUpdater_.UpdateTargetAtIndex(BuildName(variableType,
-                                                 location,
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       variable);
+    SetLinkElementName(variable, "IntercoIndirectCost", origin, destination);
 }
 
 void VariableNamer::ShortTermStorageInjection(unsigned int variable,
-                                              const std::string& shortTermStorageName)
+                                              std::string_view shortTermStorageName)
 {
-    SetShortTermStorageVariableName(variable, "Injection", shortTermStorageName);
+    SetShortTermStorageElementName(variable, "Injection", shortTermStorageName);
 }
 
 void VariableNamer::ShortTermStorageWithdrawal(unsigned int variable,
-                                               const std::string& shortTermStorageName)
+                                               std::string_view shortTermStorageName)
 {
-    SetShortTermStorageVariableName(variable, "Withdrawal", shortTermStorageName);
+    SetShortTermStorageElementName(variable, "Withdrawal", shortTermStorageName);
 }
 
 void VariableNamer::ShortTermStorageLevel(unsigned int variable,
-                                          const std::string& shortTermStorageName)
+                                          std::string_view shortTermStorageName)
 {
-    SetShortTermStorageVariableName(variable, "Level", shortTermStorageName);
+    SetShortTermStorageElementName(variable, "Level", shortTermStorageName);
 }
 
 void VariableNamer::ShortTermStorageCostVariationInjection(unsigned int variable,
-                                                           const std::string& shortTermStorageName)
+                                                           std::string_view shortTermStorageName)
 {
-    SetShortTermStorageVariableName(variable, "CostVariationInjection", shortTermStorageName);
+    SetShortTermStorageElementName(variable, "CostVariationInjection", shortTermStorageName);
 }
 
 void VariableNamer::ShortTermStorageCostVariationWithdrawal(unsigned int variable,
-                                                            const std::string& shortTermStorageName)
+                                                            std::string_view shortTermStorageName)
 {
-    SetShortTermStorageVariableName(variable, "CostVariationWithdrawal", shortTermStorageName);
+    SetShortTermStorageElementName(variable, "CostVariationWithdrawal", shortTermStorageName);
 }
 
 void VariableNamer::HydProd(unsigned int variable)
@@ -224,7 +198,7 @@ void VariableNamer::Overflow(unsigned int variable)
 
 void VariableNamer::LayerStorage(unsigned int variable, int layerIndex)
 {
-    SetAreaVariableName(variable, "LayerStorage", layerIndex);
+    set(variable, "LayerStorage", LpNames::Location::AreaLayer, layerIndex);
 }
 
 void VariableNamer::FinalStorage(unsigned int variable)
@@ -248,21 +222,17 @@ void VariableNamer::AreaBalance(unsigned int variable)
 }
 
 void ConstraintNamer::FlowDissociation(unsigned int constraint,
-                                       const std::string& origin,
-                                       const std::string& destination)
+                                       std::string_view origin,
+                                       std::string_view destination)
 {
-    origin_ = origin;
-    destination_ = destination;
-    SetLinkElementName(constraint, "FlowDissociation");
+    SetLinkElementName(constraint, "FlowDissociation", origin, destination);
 }
 
 void ConstraintNamer::CsrFlowDissociation(unsigned int constraint,
-                                          const std::string& origin,
-                                          const std::string& destination)
+                                          std::string_view origin,
+                                          std::string_view destination)
 {
-    origin_ = origin;
-    destination_ = destination;
-    SetLinkElementName(constraint, "CsrFlowDissociation");
+    SetLinkElementName(constraint, "CsrFlowDissociation", origin, destination);
 }
 
 void ConstraintNamer::CsrAreaBalance(unsigned int constraint)
@@ -331,99 +301,89 @@ void ConstraintNamer::FinalStockExpression(unsigned int constraint)
 }
 
 void ConstraintNamer::nameWithTimeGranularity(unsigned int constraint,
-                                              const std::string& name,
-                                              const std::string& type)
+                                              std::string_view name,
+                                              LpNames::TimeStep timeStepType)
 {
-    targetUpdater_.UpdateTargetAtIndex(BuildName(name,
-                                                 BindingConstraintTimeGranularity.at(type),
-                                                 TimeIdentifier(timeStep_, type)),
-                                       constraint);
+    set(constraint, name, LpNames::Location::Granularity, 0, timeStepType);
 }
 
 void ConstraintNamer::NbUnitsOutageLessThanNbUnitsStop(unsigned int constraint,
-                                                       const std::string& clusterName)
+                                                       std::string_view clusterName)
 {
     SetThermalClusterElementName(constraint, "NbUnitsOutageLessThanNbUnitsStop", clusterName);
 }
 
 void ConstraintNamer::NbDispUnitsMinBoundSinceMinUpTime(unsigned int constraint,
-                                                        const std::string& clusterName)
+                                                        std::string_view clusterName)
 {
     SetThermalClusterElementName(constraint, "NbDispUnitsMinBoundSinceMinUpTime", clusterName);
 }
 
-void ConstraintNamer::MinDownTime(unsigned int constraint, const std::string& clusterName)
+void ConstraintNamer::MinDownTime(unsigned int constraint, std::string_view clusterName)
 {
     SetThermalClusterElementName(constraint, "MinDownTime", clusterName);
 }
 
 void ConstraintNamer::PMaxDispatchableGeneration(unsigned int constraint,
-                                                 const std::string& clusterName)
+                                                 std::string_view clusterName)
 {
     SetThermalClusterElementName(constraint, "PMaxDispatchableGeneration", clusterName);
 }
 
 void ConstraintNamer::PMinDispatchableGeneration(unsigned int constraint,
-                                                 const std::string& clusterName)
+                                                 std::string_view clusterName)
 {
     SetThermalClusterElementName(constraint, "PMinDispatchableGeneration", clusterName);
 }
 
-void ConstraintNamer::ConsistenceNODU(unsigned int constraint, const std::string& clusterName)
+void ConstraintNamer::ConsistenceNODU(unsigned int constraint, std::string_view clusterName)
 {
     SetThermalClusterElementName(constraint, "ConsistenceNODU", clusterName);
 }
 
-void ConstraintNamer::ShortTermStorageLevel(unsigned int constraint, const std::string& name)
+void ConstraintNamer::ShortTermStorageLevel(unsigned int constraint, std::string_view name)
 {
-    targetUpdater_.UpdateTargetAtIndex(BuildName("Level",
-                                                 LocationIdentifier(area_, AREA) + SEPARATOR
-                                                   + "ShortTermStorage" + "<" + name + ">",
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       constraint);
+    SetShortTermStorageElementName(constraint, "Level", name);
 }
 
-void ConstraintNamer::BindingConstraintHour(unsigned int constraint, const std::string& name)
+void ConstraintNamer::BindingConstraintHour(unsigned int constraint, std::string_view name)
 {
-    nameWithTimeGranularity(constraint, name, HOUR);
+    nameWithTimeGranularity(constraint, name, LpNames::TimeStep::Hour);
 }
 
-void ConstraintNamer::CsrBindingConstraintHour(unsigned int constraint, const std::string& name)
+void ConstraintNamer::CsrBindingConstraintHour(unsigned int constraint, std::string_view name)
 {
-    nameWithTimeGranularity(constraint, name, HOUR);
+    nameWithTimeGranularity(constraint, name, LpNames::TimeStep::Hour);
 }
 
-void ConstraintNamer::BindingConstraintDay(unsigned int constraint, const std::string& name)
+void ConstraintNamer::BindingConstraintDay(unsigned int constraint, std::string_view name)
 {
-    nameWithTimeGranularity(constraint, name, DAY);
+    nameWithTimeGranularity(constraint, name, LpNames::TimeStep::Day);
 }
 
-void ConstraintNamer::BindingConstraintWeek(unsigned int constraint, const std::string& name)
+void ConstraintNamer::BindingConstraintWeek(unsigned int constraint, std::string_view name)
 {
-    nameWithTimeGranularity(constraint, name, WEEK);
+    nameWithTimeGranularity(constraint, name, LpNames::TimeStep::Week);
 }
 
-void ConstraintNamer::ShortTermStorageCostVariation(const std::string& constraint_name,
+void ConstraintNamer::ShortTermStorageCostVariation(std::string_view constraint_name,
                                                     unsigned int constraint,
-                                                    const std::string& short_term_name)
+                                                    std::string_view short_term_name)
 {
-    targetUpdater_.UpdateTargetAtIndex(BuildName(constraint_name,
-                                                 LocationIdentifier(area_, AREA) + SEPARATOR
-                                                   + "ShortTermStorage" + "<" + short_term_name
-                                                   + ">",
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       constraint);
+    SetShortTermStorageElementName(constraint, constraint_name, short_term_name);
 }
 
-void ConstraintNamer::ShortTermStorageCumulation(const std::string& constraint_type,
+void ConstraintNamer::ShortTermStorageCumulation(std::string_view constraint_type,
                                                  unsigned int constraint,
-                                                 const std::string& short_term_name,
-                                                 const std::string& constraint_name)
-{
-    targetUpdater_.UpdateTargetAtIndex(
-      BuildName(constraint_type,
-                LocationIdentifier(area_, AREA) + SEPARATOR + "ShortTermStorage" + "<"
-                  + short_term_name + ">",
-                ShortTermStorageCumulationIdentifier(constraint_name)),
-      constraint);
+                                                 std::string_view short_term_name,
+                                                 std::string_view constraint_name)
+{
+    LpNames::Descriptor descriptor;
+    descriptor.type = target_.label(constraint_type);
+    descriptor.first = area_;
+    descriptor.second = target_.label(short_term_name);
+    descriptor.timeStep = target_.label(constraint_name);
+    descriptor.location = LpNames::Location::ShortTermStorage;
+    descriptor.timeStepType = LpNames::TimeStep::Constraint;
+    target_.set(constraint, descriptor);
 }
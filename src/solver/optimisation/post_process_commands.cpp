@@ -261,6 +261,8 @@ CurtailmentSharingPostProcessCmd::CurtailmentSharingPostProcessCmd(
 {
 }
 
+CurtailmentSharingPostProcessCmd::~CurtailmentSharingPostProcessCmd() = default;
+
 void CurtailmentSharingPostProcessCmd::execute(const optRuntimeData& opt_runtime_data)
 {
     unsigned int year = opt_runtime_data.year;
@@ -270,14 +272,23 @@ void CurtailmentSharingPostProcessCmd::execute(const optRuntimeData& opt_runtime
     logs.info() << "[adq-patch] Year:" << year + 1 << " Week:" << week + 1
                 << ".Total LMR violation:" << totalLmrViolation;
     const std::set<int> hoursRequiringCurtailmentSharing = getHoursRequiringCurtailmentSharing();
-    HourlyCSRProblem hourlyCsrProblem(adqPatchParams_, problemeHebdo_);
+    if (hoursRequiringCurtailmentSharing.empty())
+    {
+        return;
+    }
+
     for (int hourInWeek: hoursRequiringCurtailmentSharing)
     {
         logs.info() << "[adq-patch] CSR triggered for Year:" << year + 1
                     << " Hour:" << week * nbHoursInWeek + hourInWeek + 1;
-        hourlyCsrProblem.setHour(hourInWeek);
-        hourlyCsrProblem.run(week, year);
     }
+
+    // The structure of the problem is the same for all weeks : built once for this numSpace
+    if (!hourlyCsrProblem_)
+    {
+        hourlyCsrProblem_ = std::make_unique<HourlyCSRProblem>(adqPatchParams_, problemeHebdo_);
+    }
+    hourlyCsrProblem_->run(hoursRequiringCurtailmentSharing, week, year);
 }
 
 double CurtailmentSharingPostProcessCmd::calculateDensNewAndTotalLmrViolation()
@@ -466,6 +466,9 @@ void finalizeOptimizationStatistics(PROBLEME_HEBDO& problem,
 
     state.averageUpdateTime = firstOptStat.getAverageUpdateTime()
                               + secondOptStat.getAverageUpdateTime();
+    logs.debug() << "  updated entries of the weekly problems : "
+                 << firstOptStat.getUpdatedEntriesRatio() << " % (first optimization), "
+                 << secondOptStat.getUpdatedEntriesRatio() << " % (second optimization)";
 
     firstOptStat.reset();
     secondOptStat.reset();
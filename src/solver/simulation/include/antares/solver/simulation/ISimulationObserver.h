@@ -30,7 +30,7 @@ namespace Antares::Solver::Simulation
 /**
  * @class ISimulationObserver
  * @brief The ISimulationObserver class is an interface for observing the simulation.
- * @details It declares the notifyHebdoProblem method.
+ * @details It declares the notifyHebdoProblem and notifyHebdoSolution methods.
  */
 class ISimulationObserver
 {
@@ -46,12 +46,23 @@ public:
                                     int optimizationNumber,
                                     std::string_view name)
       = 0;
+    /**
+     * @brief The notifyHebdoSolution method is used to notify of the solution of a problem, once
+     * it has been successfully solved.
+     * @param problemeHebdo A pointer to a PROBLEME_HEBDO object representing the solved problem.
+     * @param optimizationNumber The number of the optimization.
+     * @param name The name of the problem.
+     */
+    virtual void notifyHebdoSolution(const PROBLEME_HEBDO& problemeHebdo,
+                                     int optimizationNumber,
+                                     std::string_view name)
+      = 0;
 };
 
 /**
  * @class NullSimulationObserver
  * @brief The NullSimulationObserver class is a null object for the ISimulationObserver interface.
- * @details It overrides the notifyHebdoProblem method with an empty implementation.
+ * @details It overrides the notify methods with an empty implementation.
  */
 class NullSimulationObserver: public ISimulationObserver
 {
@@ -62,5 +73,10 @@ public:
     {
         // null object pattern
     }
+
+    void notifyHebdoSolution(const PROBLEME_HEBDO&, int, std::string_view) override
+    {
+        // null object pattern
+    }
 };
 } // namespace Antares::Solver::Simulation
@@ -21,6 +21,7 @@
 #pragma once
 #include <sstream>
 
+#include <antares/benchmarking/DurationCollector.h>
 #include <antares/writer/i_writer.h>
 #include "antares/solver/simulation/sim_structure_probleme_economique.h"
 
@@ -30,7 +31,9 @@ class OptimizationStatisticsWriter
 {
 public:
     void addTime(uint week, const TIME_MEASURES& timeMeasure);
-    OptimizationStatisticsWriter(Antares::Solver::IResultWriter& writer, uint year);
+    OptimizationStatisticsWriter(Antares::Solver::IResultWriter& writer,
+                                 uint year,
+                                 Benchmarking::DurationCollector& durationCollector);
     void finalize();
 
 private:
@@ -38,4 +41,5 @@ private:
     std::ostringstream pBuffer;
     uint pYear;
     Antares::Solver::IResultWriter& pWriter;
+    Benchmarking::DurationCollector& pDurationCollector;
 };
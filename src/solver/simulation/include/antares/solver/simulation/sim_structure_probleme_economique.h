@@ -32,6 +32,16 @@
 
 class AdequacyPatchRuntimeData;
 
+namespace Yuni::Job
+{
+class QueueService;
+}
+
+namespace Antares::Optimization
+{
+class SharedBases;
+}
+
 struct CORRESPONDANCES_DES_VARIABLES
 {
     // Avoid accidental copies
@@ -457,6 +467,7 @@ struct TIME_MEASURE
 {
     long solveTime = 0;
     long updateTime = 0;
+    long long iterations = 0;
 };
 
 using TIME_MEASURES = std::array<TIME_MEASURE, 2>;
@@ -534,6 +545,13 @@ struct PROBLEME_HEBDO
     bool ExportStructure = false;
     bool NamedProblems = false;
     bool exportSolutions = false;
+    // Threads on which independent problems of a week (daily problems, hourly curtailment
+    // sharing problems) can be solved in parallel (none by default)
+    std::shared_ptr<Yuni::Job::QueueService> threadPool;
+    // Solve the hourly curtailment sharing problems on threadPool
+    bool parallelCsrHours = false;
+    // Optimal bases shared with the other MC years (none by default)
+    std::shared_ptr<Antares::Optimization::SharedBases> basesSharedAcrossYears;
 
     uint32_t HeureDansLAnnee = 0;
     bool LeProblemeADejaEteInstancie = false;
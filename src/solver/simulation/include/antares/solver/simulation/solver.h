@@ -32,6 +32,7 @@
 #include "antares/solver/misc/options.h"
 #include "antares/solver/simulation/solver.data.h"
 #include "antares/solver/simulation/solver_utils.h"
+#include "antares/solver/simulation/years-scheduler.h"
 #include "antares/solver/variable/state.h"
 
 namespace Antares::Solver::Simulation
@@ -89,13 +90,11 @@ private:
     void regenerateTimeSeries(uint year);
 
     /*!
-    ** \brief Builds sets of parallel years
+    ** \brief Builds the list of years to run, and where time-series are regenerated
     **
-    ** \return The max number of years in a set of parallel years (to be executed or not)
+    ** Also counts the number of years actually performed.
     */
-    uint buildSetsOfParallelYears(uint firstYear,
-                                  uint endYear,
-                                  std::vector<setOfParallelYears>& setsOfParallelYears);
+    std::vector<scheduledYear> buildYearsSchedule(uint firstYear, uint endYear);
 
     /*!
     ** \brief Allocate storage for random numbers of parallel years
@@ -105,28 +104,40 @@ private:
     void allocateMemoryForRandomNumbers(randomNumbers& randomForParallelYears);
 
     /*!
-    ** \brief Computes random numbers for each years of a list
+    ** \brief Computes random numbers for a year
     **
-    ** \param	randomForYears	Storage for random numbers for years in the list
-    ** \param	years			List of years
+    ** Must be called for each year in increasing order, whether the year is performed or not,
+    ** so that random generators are drawn the same way whatever the playlist.
+    **
+    ** \param	randomForYear	Storage for random numbers of the year (if performed)
+    ** \param	year			The year
+    ** \param	isPerformed		Is the year actually run ?
     */
-    void computeRandomNumbers(randomNumbers& randomForYears,
-                              std::vector<uint>& years,
-                              std::map<unsigned int, bool>& isYearPerformed,
+    void computeRandomNumbers(yearRandomNumbers& randomForYear,
+                              uint year,
+                              bool isPerformed,
                               MersenneTwister& randomHydro);
 
     /*!
     ** \brief Computes statistics on annual (system and solution) costs, to be printed in output
     *into separate files
     **
-    ** Adds the contributions of each performed year contained in the current set to annual system
-    *and solution costs averages over all years.
+    ** Adds the contribution of a performed year to annual system and solution costs averages
+    ** over all years.
     ** These average costs are meant to be printed in output into separate files.
     ** Same thing for min and max costs over all years.
     ** Storing these costs to compute std deviation later.
     */
-    void computeAnnualCostsStatistics(std::vector<Variable::State>& state,
-                                      setOfParallelYears& batch);
+    void computeAnnualCostsStatistics(const Variable::State& state);
+
+    /*!
+    ** \brief Adds the results of a year which has ended to the synthesis
+    **
+    ** Years are committed in increasing order, so that the synthesis does not depend on the
+    ** order years end in.
+    */
+    void commitYear(const YearsScheduler::DispatchedYear& dispatched,
+                    const std::vector<Variable::State>& state);
 
     /*!
     ** \brief Iterate through all MC years
@@ -144,8 +155,6 @@ private:
     uint pNbMaxPerformedYearsInParallel;
     //! Year by year output results
     bool pYearByYear;
-    //! The first set of parallel year(s) with a performed year was already run ?
-    bool pFirstSetParallelWithAPerformedYearWasRun;
 
     //! Statistics about annual (system and solution) costs
     annualCostsStatistics pAnnualStatistics;
@@ -154,7 +163,7 @@ private:
     Benchmarking::DurationCollector& pDurationCollector;
 
 public:
-    //! The queue service that runs every set of parallel years
+    //! The queue service that runs the MC years
     std::shared_ptr<Yuni::Job::QueueService> pQueueService = nullptr;
     //! Result writer
     Antares::Solver::IResultWriter& pResultWriter;
@@ -21,6 +21,9 @@
 #ifndef __SOLVER_SIMULATION_SOLVER_HXX__
 #define __SOLVER_SIMULATION_SOLVER_HXX__
 
+#include <algorithm>
+#include <thread>
+
 #include <yuni/io/io.h>
 
 #include <antares/antares/fatal-error.h>
@@ -33,6 +36,7 @@
 #include "antares/solver/simulation/opt_time_writer.h"
 #include "antares/solver/simulation/timeseries-numbers.h"
 #include "antares/solver/ts-generator/generator.h"
+#include "antares/solver/utils/shared_bases.h"
 #include "antares/solver/variable/print.h"
 
 namespace Antares::Solver::Simulation
@@ -45,24 +49,23 @@ public:
     yearJob(ISimulation<Impl>* simulation,
             unsigned int pY,
             std::map<uint, bool>& pYearFailed,
-            std::map<uint, bool>& pIsFirstPerformedYearOfASet,
-            bool pFirstSetParallelWithAPerformedYearWasRun,
+            bool pIsFirstPerformedYearOfSimulation,
             unsigned int pNumSpace,
-            randomNumbers& pRandomForParallelYears,
+            yearRandomNumbers& pRandomForCurrentYear,
             bool pPerformCalculations,
             Data::Study& pStudy,
             std::vector<Variable::State>& pStates,
             bool pYearByYear,
             Benchmarking::DurationCollector& durationCollector,
             IResultWriter& resultWriter,
-            ISimulationObserver& simulationObserver):
+            ISimulationObserver& simulationObserver,
+            std::shared_ptr<Yuni::Job::QueueService> nestedThreadPool):
         simulation_(simulation),
         y(pY),
         yearFailed(pYearFailed),
-        isFirstPerformedYearOfASet(pIsFirstPerformedYearOfASet),
-        firstSetParallelWithAPerformedYearWasRun(pFirstSetParallelWithAPerformedYearWasRun),
+        isFirstPerformedYearOfSimulation(pIsFirstPerformedYearOfSimulation),
         numSpace(pNumSpace),
-        randomForParallelYears(pRandomForParallelYears),
+        randomForCurrentYear(pRandomForCurrentYear),
         performCalculations(pPerformCalculations),
         study(pStudy),
         states(pStates),
@@ -70,7 +73,12 @@ public:
         pDurationCollector(durationCollector),
         pResultWriter(resultWriter),
         simulationObserver_(simulationObserver),
-        hydroManagement(study.areas, study.parameters, study.calendar, resultWriter)
+        nestedThreadPool(nestedThreadPool),
+        hydroManagement(study.areas,
+                        study.parameters,
+                        study.calendar,
+                        resultWriter,
+                        nestedThreadPool)
     {
     }
 
@@ -82,10 +90,9 @@ private:
     ISimulation<Impl>* simulation_;
     unsigned int y;
     std::map<uint, bool>& yearFailed;
-    std::map<uint, bool>& isFirstPerformedYearOfASet;
-    bool firstSetParallelWithAPerformedYearWasRun;
+    bool isFirstPerformedYearOfSimulation;
     unsigned int numSpace;
-    randomNumbers& randomForParallelYears;
+    yearRandomNumbers& randomForCurrentYear;
     bool performCalculations;
     Data::Study& study;
     std::vector<Variable::State>& states;
@@ -93,6 +100,8 @@ private:
     Benchmarking::DurationCollector& pDurationCollector;
     IResultWriter& pResultWriter;
     std::reference_wrapper<ISimulationObserver> simulationObserver_;
+    //! Threads left by the years running in parallel, if any
+    std::shared_ptr<Yuni::Job::QueueService> nestedThreadPool;
     HydroManagement hydroManagement;
 
 private:
@@ -136,12 +145,6 @@ public:
 
         if (performCalculations)
         {
-            // Index of the current year in the list of structures
-            uint indexYear = randomForParallelYears.yearNumberToIndex[y];
-
-            // Getting random tables for this year
-            yearRandomNumbers& randomForCurrentYear = randomForParallelYears.pYears[indexYear];
-
             // 1 - Applying random levels for current year
             auto randomReservoirLevel = randomForCurrentYear.pReservoirLevels;
 
@@ -158,25 +161,29 @@ public:
             // Updating the state
             auto& state = states[numSpace];
             state.year = y;
+            if (state.problemeHebdo
+                && (study.parameters.optOptions.parallelDailyProblems
+                    || study.parameters.optOptions.parallelCsrHours))
+            {
+                state.problemeHebdo->threadPool = nestedThreadPool;
+            }
 
             // 5 - Resetting all variables for the output
             simulation_->variables.yearBegin(y, numSpace);
 
             // 6 - The Solver itself
-            bool isFirstPerformedYearOfSimulation = isFirstPerformedYearOfASet[y]
-                                                    && not firstSetParallelWithAPerformedYearWasRun;
             std::list<uint> failedWeekList;
 
-            OptimizationStatisticsWriter optWriter(pResultWriter, y);
-            yearFailed[y] = !simulation_->year(progression,
-                                               state,
-                                               numSpace,
-                                               randomForCurrentYear,
-                                               failedWeekList,
-                                               isFirstPerformedYearOfSimulation,
-                                               hydroManagement.ventilationResults(),
-                                               optWriter,
-                                               scratchmap);
+            OptimizationStatisticsWriter optWriter(pResultWriter, y, pDurationCollector);
+            yearFailed.at(y) = !simulation_->year(progression,
+                                                 state,
+                                                 numSpace,
+                                                 randomForCurrentYear,
+                                                 failedWeekList,
+                                                 isFirstPerformedYearOfSimulation,
+                                                 hydroManagement.ventilationResults(),
+                                                 optWriter,
+                                                 scratchmap);
 
             // Log failing weeks
             logFailedWeek(y, study, failedWeekList);
@@ -211,7 +218,7 @@ public:
 
             logs.info() << "  playlist: ignoring the year " << (y + 1);
 
-            yearFailed[y] = false;
+            yearFailed.at(y) = false;
 
         } // End if(performCalculations)
 
@@ -231,7 +238,6 @@ inline ISimulation<ImplementationType>::ISimulation(
     pNbYearsReallyPerformed(0),
     pNbMaxPerformedYearsInParallel(0),
     pYearByYear(study.parameters.yearByYear),
-    pFirstSetParallelWithAPerformedYearWasRun(false),
     pDurationCollector(duration_collector),
     pQueueService(study.pQueueService),
     pResultWriter(resultWriter),
@@ -447,9 +453,11 @@ void ISimulation<ImplementationType>::regenerateTimeSeries(uint year)
         if (refreshTSonCurrentYear)
         {
             auto clusters = getAllClustersToGen(study.areas, pData.haveToRefreshTSThermal);
+            // No year is in flight here : clusters are generated on the years thread pool
             generateThermalTimeSeries(study,
                                       clusters,
-                                      study.runtime.random[Data::seedTsGenThermal]);
+                                      study.runtime.random[Data::seedTsGenThermal],
+                                      pQueueService);
 
             bool archive = study.parameters.timeSeriesToArchive & Data::timeSeriesThermal;
             bool doWeWrite = archive && !study.parameters.noOutput;
@@ -470,29 +478,18 @@ void ISimulation<ImplementationType>::regenerateTimeSeries(uint year)
 }
 
 template<class ImplementationType>
-uint ISimulation<ImplementationType>::buildSetsOfParallelYears(
-  uint firstYear,
-  uint endYear,
-  std::vector<setOfParallelYears>& setsOfParallelYears)
+std::vector<scheduledYear> ISimulation<ImplementationType>::buildYearsSchedule(uint firstYear,
+                                                                               uint endYear)
 {
     // Filter on the years
     const auto& yearsFilter = study.parameters.yearsFilter;
 
-    // number max of years (to be executed or not) in a set of parallel years
-    uint maxNbYearsPerformed = 0;
-
-    setOfParallelYears* set = nullptr;
-    bool buildNewSet = true;
-    bool foundFirstPerformedYearOfCurrentSet = false;
+    std::vector<scheduledYear> schedule;
+    schedule.reserve(endYear - firstYear);
 
-    // Gets information on each parallel years set
     for (uint y = firstYear; y < endYear; ++y)
     {
-        unsigned int indexSpace = 999999;
-        bool performCalculations = yearsFilter[y];
-
-        // Do we refresh just before this year ? If yes a new set of parallel years has to be
-        // created
+        // Do we refresh just before this year ?
         bool refreshing = false;
         refreshing = pData.haveToRefreshTSLoad && (y % pData.refreshIntervalLoad == 0);
         refreshing = refreshing
@@ -509,83 +506,18 @@ uint ISimulation<ImplementationType>::buildSetsOfParallelYears(
         refreshing = refreshing
                      || (haveToRefreshTSThermal && (y % pData.refreshIntervalThermal == 0));
 
-        // We build a new set of parallel years if one of these conditions is fulfilled :
-        //	- We have to refresh (or regenerate) some or all time series before running the
-        //    current year
-        //	- This is the first year (to be executed or not) after the previous set is full with
-        //    years to be executed. That is : in the previous set filled, the max number of
-        //    years to be actually run is reached.
-        buildNewSet = buildNewSet || refreshing;
-
-        if (buildNewSet)
-        {
-            setOfParallelYears setToCreate;
-            setsOfParallelYears.push_back(setToCreate);
-            set = &(setsOfParallelYears.back());
-
-            // Initializations
-            set->nbPerformedYears = 0;
-            set->nbYears = 0;
-            set->regenerateTS = false;
-            set->yearForTSgeneration = 999999;
-
-            // In case we have to regenerate times series before run the current set of parallel
-            // years
-            if (refreshing)
-            {
-                set->regenerateTS = true;
-                set->yearForTSgeneration = y;
-            }
-        }
-
-        set->yearsIndices.push_back(y);
-        set->nbYears++;
-        set->yearFailed[y] = true;
-        set->isFirstPerformedYearOfASet[y] = false;
-
+        bool performCalculations = yearsFilter[y];
         if (performCalculations)
         {
             // Another year performed
             ++pNbYearsReallyPerformed;
-
-            // Number of actually performed years in the current set (up to now).
-            set->nbPerformedYears++;
-            // Index of the MC year's space (useful if this year is actually run)
-            indexSpace = set->nbPerformedYears - 1;
-
-            set->isYearPerformed[y] = true;
-            set->performedYearToSpace[y] = indexSpace;
-            set->spaceToPerformedYear[indexSpace] = y;
-
-            if (!foundFirstPerformedYearOfCurrentSet)
-            {
-                set->isFirstPerformedYearOfASet[y] = true;
-                foundFirstPerformedYearOfCurrentSet = true;
-            }
-        }
-        else
-        {
-            set->isYearPerformed[y] = false;
-        }
-
-        // Do we build a new set at next iteration (for years to be executed or not) ?
-        if (indexSpace == pNbMaxPerformedYearsInParallel - 1 || y == endYear - 1)
-        {
-            buildNewSet = true;
-            foundFirstPerformedYearOfCurrentSet = false;
-            if (set->nbPerformedYears > maxNbYearsPerformed)
-            {
-                maxNbYearsPerformed = set->nbPerformedYears;
-            }
-        }
-        else
-        {
-            buildNewSet = false;
         }
 
-    } // End of loop over years
+        schedule.push_back(
+          {.year = y, .isPerformed = performCalculations, .regenerateTS = refreshing});
+    }
 
-    return maxNbYearsPerformed;
+    return schedule;
 }
 
 template<class ImplementationType>
@@ -648,279 +580,242 @@ void ISimulation<ImplementationType>::allocateMemoryForRandomNumbers(
 }
 
 template<class ImplementationType>
-void ISimulation<ImplementationType>::computeRandomNumbers(
-  randomNumbers& randomForYears,
-  std::vector<uint>& years,
-  std::map<unsigned int, bool>& isYearPerformed,
-  MersenneTwister& randomHydroGenerator)
+void ISimulation<ImplementationType>::computeRandomNumbers(yearRandomNumbers& randomForYear,
+                                                           uint y,
+                                                           bool isPerformed,
+                                                           MersenneTwister& randomHydroGenerator)
 {
-    uint indexYear = 0;
-    std::vector<unsigned int>::iterator ity;
+    // General
+    const unsigned int nbAreas = study.areas.size();
 
-    for (ity = years.begin(); ity != years.end(); ++ity)
+    // ... Thermal noise ...
+    for (unsigned int a = 0; a != nbAreas; ++a)
     {
-        uint y = *ity;
-        bool isPerformed = isYearPerformed[y];
-        if (isPerformed)
-        {
-            randomForYears.yearNumberToIndex[y] = indexYear;
-        }
-
-        // General
-        const unsigned int nbAreas = study.areas.size();
+        // logs.info() << "   area : " << a << " :";
+        const auto& area = *(study.areas.byIndex[a]);
 
-        // ... Thermal noise ...
-        for (unsigned int a = 0; a != nbAreas; ++a)
+        for (auto& cluster: area.thermal.list.all())
         {
-            // logs.info() << "   area : " << a << " :";
-            const auto& area = *(study.areas.byIndex[a]);
-
-            for (auto& cluster: area.thermal.list.all())
+            uint clusterIndex = cluster->areaWideIndex;
+            double thermalNoise = study.runtime.random[Data::seedThermalCosts].next();
+            if (isPerformed)
             {
-                uint clusterIndex = cluster->areaWideIndex;
-                double thermalNoise = study.runtime.random[Data::seedThermalCosts].next();
-                if (isPerformed)
-                {
-                    randomForYears.pYears[indexYear].pThermalNoisesByArea[a][clusterIndex]
-                      = thermalNoise;
-                }
+                randomForYear.pThermalNoisesByArea[a][clusterIndex] = thermalNoise;
             }
         }
+    }
 
-        // ... Reservoir levels ...
-        uint areaIndex = 0;
-        study.areas.each(
-          [&areaIndex, &indexYear, &randomForYears, &randomHydroGenerator, &y, &isPerformed, this](
-            Data::Area& area)
+    // ... Reservoir levels ...
+    uint areaIndex = 0;
+    study.areas.each(
+      [&areaIndex, &randomForYear, &randomHydroGenerator, &y, &isPerformed, this](Data::Area& area)
+      {
+          // looking for the initial reservoir level (begining of the year)
+          auto& min = area.hydro.reservoirLevel[Data::PartHydro::minimum];
+          auto& avg = area.hydro.reservoirLevel[Data::PartHydro::average];
+          auto& max = area.hydro.reservoirLevel[Data::PartHydro::maximum];
+
+          // Month the reservoir level is initialized according to.
+          // This month number is given in the civil calendar, from january to december (0 is
+          // january).
+          int initResLevelOnMonth = area.hydro.initializeReservoirLevelDate;
+
+          // Conversion of the previous month into simulation calendar
+          int initResLevelOnSimMonth = study.calendar.mapping.months[initResLevelOnMonth];
+
+          // Previous month's first day in the year
+          int firstDayOfMonth = study.calendar.months[initResLevelOnSimMonth].daysYear.first;
+
+          double randomLevel = randomReservoirLevel(min[firstDayOfMonth],
+                                                    avg[firstDayOfMonth],
+                                                    max[firstDayOfMonth],
+                                                    randomHydroGenerator);
+
+          // Possibly update the intial level from scenario builder
+          if (study.parameters.useCustomScenario)
           {
-              // looking for the initial reservoir level (begining of the year)
-              auto& min = area.hydro.reservoirLevel[Data::PartHydro::minimum];
-              auto& avg = area.hydro.reservoirLevel[Data::PartHydro::average];
-              auto& max = area.hydro.reservoirLevel[Data::PartHydro::maximum];
-
-              // Month the reservoir level is initialized according to.
-              // This month number is given in the civil calendar, from january to december (0 is
-              // january).
-              int initResLevelOnMonth = area.hydro.initializeReservoirLevelDate;
-
-              // Conversion of the previous month into simulation calendar
-              int initResLevelOnSimMonth = study.calendar.mapping.months[initResLevelOnMonth];
-
-              // Previous month's first day in the year
-              int firstDayOfMonth = study.calendar.months[initResLevelOnSimMonth].daysYear.first;
-
-              double randomLevel = randomReservoirLevel(min[firstDayOfMonth],
-                                                        avg[firstDayOfMonth],
-                                                        max[firstDayOfMonth],
-                                                        randomHydroGenerator);
-
-              // Possibly update the intial level from scenario builder
-              if (study.parameters.useCustomScenario)
-              {
-                  double levelFromScenarioBuilder = study.scenarioInitialHydroLevels[areaIndex][y];
-                  if (levelFromScenarioBuilder >= 0.)
-                  {
-                      randomLevel = levelFromScenarioBuilder;
-                  }
-              }
-
-              // Current area's hydro starting (or initial) level computation
-              // (no matter if the year is performed or not, we always draw a random initial
-              // reservoir level to ensure the same results)
-              if (isPerformed)
+              double levelFromScenarioBuilder = study.scenarioInitialHydroLevels[areaIndex][y];
+              if (levelFromScenarioBuilder >= 0.)
               {
-                  randomForYears.pYears[indexYear].pReservoirLevels[areaIndex] = randomLevel;
+                  randomLevel = levelFromScenarioBuilder;
               }
+          }
 
-              areaIndex++;
-          }); // each area
-
-        // ... Unsupplied and spilled energy costs noises (french : bruits sur la defaillance
-        // positive et negatives) ... references to the random number generators
-        auto& randomUnsupplied = study.runtime.random[Data::seedUnsuppliedEnergyCosts];
-        auto& randomSpilled = study.runtime.random[Data::seedSpilledEnergyCosts];
-
-        int currentSpilledEnergySeed = study.parameters.seed[Data::seedSpilledEnergyCosts];
-        int defaultSpilledEnergySeed = Data::antaresSeedDefaultValue
-                                       + Data::seedSpilledEnergyCosts * Data::antaresSeedIncrement;
-        bool SpilledEnergySeedIsDefault = (currentSpilledEnergySeed == defaultSpilledEnergySeed);
-        areaIndex = 0;
-        study.areas.each(
-          [&isPerformed,
-           &areaIndex,
-           &randomUnsupplied,
-           &randomSpilled,
-           &randomForYears,
-           &indexYear,
-           &SpilledEnergySeedIsDefault](Data::Area& area)
+          // Current area's hydro starting (or initial) level computation
+          // (no matter if the year is performed or not, we always draw a random initial
+          // reservoir level to ensure the same results)
+          if (isPerformed)
+          {
+              randomForYear.pReservoirLevels[areaIndex] = randomLevel;
+          }
+
+          areaIndex++;
+      }); // each area
+
+    // ... Unsupplied and spilled energy costs noises (french : bruits sur la defaillance
+    // positive et negatives) ... references to the random number generators
+    auto& randomUnsupplied = study.runtime.random[Data::seedUnsuppliedEnergyCosts];
+    auto& randomSpilled = study.runtime.random[Data::seedSpilledEnergyCosts];
+
+    int currentSpilledEnergySeed = study.parameters.seed[Data::seedSpilledEnergyCosts];
+    int defaultSpilledEnergySeed = Data::antaresSeedDefaultValue
+                                   + Data::seedSpilledEnergyCosts * Data::antaresSeedIncrement;
+    bool SpilledEnergySeedIsDefault = (currentSpilledEnergySeed == defaultSpilledEnergySeed);
+    areaIndex = 0;
+    study.areas.each(
+      [&isPerformed,
+       &areaIndex,
+       &randomUnsupplied,
+       &randomSpilled,
+       &randomForYear,
+       &SpilledEnergySeedIsDefault](Data::Area& area)
+      {
+          (void)area; // Avoiding warnings at compilation (unused variable) on linux
+          if (isPerformed)
           {
-              (void)area; // Avoiding warnings at compilation (unused variable) on linux
-              if (isPerformed)
+              double randomNumber = randomUnsupplied();
+              randomForYear.pUnsuppliedEnergy[areaIndex] = randomNumber;
+              randomForYear.pSpilledEnergy[areaIndex] = randomNumber;
+              if (!SpilledEnergySeedIsDefault)
               {
-                  double randomNumber = randomUnsupplied();
-                  randomForYears.pYears[indexYear].pUnsuppliedEnergy[areaIndex] = randomNumber;
-                  randomForYears.pYears[indexYear].pSpilledEnergy[areaIndex] = randomNumber;
-                  if (!SpilledEnergySeedIsDefault)
-                  {
-                      randomForYears.pYears[indexYear].pSpilledEnergy[areaIndex] = randomSpilled();
-                  }
+                  randomForYear.pSpilledEnergy[areaIndex] = randomSpilled();
               }
-              else
+          }
+          else
+          {
+              randomUnsupplied();
+              if (!SpilledEnergySeedIsDefault)
               {
-                  randomUnsupplied();
-                  if (!SpilledEnergySeedIsDefault)
-                  {
-                      randomSpilled();
-                  }
+                  randomSpilled();
               }
+          }
 
-              areaIndex++;
-          }); // each area
+          areaIndex++;
+      }); // each area
 
-        // ... Hydro costs noises ...
-        auto& randomHydro = study.runtime.random[Data::seedHydroCosts];
+    // ... Hydro costs noises ...
+    auto& randomHydro = study.runtime.random[Data::seedHydroCosts];
 
-        Data::PowerFluctuations powerFluctuations = study.parameters.power.fluctuations;
-        switch (powerFluctuations)
-        {
-        case Data::lssFreeModulations:
-        {
-            areaIndex = 0;
-            auto end = study.areas.end();
+    Data::PowerFluctuations powerFluctuations = study.parameters.power.fluctuations;
+    switch (powerFluctuations)
+    {
+    case Data::lssFreeModulations:
+    {
+        areaIndex = 0;
+        auto end = study.areas.end();
 
-            // Computing hourly hydro costs noises so that they are homogeneously spread into :
-            // [-1.e-3, -5*1.e-4] U [+5*1.e-4, +1.e-3]
-            if (isPerformed)
+        // Computing hourly hydro costs noises so that they are homogeneously spread into :
+        // [-1.e-3, -5*1.e-4] U [+5*1.e-4, +1.e-3]
+        if (isPerformed)
+        {
+            for (auto i = study.areas.begin(); i != end; ++i)
             {
-                for (auto i = study.areas.begin(); i != end; ++i)
+                auto& noise = randomForYear.pHydroCostsByArea_freeMod[areaIndex];
+                std::set<hydroCostNoise, compareHydroCostsNoises> setHydroCostsNoises;
+                for (uint j = 0; j != 8784; ++j)
                 {
-                    auto& noise = randomForYears.pYears[indexYear]
-                                    .pHydroCostsByArea_freeMod[areaIndex];
-                    std::set<hydroCostNoise, compareHydroCostsNoises> setHydroCostsNoises;
-                    for (uint j = 0; j != 8784; ++j)
-                    {
-                        noise[j] = randomHydro();
-                        noise[j] -= 0.5; // Now we have : -0.5 < noise[j] < +0.5
+                    noise[j] = randomHydro();
+                    noise[j] -= 0.5; // Now we have : -0.5 < noise[j] < +0.5
 
-                        // This std::set naturally sorts the hydro costs noises into increasing
-                        // absolute values order
-                        setHydroCostsNoises.insert(hydroCostNoise(noise[j], j));
-                    }
+                    // This std::set naturally sorts the hydro costs noises into increasing
+                    // absolute values order
+                    setHydroCostsNoises.insert(hydroCostNoise(noise[j], j));
+                }
 
-                    uint rank = 0;
-                    std::set<hydroCostNoise, compareHydroCostsNoises>::iterator it;
-                    for (it = setHydroCostsNoises.begin(); it != setHydroCostsNoises.end(); it++)
+                uint rank = 0;
+                std::set<hydroCostNoise, compareHydroCostsNoises>::iterator it;
+                for (it = setHydroCostsNoises.begin(); it != setHydroCostsNoises.end(); it++)
+                {
+                    uint index = it->getIndex();
+                    double value = it->getValue();
+
+                    if (value < 0.)
                     {
-                        uint index = it->getIndex();
-                        double value = it->getValue();
-
-                        if (value < 0.)
-                        {
-                            noise[index] = -5 * 1.e-4 * (1 + rank / 8784.);
-                        }
-                        else
-                        {
-                            noise[index] = 5 * 1.e-4 * (1 + rank / 8784.);
-                        }
-
-                        rank++;
+                        noise[index] = -5 * 1.e-4 * (1 + rank / 8784.);
                     }
-
-                    areaIndex++;
-                }
-            }
-            else
-            {
-                for (auto i = study.areas.begin(); i != end; ++i)
-                {
-                    for (uint j = 0; j != 8784; ++j)
+                    else
                     {
-                        randomHydro();
+                        noise[index] = 5 * 1.e-4 * (1 + rank / 8784.);
                     }
+
+                    rank++;
                 }
-            }
 
-            break;
+                areaIndex++;
+            }
         }
-
-        case Data::lssMinimizeRamping:
-        case Data::lssMinimizeExcursions:
+        else
         {
-            areaIndex = 0;
-            auto end = study.areas.end();
             for (auto i = study.areas.begin(); i != end; ++i)
             {
-                if (isPerformed)
-                {
-                    randomForYears.pYears[indexYear].pHydroCosts_rampingOrExcursion[areaIndex]
-                      = randomHydro();
-                }
-                else
+                for (uint j = 0; j != 8784; ++j)
                 {
                     randomHydro();
                 }
-
-                areaIndex++;
             }
-            break;
-        }
-
-        case Data::lssUnknown:
-        {
-            logs.error() << "Power fluctuation unknown";
-            break;
         }
 
-        } // end of switch
+        break;
+    }
 
-        if (isPerformed)
+    case Data::lssMinimizeRamping:
+    case Data::lssMinimizeExcursions:
+    {
+        areaIndex = 0;
+        auto end = study.areas.end();
+        for (auto i = study.areas.begin(); i != end; ++i)
         {
-            indexYear++;
+            if (isPerformed)
+            {
+                randomForYear.pHydroCosts_rampingOrExcursion[areaIndex] = randomHydro();
+            }
+            else
+            {
+                randomHydro();
+            }
+
+            areaIndex++;
         }
+        break;
+    }
 
-    } // End loop over years
+    case Data::lssUnknown:
+    {
+        logs.error() << "Power fluctuation unknown";
+        break;
+    }
+
+    } // end of switch
 } // End function
 
 template<class ImplementationType>
-void ISimulation<ImplementationType>::computeAnnualCostsStatistics(
-  std::vector<Variable::State>& state,
-  setOfParallelYears& batch)
+void ISimulation<ImplementationType>::computeAnnualCostsStatistics(const Variable::State& s)
 {
-    // Loop over years contained in the set
-    for (auto y: batch.yearsIndices)
-    {
-        if (batch.isYearPerformed[y])
-        {
-            // Get space number associated to the performed year
-            uint numSpace = batch.performedYearToSpace[y];
-            const Variable::State& s = state[numSpace];
-            pAnnualStatistics.systemCost.addCost(s.annualSystemCost);
-            pAnnualStatistics.criterionCost1.addCost(s.optimalSolutionCost1);
-            pAnnualStatistics.criterionCost2.addCost(s.optimalSolutionCost2);
-            pAnnualStatistics.optimizationTime1.addCost(s.averageOptimizationTime1);
-            pAnnualStatistics.optimizationTime2.addCost(s.averageOptimizationTime2);
-            pAnnualStatistics.updateTime.addCost(s.averageUpdateTime);
-        }
-    }
+    pAnnualStatistics.systemCost.addCost(s.annualSystemCost);
+    pAnnualStatistics.criterionCost1.addCost(s.optimalSolutionCost1);
+    pAnnualStatistics.criterionCost2.addCost(s.optimalSolutionCost2);
+    pAnnualStatistics.optimizationTime1.addCost(s.averageOptimizationTime1);
+    pAnnualStatistics.optimizationTime2.addCost(s.averageOptimizationTime2);
+    pAnnualStatistics.updateTime.addCost(s.averageUpdateTime);
 }
 
-static inline void logPerformedYearsInAset(setOfParallelYears& set)
+template<class ImplementationType>
+void ISimulation<ImplementationType>::commitYear(const YearsScheduler::DispatchedYear& dispatched,
+                                                 const std::vector<Variable::State>& state)
 {
-    logs.info() << "parallel batch size : " << set.nbYears << " (" << set.nbPerformedYears
-                << " perfomed)";
+    std::map<unsigned int, unsigned int> numSpaceToYear{{dispatched.numSpace, dispatched.year}};
 
-    std::string performedYearsToLog = "";
+    // Computing the summary : adding the contribution of the MC year
+    ImplementationType::variables.computeSummary(numSpaceToYear, 1);
 
-    std::ranges::for_each(set.yearsIndices,
-                          [&set, &performedYearsToLog](const uint& y)
-                          {
-                              if (set.isYearPerformed[y])
-                              {
-                                  performedYearsToLog += std::to_string(y + 1) + " ";
-                              }
-                          });
+    // Computing summary of spatial aggregations
+    ImplementationType::variables.computeSpatialAggregatesSummary(ImplementationType::variables,
+                                                                  numSpaceToYear,
+                                                                  1);
 
-    logs.info() << "Year(s) " << performedYearsToLog;
+    // Computes statistics on annual (system and solution) costs, to be printed in output into
+    // separate files
+    computeAnnualCostsStatistics(state[dispatched.numSpace]);
 }
 
 template<class ImplementationType>
@@ -934,147 +829,252 @@ void ISimulation<ImplementationType>::loopThroughYears(uint firstYear,
     MersenneTwister randomHydroGenerator;
     randomHydroGenerator.reset(study.parameters.seed[Data::seedHydroManagement]);
 
-    // List of parallel years sets
-    std::vector<setOfParallelYears> setsOfParallelYears;
+    // Years to run, in increasing order. Also counts the number of years really performed.
+    std::vector<scheduledYear> schedule = buildYearsSchedule(firstYear, endYear);
 
-    // Gets information on each set of parallel years and returns the max number of years performed
-    // in a set The variable "maxNbYearsPerformedInAset" is the maximum numbers of years to be
-    // actually executed in a set. A set contains some years to be actually executed (at most
-    // "pNbMaxPerformedYearsInParallel" years) and some others to skip.
-    uint maxNbYearsPerformedInAset = buildSetsOfParallelYears(firstYear,
-                                                              endYear,
-                                                              setsOfParallelYears);
     // Related to annual costs statistics (printed in output into separate files)
     pAnnualStatistics.setNbPerformedYears(pNbYearsReallyPerformed);
 
-    // Container for random numbers of parallel years (to be executed or not)
-    randomNumbers randomForParallelYears(maxNbYearsPerformedInAset,
+    // Container for random numbers of the years running in parallel (one per space)
+    randomNumbers randomForParallelYears(pNbMaxPerformedYearsInParallel,
                                          study.parameters.power.fluctuations);
 
     // Allocating memory to store random numbers of all parallel years
     allocateMemoryForRandomNumbers(randomForParallelYears);
 
-    // Number of threads to perform the jobs waiting in the queue
-    pQueueService->maximumThreadCount(pNbMaxPerformedYearsInParallel);
+    // Number of threads to perform the jobs waiting in the queue : one per year running. The
+    // other spaces keep the results of the years waiting for older ones to be committed.
+    const uint nbYearsRunning = std::clamp(study.maxNbYearsRunning,
+                                           1u,
+                                           pNbMaxPerformedYearsInParallel);
+    pQueueService->maximumThreadCount(nbYearsRunning);
+
+    // The cores left by the years running in parallel are used to optimize the hydro
+    // allocation of the areas of each year, and the daily problems of each week
+    std::shared_ptr<Yuni::Job::QueueService> nestedQueueService;
+    const uint nbCores = study.getNumberOfCoresPerMode(std::thread::hardware_concurrency(),
+                                                       study.parameters.nbCores.ncMode);
+    const uint nbNestedThreads = study.nbNestedThreads > 0 ? study.nbNestedThreads
+                                                           : std::max(1u, nbCores / nbYearsRunning);
+    if (nbNestedThreads > 1)
+    {
+        nestedQueueService = std::make_shared<Yuni::Job::QueueService>();
+        nestedQueueService->maximumThreadCount(nbNestedThreads);
+        nestedQueueService->start();
+        logs.info() << " Hydro allocation of the areas performed on " << nbNestedThreads
+                    << " threads";
+        if (study.parameters.optOptions.parallelDailyProblems)
+        {
+            logs.info() << " Daily problems of each week solved on " << nbNestedThreads
+                        << " threads";
+        }
+        if (study.parameters.optOptions.parallelCsrHours)
+        {
+            logs.info() << " Curtailment sharing problems of each week solved on "
+                        << nbNestedThreads << " threads";
+        }
+    }
+
+    // The same weeks of the years running in parallel start from each other's bases. Useless
+    // when the solver does not start from a given basis : it would only copy them.
+    const auto& optOptions = study.parameters.optOptions;
+    if (optOptions.shareBasesAcrossYears && !optOptions.solverSupportsWarmStart())
+    {
+        logs.warning() << " The solver " << optOptions.ortoolsSolver
+                       << " does not start from a given basis : --share-bases-across-years has"
+                       << " no effect";
+    }
+    else if (optOptions.shareBasesAcrossYears)
+    {
+        auto sharedBases = std::make_shared<Antares::Optimization::SharedBases>();
+        for (auto& stateOfSpace: state)
+        {
+            if (stateOfSpace.problemeHebdo)
+            {
+                stateOfSpace.problemeHebdo->basesSharedAcrossYears = sharedBases;
+            }
+        }
+    }
     HydroInputsChecker hydroInputsChecker(study);
 
     logs.info() << " Doing hydro validation";
 
-    // Loop over sets of parallel years to check hydro inputs
-    for (const auto& batch: setsOfParallelYears)
+    // Check hydro inputs of the years run before the first time-series regeneration
+    for (const auto& scheduled: schedule)
     {
-        if (batch.regenerateTS)
+        if (scheduled.regenerateTS)
         {
             break;
         }
-        for (auto year: batch.yearsIndices)
-        {
-            hydroInputsChecker.Execute(year);
-        }
+        hydroInputsChecker.Execute(scheduled.year);
     }
     hydroInputsChecker.CheckForErrors();
 
     logs.info() << " Starting the simulation";
 
-    // Loop over sets of parallel years to run the simulation
-    for (auto& batch: setsOfParallelYears)
+    // Failure status of each year. All keys are inserted here, so that jobs can
+    // update their own year concurrently.
+    std::map<uint, bool> yearFailed;
+    for (const auto& scheduled: schedule)
+    {
+        yearFailed[scheduled.year] = true;
+    }
+
+    YearsScheduler scheduler(pNbMaxPerformedYearsInParallel, nbYearsRunning);
+    std::map<uint, Concurrency::TaskFuture> results;
+    bool firstPerformedYearWasDispatched = false;
+
+    // Waits for the oldest year in flight and merges its results into the synthesis
+    auto commitOldestYear = [this, &scheduler, &results, &yearFailed, &state]()
     {
-        // 1 - We may want to regenerate the time-series this year.
-        // This is the case when the preprocessors are enabled from the
-        // interface and/or the refresh is enabled.
-        if (batch.regenerateTS)
+        auto dispatched = scheduler.popOldestYear();
+
+        auto result = results.extract(dispatched.year);
+        result.mapped().get(); // Re-throws any exception raised by the year job
+
+        // If a year has not found any solution, we stop everything
+        if (yearFailed.at(dispatched.year))
         {
-            regenerateTimeSeries(batch.yearForTSgeneration);
+            std::ostringstream msg;
+            msg << "Year " << dispatched.year + 1 << " has failed.";
+            throw FatalError(msg.str());
         }
-        computeRandomNumbers(randomForParallelYears,
-                             batch.yearsIndices,
-                             batch.isYearPerformed,
-                             randomHydroGenerator);
-
-        bool yearPerformed = false;
-        Concurrency::FutureSet results;
-        for (auto y: batch.yearsIndices)
+
+        commitYear(dispatched, state);
+    };
+
+    // Waits for all years in flight : required before time-series are regenerated, since
+    // these years use the current time-series
+    auto commitAllYears = [this, &scheduler, &commitOldestYear]()
+    {
+        while (scheduler.hasYearsInFlight())
         {
+            commitOldestYear();
+        }
+        pQueueService->wait(Yuni::qseIdle);
+        pQueueService->stop();
+        pResultWriter.flush();
+    };
+
+    try
+    {
+        for (const auto& scheduled: schedule)
+        {
+            const uint y = scheduled.year;
+
+            // 1 - We may want to regenerate the time-series this year.
+            // This is the case when the preprocessors are enabled from the
+            // interface and/or the refresh is enabled.
+            if (scheduled.regenerateTS)
+            {
+                commitAllYears();
+                regenerateTimeSeries(y);
+            }
+
             // for each year not handled earlier
             hydroInputsChecker.Execute(y);
             hydroInputsChecker.CheckForErrors();
 
-            bool performCalculations = batch.isYearPerformed[y];
-            unsigned int numSpace = 999999;
-            if (performCalculations)
+            if (!scheduled.isPerformed)
+            {
+                // Random numbers are drawn for skipped years too, to ensure the same results
+                computeRandomNumbers(randomForParallelYears.pYears[0],
+                                     y,
+                                     false,
+                                     randomHydroGenerator);
+                yearJob<ImplementationType> skippedYear(this,
+                                                        y,
+                                                        yearFailed,
+                                                        false,
+                                                        0,
+                                                        randomForParallelYears.pYears[0],
+                                                        false,
+                                                        study,
+                                                        state,
+                                                        pYearByYear,
+                                                        pDurationCollector,
+                                                        pResultWriter,
+                                                        simulationObserver_.get(),
+                                                        nestedQueueService);
+                skippedYear();
+                continue;
+            }
+
+            // Commit the years which have already ended, then wait for a free space and for a
+            // thread. A year ending before older ones frees its thread, not its space.
+            while (scheduler.oldestYearHasEnded())
+            {
+                commitOldestYear();
+            }
+            while (!scheduler.hasFreeSpace())
             {
-                yearPerformed = true;
-                numSpace = batch.performedYearToSpace[y];
+                commitOldestYear();
             }
+            scheduler.waitForIdleThread();
 
-            // If the year has not to be rerun, we skip the computation of the year.
-            // Note that, when we enter for the first time in the "for" loop, all years of the set
-            // have to be rerun (meaning : they must be run once). if(!batch.yearFailed[y])
-            // continue;
+            unsigned int numSpace = scheduler.dispatch(y);
+            auto& randomForCurrentYear = randomForParallelYears.pYears[numSpace];
+            randomForCurrentYear.reset();
+            computeRandomNumbers(randomForCurrentYear, y, true, randomHydroGenerator);
 
-            auto task = std::make_shared<yearJob<ImplementationType>>(
+            auto job = std::make_shared<yearJob<ImplementationType>>(
               this,
               y,
-              batch.yearFailed,
-              batch.isFirstPerformedYearOfASet,
-              pFirstSetParallelWithAPerformedYearWasRun,
+              yearFailed,
+              !firstPerformedYearWasDispatched,
               numSpace,
-              randomForParallelYears,
-              performCalculations,
+              randomForCurrentYear,
+              true,
               study,
               state,
               pYearByYear,
               pDurationCollector,
               pResultWriter,
-              simulationObserver_.get());
-            results.add(Concurrency::AddTask(*pQueueService, task));
-        } // End loop over years of the current set of parallel years
-
-        logPerformedYearsInAset(batch);
-
-        pQueueService->start();
+              simulationObserver_.get(),
+              nestedQueueService);
+            firstPerformedYearWasDispatched = true;
 
-        pQueueService->wait(Yuni::qseIdle);
-        pQueueService->stop();
-        results.join();
-        pResultWriter.flush();
+            // The end of the year is notified even if the job throws
+            Concurrency::Task task = [job, y, &scheduler]()
+            {
+                try
+                {
+                    (*job)();
+                }
+                catch (...)
+                {
+                    scheduler.notifyEnded(y);
+                    throw;
+                }
+                scheduler.notifyEnded(y);
+            };
 
-        // At this point, the first set of parallel year(s) was run with at least one year
-        // performed
-        if (!pFirstSetParallelWithAPerformedYearWasRun && yearPerformed)
-        {
-            pFirstSetParallelWithAPerformedYearWasRun = true;
+            logs.info() << "Year " << y + 1 << " started on space " << numSpace;
+            results[y] = Concurrency::AddTask(*pQueueService, task);
+            pQueueService->start();
         }
 
-        // On regarde si au moins une année du lot n'a pas trouvé de solution
-        for (auto& [year, failed]: batch.yearFailed)
+        commitAllYears();
+    }
+    catch (...)
+    {
+        // Years still in flight use data owned by this function : wait for them before leaving
+        while (scheduler.hasYearsInFlight())
         {
-            // Si une année du lot d'années n'a pas trouvé de solution, on arrête tout
-            if (failed)
+            auto dispatched = scheduler.popOldestYear();
+            try
+            {
+                results[dispatched.year].get();
+            }
+            catch (...)
             {
-                std::ostringstream msg;
-                msg << "Year " << year + 1 << " has failed in the previous set of parallel year.";
-                throw FatalError(msg.str());
+                // Only the first error is reported
             }
         }
-        // Computing the summary : adding the contribution of MC years
-        // previously computed in parallel
-        ImplementationType::variables.computeSummary(batch.spaceToPerformedYear,
-                                                     batch.nbPerformedYears);
-
-        // Computing summary of spatial aggregations
-        ImplementationType::variables.computeSpatialAggregatesSummary(ImplementationType::variables,
-                                                                      batch.spaceToPerformedYear,
-                                                                      batch.nbPerformedYears);
-
-        // Computes statistics on annual (system and solution) costs, to be printed in output into
-        // separate files
-        computeAnnualCostsStatistics(state, batch);
-
-        // Set to zero the random numbers of all parallel years
-        randomForParallelYears.reset();
-
-    } // End loop over sets of parallel years
+        pQueueService->wait(Yuni::qseIdle);
+        pQueueService->stop();
+        throw;
+    }
 
     // Writing annual costs statistics
     pAnnualStatistics.endStandardDeviations();
@@ -30,42 +30,17 @@
 
 namespace Antares::Solver::Simulation
 {
-struct setOfParallelYears
+struct scheduledYear
 {
-    // Un lot d'année à exécuter en parallèle.
-    // En fonction d'une éventuelle play-list, certaines seront jouées et d'autres non.
+    // MC year number
+    unsigned int year;
 
-public:
-    // Numeros des annees en parallele pour ce lot (certaines ne seront pas jouées en cas de
-    // play-list "trouée")
-    std::vector<unsigned int> yearsIndices;
-
-    // Une annee doit-elle être rejouée ?
-    std::map<uint, bool> yearFailed;
-
-    // Associe le numero d'une année jouée à l'indice de l'espace
-    std::map<unsigned int, unsigned int> performedYearToSpace;
-
-    // L'inverse : pour une année jouée, associe l'indice de l'espace au numero de l'année
-    std::map<unsigned int, unsigned int> spaceToPerformedYear;
-
-    // Pour chaque année, est-elle la première à devoir être jouée dans son lot d'années ?
-    std::map<unsigned int, bool> isFirstPerformedYearOfASet;
+    // According to a possible playlist, is the year actually run ?
+    bool isPerformed;
 
-    // Pour chaque année du lot, est-elle jouée ou non ?
-    std::map<unsigned int, bool> isYearPerformed;
-
-    // Nbre d'années en parallele vraiment jouées pour ce lot
-    unsigned int nbPerformedYears;
-
-    // Nbre d'années en parallele jouées ou non pour ce lot
-    unsigned int nbYears;
-
-    // Regenere-t-on des times series avant de jouer les annees du lot courant
+    // Are time-series regenerated before running this year ?
+    // If so, every previous year must have ended before the regeneration starts.
     bool regenerateTS;
-
-    // Annee a passer a la fonction "regenerateTimeSeries<false>(y)" (si regenerateTS is "true")
-    unsigned int yearForTSgeneration;
 };
 
 class costStatistics
@@ -192,14 +167,14 @@ public:
 class randomNumbers
 {
 public:
-    randomNumbers(uint maxNbPerformedYearsInAset, Data::PowerFluctuations powerFluctuations):
-        pMaxNbPerformedYears(maxNbPerformedYearsInAset)
+    randomNumbers(uint nbPerformedYearsInParallel, Data::PowerFluctuations powerFluctuations):
+        pMaxNbPerformedYears(nbPerformedYearsInParallel)
     {
         // Allocate a table of parallel years structures
-        pYears.resize(maxNbPerformedYearsInAset);
+        pYears.resize(nbPerformedYearsInParallel);
 
         // Tells these structures their power fluctuations mode
-        for (uint y = 0; y < maxNbPerformedYearsInAset; ++y)
+        for (uint y = 0; y < nbPerformedYearsInParallel; ++y)
         {
             pYears[y].setPowerFluctuations(powerFluctuations);
         }
@@ -207,24 +182,9 @@ public:
 
     ~randomNumbers() = default;
 
-    void reset()
-    {
-        for (uint i = 0; i < pMaxNbPerformedYears; i++)
-        {
-            pYears[i].reset();
-        }
-
-        yearNumberToIndex.clear();
-    }
-
     uint pMaxNbPerformedYears;
+    // Random numbers of the year running on each space (indexed by numSpace)
     std::vector<yearRandomNumbers> pYears;
-
-    // Associates :
-    //		year number (0, ..., total nb of years to compute - 1) --> index of the year's space
-    //(0,
-    //..., max nb of parallel years - 1)
-    std::map<uint, uint> yearNumberToIndex;
 };
 
 // Class representing a hydro cost noise.
@@ -0,0 +1,102 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+
+namespace Antares::Solver::Simulation
+{
+
+/*!
+** \brief Dispatches MC years over a fixed number of spaces (numSpace)
+**
+** A year takes a space as soon as one is free, instead of waiting for a whole set of
+** parallel years to end. Years are committed (merged into the synthesis) in the order they
+** were dispatched, whatever the order they actually end in : this way the synthesis does not
+** depend on the number of threads.
+**
+** A year keeps its results in its space until it is committed, the space is given back then.
+** There may be more spaces than years running at the same time : a year ending before older
+** ones frees its thread right away, so that a new year can start on a spare space while the
+** results wait to be committed.
+**
+** Only the thread running the simulation loop dispatches and commits years.
+** Jobs running the years only notify their end.
+*/
+class YearsScheduler
+{
+public:
+    struct DispatchedYear
+    {
+        unsigned int year;
+        unsigned int numSpace;
+    };
+
+    YearsScheduler(unsigned int nbSpaces, unsigned int maxNbYearsRunning);
+
+    //! Is there a free space for a new year ?
+    bool hasFreeSpace() const;
+    //! Wait until less than maxNbYearsRunning dispatched years are still running
+    void waitForIdleThread();
+    //! Are there years dispatched but not committed yet ?
+    bool hasYearsInFlight() const;
+    //! Has the oldest year in flight ended ?
+    bool oldestYearHasEnded() const;
+
+    /*!
+    ** \brief Take the lowest free space for a year
+    **
+    ** A free space must be available.
+    ** \return The index of the space (numSpace) the year must run on
+    */
+    unsigned int dispatch(unsigned int year);
+
+    /*!
+    ** \brief Notify that a year has ended (thread-safe)
+    **
+    ** The year does not count as running anymore, its space is kept until it is committed.
+    */
+    void notifyEnded(unsigned int year);
+
+    /*!
+    ** \brief Wait for the oldest year in flight to end, and give back its space
+    **
+    ** At least one year must be in flight.
+    */
+    DispatchedYear popOldestYear();
+
+private:
+    mutable std::mutex mutex_;
+    std::condition_variable yearEnded_;
+
+    const unsigned int maxNbYearsRunning_;
+    unsigned int nbYearsRunning_ = 0;
+    std::set<unsigned int> freeSpaces_;
+    //! Years in flight, in dispatch order
+    std::deque<DispatchedYear> inFlight_;
+    //! Years in flight which have already ended
+    std::set<unsigned int> ended_;
+};
+
+} // namespace Antares::Solver::Simulation
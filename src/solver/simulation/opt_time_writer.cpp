@@ -22,23 +22,34 @@
 
 #include <filesystem>
 
-OptimizationStatisticsWriter::OptimizationStatisticsWriter(Antares::Solver::IResultWriter& writer,
-                                                           uint year):
+OptimizationStatisticsWriter::OptimizationStatisticsWriter(
+  Antares::Solver::IResultWriter& writer,
+  uint year,
+  Benchmarking::DurationCollector& durationCollector):
     pYear(year),
-    pWriter(writer)
+    pWriter(writer),
+    pDurationCollector(durationCollector)
 {
     printHeader();
 }
 
 void OptimizationStatisticsWriter::printHeader()
 {
-    pBuffer << "# Week Optimization_1_ms Optimization_2_ms Update_ms1 Update_ms2\n";
+    pBuffer << "# Week Optimization_1_ms Optimization_2_ms Update_ms1 Update_ms2 Iterations_1 "
+               "Iterations_2\n";
 }
 
 void OptimizationStatisticsWriter::addTime(uint week, const TIME_MEASURES& timeMeasure)
 {
     pBuffer << week << " " << timeMeasure[0].solveTime << " " << timeMeasure[1].solveTime << " "
-            << timeMeasure[0].updateTime << " " << timeMeasure[1].updateTime << "\n";
+            << timeMeasure[0].updateTime << " " << timeMeasure[1].updateTime << " "
+            << timeMeasure[0].iterations << " " << timeMeasure[1].iterations << "\n";
+
+    // Counts and percentiles over all the weekly problems of the simulation
+    pDurationCollector.addDuration("weekly_optimization",
+                                   timeMeasure[0].solveTime + timeMeasure[1].solveTime);
+    pDurationCollector.addDuration("weekly_update",
+                                   timeMeasure[0].updateTime + timeMeasure[1].updateTime);
 }
 
 void OptimizationStatisticsWriter::finalize()
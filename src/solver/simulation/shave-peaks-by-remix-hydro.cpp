@@ -8,54 +8,106 @@
 namespace Antares::Solver::Simulation
 {
 
-int find_min_index(const std::vector<double>& TotalGen,
-                   const std::vector<double>& OutUnsupE,
-                   const std::vector<double>& OutHydroGen,
-                   const std::vector<bool>& triedBottom,
-                   const std::vector<double>& HydroPmax,
-                   const std::vector<bool>& enabledHours,
-                   double top)
+namespace
 {
-    double min_val = top;
-    int min_hour = -1;
-    for (unsigned int h = 0; h < TotalGen.size(); ++h)
+// An hour and its total generation, ordered by generation.
+// Ties are broken by hour, the earliest hour coming first for both the bottoms and the peaks.
+struct HourGen
+{
+    double gen;
+    int hour;
+};
+
+struct LowerGenFirst
+{
+    bool operator()(const HourGen& a, const HourGen& b) const
+    {
+        return a.gen > b.gen || (a.gen == b.gen && a.hour > b.hour);
+    }
+};
+
+struct HigherGenFirst
+{
+    bool operator()(const HourGen& a, const HourGen& b) const
     {
-        if (OutUnsupE[h] > 0 && OutHydroGen[h] < HydroPmax[h] && !triedBottom[h] && enabledHours[h])
+        return a.gen < b.gen || (a.gen == b.gen && a.hour > b.hour);
+    }
+};
+
+// Hours in an increasing or decreasing order of generation, taken from a heap as needed :
+// a heap is built in linear time, and most of the time only its first hours are needed.
+template<class Compare>
+class HoursByGen
+{
+public:
+    explicit HoursByGen(size_t nbHours)
+    {
+        heap_.reserve(nbHours);
+        sorted_.reserve(nbHours);
+    }
+
+    void clear()
+    {
+        heap_.clear();
+        sorted_.clear();
+    }
+
+    void add(double gen, int hour)
+    {
+        heap_.push_back({gen, hour});
+    }
+
+    // To be called once all hours are added
+    void order()
+    {
+        std::make_heap(heap_.begin(), heap_.end(), Compare());
+    }
+
+    // The i-th hour, or nullptr if there are not that many hours
+    const HourGen* at(size_t i)
+    {
+        while (sorted_.size() <= i && !heap_.empty())
         {
-            if (TotalGen[h] < min_val)
-            {
-                min_val = TotalGen[h];
-                min_hour = h;
-            }
+            std::pop_heap(heap_.begin(), heap_.end(), Compare());
+            sorted_.push_back(heap_.back());
+            heap_.pop_back();
         }
+        return i < sorted_.size() ? &sorted_[i] : nullptr;
     }
-    return min_hour;
-}
 
-int find_max_index(const std::vector<double>& TotalGen,
-                   const std::vector<double>& OutHydroGen,
-                   const std::vector<bool>& triedPeak,
-                   const std::vector<double>& HydroPmin,
-                   const std::vector<bool>& enabledHours,
-                   double ref_value,
-                   double eps)
+private:
+    std::vector<HourGen> heap_;
+    std::vector<HourGen> sorted_;
+};
+
+// Extreme levels between a bottom hour and any other hour, computed once per bottom hour
+// instead of once per (bottom, peak) pair.
+// For a peak after the bottom, minLevel[peak] is the min level over [bottom, peak).
+// For a peak before the bottom, maxLevel[peak] is the max level over [peak, bottom).
+void levelsFromBottom(const std::vector<double>& levels,
+                      int hourBottom,
+                      std::vector<double>& minLevel,
+                      std::vector<double>& maxLevel)
 {
-    double max_val = 0;
-    int max_hour = -1;
-    for (unsigned int h = 0; h < TotalGen.size(); ++h)
+    const int nbHours = static_cast<int>(levels.size());
+    if (hourBottom + 1 < nbHours)
     {
-        if (OutHydroGen[h] > HydroPmin[h] && TotalGen[h] >= ref_value + eps && !triedPeak[h]
-            && enabledHours[h])
+        minLevel[hourBottom + 1] = levels[hourBottom];
+        for (int h = hourBottom + 2; h < nbHours; ++h)
         {
-            if (TotalGen[h] > max_val)
-            {
-                max_val = TotalGen[h];
-                max_hour = h;
-            }
+            minLevel[h] = std::min(minLevel[h - 1], levels[h - 1]);
+        }
+    }
+    if (hourBottom > 0)
+    {
+        maxLevel[hourBottom - 1] = levels[hourBottom - 1];
+        for (int h = hourBottom - 2; h >= 0; --h)
+        {
+            maxLevel[h] = std::max(maxLevel[h + 1], levels[h]);
         }
     }
-    return max_hour;
 }
+} // namespace
 
 static bool operator<=(const std::vector<double>& a, const std::vector<double>& b)
 {
@@ -202,56 +254,66 @@ RemixHydroOutput shavePeaksByRemixingHydro(const std::vector<double>& DispatchGe
                    TotalGen.begin(),
                    std::plus<>());
 
+    const int nbHours = static_cast<int>(DispatchGen.size());
+    std::vector<double> minLevel(nbHours);
+    std::vector<double> maxLevel(nbHours);
+    HoursByGen<LowerGenFirst> bottomsByGen(nbHours);
+    HoursByGen<HigherGenFirst> peaksByGen(nbHours);
+
     while (loop-- > 0)
     {
-        std::vector<bool> triedBottom(DispatchGen.size(), false);
-        double delta = 0;
-
-        while (true)
+        // Bottoms : hours with unsupplied energy where hydro generation can be increased
+        // Peaks : hours where hydro generation can be decreased
+        bottomsByGen.clear();
+        peaksByGen.clear();
+        for (int h = 0; h < nbHours; ++h)
         {
-            int hourBottom = find_min_index(TotalGen,
-                                            OutUnsupE,
-                                            OutHydroGen,
-                                            triedBottom,
-                                            HydroPmax,
-                                            enabledHours,
-                                            top);
-            if (hourBottom == -1)
+            if (!enabledHours[h])
             {
-                break;
+                continue;
+            }
+            if (OutUnsupE[h] > 0 && OutHydroGen[h] < HydroPmax[h] && TotalGen[h] < top)
+            {
+                bottomsByGen.add(TotalGen[h], h);
             }
+            if (OutHydroGen[h] > HydroPmin[h] && TotalGen[h] > 0)
+            {
+                peaksByGen.add(TotalGen[h], h);
+            }
+        }
+        bottomsByGen.order();
+        peaksByGen.order();
+
+        // The lowest bottom is paired with the highest peak it can be paired with, and so on
+        double delta = 0;
+        for (size_t b = 0; const HourGen* bottom = bottomsByGen.at(b); ++b)
+        {
+            const int hourBottom = bottom->hour;
+            bool levelsComputed = false;
 
-            std::vector<bool> triedPeak(DispatchGen.size(), false);
-            while (true)
+            for (size_t p = 0; const HourGen* peak = peaksByGen.at(p); ++p)
             {
-                int hourPeak = find_max_index(TotalGen,
-                                              OutHydroGen,
-                                              triedPeak,
-                                              HydroPmin,
-                                              enabledHours,
-                                              TotalGen[hourBottom],
-                                              eps);
-                if (hourPeak == -1)
+                if (peak->gen < TotalGen[hourBottom] + eps)
                 {
                     break;
                 }
+                const int hourPeak = peak->hour;
+
+                if (!levelsComputed)
+                {
+                    levelsFromBottom(levels, hourBottom, minLevel, maxLevel);
+                    levelsComputed = true;
+                }
 
-                std::vector<double> intermediate_level(levels.begin()
-                                                         + std::min(hourBottom, hourPeak),
-                                                       levels.begin()
-                                                         + std::max(hourBottom, hourPeak));
                 double max_pic, max_creux;
                 if (hourBottom < hourPeak)
                 {
                     max_pic = capa;
-                    max_creux = *std::min_element(intermediate_level.begin(),
-                                                  intermediate_level.end());
+                    max_creux = minLevel[hourPeak];
                 }
                 else
                 {
-                    max_pic = capa
-                              - *std::max_element(intermediate_level.begin(),
-                                                  intermediate_level.end());
+                    max_pic = capa - maxLevel[hourPeak];
                     max_creux = capa;
                 }
 
@@ -274,17 +336,12 @@ RemixHydroOutput shavePeaksByRemixingHydro(const std::vector<double>& DispatchGe
                                             - OutHydroGen[hourBottom];
                     break;
                 }
-                else
-                {
-                    triedPeak[hourPeak] = true;
-                }
             }
 
             if (delta > 0)
             {
                 break;
             }
-            triedBottom[hourBottom] = true;
         }
 
         if (delta == 0)
@@ -125,6 +125,7 @@ void SIM_InitialisationProblemeHebdo(Data::Study& study,
     problem.exportSolutions = study.parameters.include.exportSolutions;
     problem.ExportStructure = study.parameters.include.exportStructure;
     problem.NamedProblems = study.parameters.namedProblems;
+    problem.parallelCsrHours = study.parameters.optOptions.parallelCsrHours;
     problem.exportMPSOnError = Data::exportMPS(parameters.include.unfeasibleProblemBehavior);
 
     problem.OptimisationAvecCoutsDeDemarrage = (study.parameters.unitCommitment.ucMode
@@ -0,0 +1,99 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/solver/simulation/years-scheduler.h"
+
+#include <cassert>
+
+namespace Antares::Solver::Simulation
+{
+
+YearsScheduler::YearsScheduler(unsigned int nbSpaces, unsigned int maxNbYearsRunning):
+    maxNbYearsRunning_(maxNbYearsRunning)
+{
+    for (unsigned int numSpace = 0; numSpace != nbSpaces; ++numSpace)
+    {
+        freeSpaces_.insert(numSpace);
+    }
+}
+
+bool YearsScheduler::hasFreeSpace() const
+{
+    std::lock_guard lock(mutex_);
+    return !freeSpaces_.empty();
+}
+
+void YearsScheduler::waitForIdleThread()
+{
+    std::unique_lock lock(mutex_);
+    yearEnded_.wait(lock, [this] { return nbYearsRunning_ < maxNbYearsRunning_; });
+}
+
+bool YearsScheduler::hasYearsInFlight() const
+{
+    std::lock_guard lock(mutex_);
+    return !inFlight_.empty();
+}
+
+bool YearsScheduler::oldestYearHasEnded() const
+{
+    std::lock_guard lock(mutex_);
+    return !inFlight_.empty() && ended_.contains(inFlight_.front().year);
+}
+
+unsigned int YearsScheduler::dispatch(unsigned int year)
+{
+    std::lock_guard lock(mutex_);
+    assert(!freeSpaces_.empty());
+    assert(nbYearsRunning_ < maxNbYearsRunning_);
+
+    ++nbYearsRunning_;
+    unsigned int numSpace = *freeSpaces_.begin();
+    freeSpaces_.erase(freeSpaces_.begin());
+    inFlight_.push_back({year, numSpace});
+    return numSpace;
+}
+
+void YearsScheduler::notifyEnded(unsigned int year)
+{
+    {
+        std::lock_guard lock(mutex_);
+        ended_.insert(year);
+        --nbYearsRunning_;
+    }
+    yearEnded_.notify_all();
+}
+
+YearsScheduler::DispatchedYear YearsScheduler::popOldestYear()
+{
+    std::unique_lock lock(mutex_);
+    assert(!inFlight_.empty());
+
+    DispatchedYear oldest = inFlight_.front();
+    yearEnded_.wait(lock, [this, &oldest] { return ended_.contains(oldest.year); });
+
+    inFlight_.pop_front();
+    ended_.erase(oldest.year);
+    freeSpaces_.insert(oldest.numSpace);
+    return oldest;
+}
+
+} // namespace Antares::Solver::Simulation
@@ -19,8 +19,11 @@
 ** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
 */
 
+#include <cmath>
+#include <exception>
 #include <string>
 
+#include <antares/concurrency/concurrency.h>
 #include <antares/io/file.h> // For Antares::IO::fileSetContent
 #include <antares/logs/logs.h>
 #include <antares/solver/ts-generator/generator.h>
@@ -568,6 +571,102 @@ Matrix<double> AvailabilityTSgenerator::run(AvailabilityTSGeneratorData& tsGener
     }
     return to_return;
 }
+
+//! Integer drawn by the generator : its doubles are its 32-bit outputs divided by 2^32 - 1
+uint32_t drawInteger(MersenneTwister& random)
+{
+    return static_cast<uint32_t>(std::llround(random() * 4294967295.0));
+}
+
+//! Bijective mix of a 32-bit integer (finalizer of MurmurHash3)
+uint32_t mix(uint32_t z)
+{
+    z ^= z >> 16;
+    z *= 0x85ebca6bu;
+    z ^= z >> 13;
+    z *= 0xc2b2ae35u;
+    z ^= z >> 16;
+    return z;
+}
+
+/*!
+** \brief Derive one seed per generated item from the caller's generator
+**
+** Each item (cluster or link) gets its own generator : the series are then the same whatever
+** the number of threads. Only one integer is drawn from the main stream, the seed of an item
+** is a bijective function of it and of the rank of the item, so that two items never share
+** the same seed.
+*/
+std::vector<uint> drawSeeds(MersenneTwister& random, std::size_t count)
+{
+    const uint32_t key = drawInteger(random);
+    std::vector<uint> seeds(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        // Weyl sequence over the rank, as in SplitMix
+        seeds[i] = mix(key + static_cast<uint32_t>(i + 1) * 0x9e3779b9u);
+    }
+    return seeds;
+}
+
+/*!
+** \brief Run all tasks, on the given thread pool if any, in the calling thread otherwise
+**
+** A pool which is not running is started for the tasks, and stopped once they are done.
+*/
+void runTasks(const std::vector<Concurrency::Task>& tasks,
+              const std::shared_ptr<Yuni::Job::QueueService>& threadPool)
+{
+    if (!threadPool)
+    {
+        for (const auto& task: tasks)
+        {
+            task();
+        }
+        return;
+    }
+
+    std::vector<Concurrency::TaskFuture> futures;
+    futures.reserve(tasks.size());
+    for (const auto& task: tasks)
+    {
+        futures.push_back(Concurrency::AddTask(*threadPool, task));
+    }
+
+    const bool startPool = !threadPool->started();
+    if (startPool)
+    {
+        threadPool->start();
+    }
+
+    // All tasks are waited for, even if one of them failed : the first error is re-thrown after
+    std::exception_ptr error;
+    for (auto& future: futures)
+    {
+        try
+        {
+            future.get();
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if (startPool)
+    {
+        threadPool->wait(Yuni::qseIdle);
+        threadPool->stop();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
 } // namespace
 
 std::vector<Data::ThermalCluster*> getAllClustersToGen(const Data::AreaList& areas,
@@ -605,20 +704,32 @@ void writeTStoDisk(const Matrix<>& series, const std::filesystem::path savePath)
 
 bool generateThermalTimeSeries(Data::Study& study,
                                const std::vector<Data::ThermalCluster*>& clusters,
-                               MersenneTwister& thermalRandom)
+                               MersenneTwister& thermalRandom,
+                               const std::shared_ptr<Yuni::Job::QueueService>& threadPool)
 {
     logs.info();
     logs.info() << "Generating the thermal time-series";
 
-    auto generator = AvailabilityTSgenerator(study.parameters.derated,
-                                             study.parameters.nbTimeSeriesThermal,
-                                             thermalRandom);
+    const auto seeds = drawSeeds(thermalRandom, clusters.size());
+    const bool derated = study.parameters.derated;
+    const uint nbOfSeriesToGen = study.parameters.nbTimeSeriesThermal;
 
-    for (auto* cluster: clusters)
+    std::vector<Concurrency::Task> tasks;
+    tasks.reserve(clusters.size());
+    for (std::size_t i = 0; i != clusters.size(); ++i)
     {
-        AvailabilityTSGeneratorData tsGenerationData(cluster);
-        cluster->series.timeSeries = generator.run(tsGenerationData);
+        tasks.push_back(
+          [cluster = clusters[i], seed = seeds[i], derated, nbOfSeriesToGen]()
+          {
+              MersenneTwister random;
+              random.reset(seed);
+              auto generator = AvailabilityTSgenerator(derated, nbOfSeriesToGen, random);
+
+              AvailabilityTSGeneratorData tsGenerationData(cluster);
+              cluster->series.timeSeries = generator.run(tsGenerationData);
+          });
     }
+    runTasks(tasks, threadPool);
 
     return true;
 }
@@ -639,14 +750,13 @@ void writeThermalTimeSeries(const std::vector<Data::ThermalCluster*>& clusters,
 // gp : we should try to add const identifiers before args here
 bool generateLinkTimeSeries(std::vector<LinkTSgenerationParams>& links,
                             StudyParamsForLinkTS& generalParams,
-                            const fs::path& savePath)
+                            const fs::path& savePath,
+                            const std::shared_ptr<Yuni::Job::QueueService>& threadPool)
 {
     logs.info();
     logs.info() << "Generation of links time-series";
 
-    auto generator = AvailabilityTSgenerator(generalParams.derated,
-                                             generalParams.nbLinkTStoGenerate,
-                                             generalParams.random);
+    std::vector<LinkTSgenerationParams*> linksToGen;
     for (auto& link: links)
     {
         if (!link.hasValidData)
@@ -661,24 +771,48 @@ bool generateLinkTimeSeries(std::vector<LinkTSgenerationParams>& links,
             continue; // Skipping the link
         }
 
-        // === DIRECT =======================
-        AvailabilityTSGeneratorData tsConfigDataDirect(link,
-                                                       link.modulationCapacityDirect,
-                                                       link.namesPair.second);
-        auto generated_ts = generator.run(tsConfigDataDirect);
-
-        auto filePath = savePath / link.namesPair.first / link.namesPair.second += "_direct.txt";
-        writeTStoDisk(generated_ts, filePath);
+        // Created here, since several links may share the same origin area
+        std::filesystem::create_directories(savePath / link.namesPair.first);
+        linksToGen.push_back(&link);
+    }
 
-        // === INDIRECT =======================
-        AvailabilityTSGeneratorData tsConfigDataIndirect(link,
-                                                         link.modulationCapacityIndirect,
-                                                         link.namesPair.second);
-        generated_ts = generator.run(tsConfigDataIndirect);
+    const auto seeds = drawSeeds(generalParams.random, linksToGen.size());
+    const bool derated = generalParams.derated;
+    const uint nbOfSeriesToGen = generalParams.nbLinkTStoGenerate;
 
-        filePath = savePath / link.namesPair.first / link.namesPair.second += "_indirect.txt";
-        writeTStoDisk(generated_ts, filePath);
+    std::vector<Concurrency::Task> tasks;
+    tasks.reserve(linksToGen.size());
+    for (std::size_t i = 0; i != linksToGen.size(); ++i)
+    {
+        tasks.push_back(
+          [&link = *linksToGen[i], seed = seeds[i], derated, nbOfSeriesToGen, &savePath]()
+          {
+              MersenneTwister random;
+              random.reset(seed);
+              auto generator = AvailabilityTSgenerator(derated, nbOfSeriesToGen, random);
+
+              // === DIRECT =======================
+              AvailabilityTSGeneratorData tsConfigDataDirect(link,
+                                                             link.modulationCapacityDirect,
+                                                             link.namesPair.second);
+              auto generated_ts = generator.run(tsConfigDataDirect);
+
+              auto filePath = savePath / link.namesPair.first / link.namesPair.second
+                              += "_direct.txt";
+              writeTStoDisk(generated_ts, filePath);
+
+              // === INDIRECT =======================
+              AvailabilityTSGeneratorData tsConfigDataIndirect(link,
+                                                               link.modulationCapacityIndirect,
+                                                               link.namesPair.second);
+              generated_ts = generator.run(tsConfigDataIndirect);
+
+              filePath = savePath / link.namesPair.first / link.namesPair.second
+                         += "_indirect.txt";
+              writeTStoDisk(generated_ts, filePath);
+          });
     }
+    runTasks(tasks, threadPool);
 
     return true;
 }
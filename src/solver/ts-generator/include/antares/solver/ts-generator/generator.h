@@ -22,6 +22,7 @@
 #define __ANTARES_SOLVER_timeSeries_GENERATOR_H__
 
 #include <yuni/yuni.h>
+#include <yuni/job/queue/service.h>
 
 #include <antares/series/series.h>
 #include <antares/study/fwd.h>
@@ -104,16 +105,28 @@ void ResizeGeneratedTimeSeries(Data::AreaList& areas, Data::Parameters& params);
 template<enum Data::TimeSeriesType T>
 bool GenerateTimeSeries(Data::Study& study, uint year, IResultWriter& writer);
 
+/*!
+** \brief Generate the availability time-series of the given thermal clusters
+**
+** Each cluster is generated from its own generator, seeded from `thermalRandom` in the order
+** of `clusters` : the series do not depend on the number of threads of `threadPool`.
+** Clusters are generated in the calling thread when `threadPool` is null.
+*/
 bool generateThermalTimeSeries(Data::Study& study,
                                const std::vector<Data::ThermalCluster*>& clusters,
-                               MersenneTwister& thermalRandom);
+                               MersenneTwister& thermalRandom,
+                               const std::shared_ptr<Yuni::Job::QueueService>& threadPool);
 
 void writeThermalTimeSeries(const std::vector<Data::ThermalCluster*>& clusters,
                             const fs::path& savePath);
 
+/*!
+** \brief Generate and write the time-series of the given links, seeded like the thermal ones
+*/
 bool generateLinkTimeSeries(std::vector<LinkTSgenerationParams>& links,
                             StudyParamsForLinkTS&,
-                            const fs::path& savePath);
+                            const fs::path& savePath,
+                            const std::shared_ptr<Yuni::Job::QueueService>& threadPool);
 
 std::vector<Data::ThermalCluster*> getAllClustersToGen(const Data::AreaList& areas,
                                                        bool globalThermalTSgeneration);
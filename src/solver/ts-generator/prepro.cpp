@@ -52,15 +52,16 @@ bool PreproAvailability::saveToFolder(const AnyString& folder) const
     return false;
 }
 
-bool PreproAvailability::loadFromFolder(Study& study, const std::filesystem::path& folder)
+bool PreproAvailability::loadFromFolder(Study& /* study */, const std::filesystem::path& folder)
 {
     auto filePath = folder / "data.txt";
     // standard loading
+    Matrix<>::BufferType dataBuffer;
     return data.loadFromCSVFile(filePath.string(),
                                 preproAvailabilityMax,
                                 DAYS_PER_YEAR,
                                 Matrix<>::optFixedSize,
-                                &study.dataBuffer);
+                                &dataBuffer);
 }
 
 bool PreproAvailability::validate() const
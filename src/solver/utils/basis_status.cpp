@@ -42,6 +42,11 @@ void BasisStatus::extractBasis(const operations_research::MPSolver* solver)
     impl->extractBasis(solver);
 }
 
+void BasisStatus::copyFrom(const BasisStatus& other)
+{
+    *impl = *other.impl;
+}
+
 bool BasisStatus::exists() const
 {
     return impl->exists();
@@ -50,6 +50,8 @@ public:
     bool exists() const;
     void setStartingBasis(operations_research::MPSolver* solver) const;
     void extractBasis(const operations_research::MPSolver* solver);
+    //! Explicit copy, to hand a basis over to another thread
+    void copyFrom(const BasisStatus& other);
 
 private:
     std::unique_ptr<BasisStatusImpl> impl;
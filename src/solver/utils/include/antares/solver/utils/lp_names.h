@@ -0,0 +1,161 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Antares::Optimization
+{
+/*!
+** \brief Names of the variables (or of the constraints) of a linear problem
+**
+** Instead of a full string, each element only stores a small descriptor: element type,
+** location (area, link, cluster...) and time step. Strings such as area or cluster names are
+** interned once in a table of labels. The actual name, e.g. `AreaBalance::area<fr>::hour<12>`,
+** is only built when it is requested (MPS export, infeasibility analysis...).
+*/
+class LpNames
+{
+public:
+    using LabelId = uint32_t;
+
+    //! Location part of a name
+    enum class Location : uint8_t
+    {
+        //! Unnamed element
+        None,
+        //! The type label is the whole name
+        Verbatim,
+        //! link<origin$$destination>
+        Link,
+        //! area<area>
+        Area,
+        //! area<area>::Layer<layer>
+        AreaLayer,
+        //! area<area>::ThermalCluster<cluster>
+        ThermalCluster,
+        //! area<area>::ShortTermStorage<storage>
+        ShortTermStorage,
+        //! hourly, daily or weekly, according to the time step type
+        Granularity
+    };
+
+    //! Time part of a name
+    enum class TimeStep : uint8_t
+    {
+        Hour,
+        Day,
+        Week,
+        //! Constraint<label>, the time step of the descriptor holds a label
+        Constraint
+    };
+
+    struct Descriptor
+    {
+        //! Label of the element type (AreaBalance, NTCDirect, name of a binding constraint...)
+        LabelId type = 0;
+        //! Label of the area, or of the origin of a link
+        LabelId first = 0;
+        //! Label of the cluster, storage or link destination, or index of the layer
+        uint32_t second = 0;
+        //! Time step, or label for TimeStep::Constraint
+        uint32_t timeStep = 0;
+        Location location = Location::None;
+        TimeStep timeStepType = TimeStep::Hour;
+    };
+
+    LpNames();
+    explicit LpNames(std::size_t size);
+
+    std::size_t size() const
+    {
+        return descriptors_.size();
+    }
+
+    /*!
+    ** \brief Resize the list of elements
+    **
+    ** Labels are kept, so that they can be shared by all the problems built with this object.
+    */
+    void resize(std::size_t size);
+
+    //! Get the id of a label, adding it to the table if needed
+    LabelId label(std::string_view text);
+
+    //! Text of a label
+    std::string_view text(LabelId id) const
+    {
+        return labels_[id];
+    }
+
+    void set(std::size_t index, const Descriptor& descriptor)
+    {
+        descriptors_[index] = descriptor;
+    }
+
+    //! Give a name to an element, which will be used as is
+    void setVerbatim(std::size_t index, std::string_view name);
+
+    const Descriptor& descriptor(std::size_t index) const
+    {
+        return descriptors_[index];
+    }
+
+    //! True if the element has no name
+    bool empty(std::size_t index) const
+    {
+        return descriptors_[index].location == Location::None;
+    }
+
+    //! Build the name of an element (an empty string for unnamed elements)
+    std::string operator[](std::size_t index) const;
+
+    //! Same as operator[], with bounds checking
+    std::string at(std::size_t index) const;
+
+    //! Build the names of all elements
+    std::vector<std::string> materialize() const;
+
+private:
+    struct LabelHash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view text) const
+        {
+            return std::hash<std::string_view>{}(text);
+        }
+    };
+
+    void appendLocation(std::string& out, const Descriptor& descriptor) const;
+    void appendTime(std::string& out, const Descriptor& descriptor) const;
+
+    std::vector<Descriptor> descriptors_;
+    std::vector<std::string> labels_;
+    std::unordered_map<std::string, LabelId, LabelHash, std::equal_to<>> labelIds_;
+};
+} // namespace Antares::Optimization
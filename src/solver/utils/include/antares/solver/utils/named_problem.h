@@ -25,6 +25,8 @@
 #include <string>
 #include <vector>
 
+#include "antares/solver/utils/lp_names.h"
+
 #include "spx_definition_arguments.h"
 #include "spx_fonctions.h"
 
@@ -37,16 +39,16 @@ class BasisStatus;
 struct PROBLEME_SIMPLEXE_NOMME: public PROBLEME_SIMPLEXE
 {
 public:
-    PROBLEME_SIMPLEXE_NOMME(const std::vector<std::string>& NomDesVariables,
-                            const std::vector<std::string>& NomDesContraintes,
+    PROBLEME_SIMPLEXE_NOMME(const LpNames& NomDesVariables,
+                            const LpNames& NomDesContraintes,
                             const std::vector<bool>& VariablesEntieres,
                             BasisStatus& basisStatus,
                             bool UseNamedProblems,
                             bool SolverLogs);
 
 private:
-    const std::vector<std::string>& NomDesVariables;
-    const std::vector<std::string>& NomDesContraintes;
+    const LpNames& NomDesVariables;
+    const LpNames& NomDesContraintes;
     bool useNamedProblems_;
 
 public:
@@ -66,12 +68,12 @@ public:
         useNamedProblems_ = useNamedProblems;
     }
 
-    const std::vector<std::string>& VariableNames() const
+    const LpNames& VariableNames() const
     {
         return NomDesVariables;
     }
 
-    const std::vector<std::string>& ConstraintNames() const
+    const LpNames& ConstraintNames() const
     {
         return NomDesContraintes;
     }
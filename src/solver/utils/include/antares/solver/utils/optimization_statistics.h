@@ -34,6 +34,12 @@ private:
     std::atomic<long long> totalUpdateTime;
     std::atomic<unsigned int> nbUpdate;
 
+    std::atomic<long long> totalIterations;
+
+    // Entries (costs, right-hand sides, bounds) actually modified by the updates
+    std::atomic<long long> totalUpdatedEntries;
+    std::atomic<long long> totalUpdatableEntries;
+
 public:
     void reset()
     {
@@ -41,6 +47,9 @@ public:
         nbSolve = 0;
         totalUpdateTime = 0;
         nbUpdate = 0;
+        totalIterations = 0;
+        totalUpdatedEntries = 0;
+        totalUpdatableEntries = 0;
     }
 
     OptimizationStatistics()
@@ -52,7 +61,10 @@ public:
         totalSolveTime(rhs.totalSolveTime.load()),
         nbSolve(rhs.nbSolve.load()),
         totalUpdateTime(rhs.totalUpdateTime.load()),
-        nbUpdate(rhs.nbUpdate.load())
+        nbUpdate(rhs.nbUpdate.load()),
+        totalIterations(rhs.totalIterations.load()),
+        totalUpdatedEntries(rhs.totalUpdatedEntries.load()),
+        totalUpdatableEntries(rhs.totalUpdatableEntries.load())
     {
     }
 
@@ -66,6 +78,9 @@ public:
         totalUpdateTime += other.totalUpdateTime;
         nbSolve += other.nbSolve;
         nbUpdate += other.nbUpdate;
+        totalIterations += other.totalIterations;
+        totalUpdatedEntries += other.totalUpdatedEntries;
+        totalUpdatableEntries += other.totalUpdatableEntries;
     }
 
     void addUpdateTime(long long updateTime)
@@ -80,6 +95,17 @@ public:
         nbSolve++;
     }
 
+    void addIterations(long long iterations)
+    {
+        totalIterations += iterations;
+    }
+
+    void addUpdatedEntries(long long updated, long long updatable)
+    {
+        totalUpdatedEntries += updated;
+        totalUpdatableEntries += updatable;
+    }
+
     unsigned int getNbUpdate() const
     {
         return nbUpdate;
@@ -95,6 +121,26 @@ public:
         return totalUpdateTime;
     }
 
+    long long getTotalIterations() const
+    {
+        return totalIterations;
+    }
+
+    long long getTotalUpdatedEntries() const
+    {
+        return totalUpdatedEntries;
+    }
+
+    //! Share of the entries modified by the updates, in percent
+    double getUpdatedEntriesRatio() const
+    {
+        if (totalUpdatableEntries == 0)
+        {
+            return 0.0;
+        }
+        return 100. * totalUpdatedEntries / totalUpdatableEntries;
+    }
+
     double getAverageUpdateTime() const
     {
         if (nbUpdate == 0)
@@ -104,6 +150,15 @@ public:
         return ((double)totalUpdateTime) / nbUpdate;
     }
 
+    double getAverageIterations() const
+    {
+        if (nbSolve == 0)
+        {
+            return 0.0;
+        }
+        return ((double)totalIterations) / nbSolve;
+    }
+
     double getAverageSolveTime() const
     {
         if (nbSolve == 0)
@@ -117,7 +172,10 @@ public:
     {
         return "Average solve time: " + std::to_string(std::lround(getAverageSolveTime())) + " ms, "
                + "average update time: " + std::to_string(std::lround(getAverageUpdateTime()))
-               + " ms";
+               + " ms, average simplex iterations: "
+               + std::to_string(std::lround(getAverageIterations()))
+               + ", updated entries: " + std::to_string(std::lround(getUpdatedEntriesRatio()))
+               + " %";
     }
 };
 
@@ -34,16 +34,31 @@ MPSolver* ORTOOLS_Simplexe(Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* Probl
                            bool keepBasis,
                            const Antares::Solver::Optimization::OptimizationOptions& options);
 
-void ORTOOLS_ModifierLeVecteurCouts(MPSolver* ProbSpx, const double* costs, int nbVar);
-void ORTOOLS_ModifierLeVecteurSecondMembre(MPSolver* ProbSpx,
-                                           const double* rhs,
-                                           const char* sens,
-                                           int nbRow);
-void ORTOOLS_CorrigerLesBornes(MPSolver* ProbSpx,
-                               const double* bMin,
-                               const double* bMax,
-                               const int* typeVar,
-                               int nbVar);
+/*!
+** \brief Whether a solver starts from a given simplex basis, and gives its final one
+**
+** Only the LP resolutions of XPRESS do : the other solvers ignore the bases.
+*/
+bool solverSupportsWarmStart(const MPSolver::OptimizationProblemType solverType);
+
+/*!
+** \brief Update the costs, right-hand sides or bounds of a problem already held by a solver
+**
+** Only the entries which differ from the problem held by the solver are modified : every
+** modification may invalidate the incremental state of the solver.
+**
+** \return The number of modified entries
+*/
+int ORTOOLS_ModifierLeVecteurCouts(MPSolver* ProbSpx, const double* costs, int nbVar);
+int ORTOOLS_ModifierLeVecteurSecondMembre(MPSolver* ProbSpx,
+                                          const double* rhs,
+                                          const char* sens,
+                                          int nbRow);
+int ORTOOLS_CorrigerLesBornes(MPSolver* ProbSpx,
+                              const double* bMin,
+                              const double* bMax,
+                              const int* typeVar,
+                              int nbVar);
 void ORTOOLS_LibererProbleme(MPSolver* ProbSpx);
 
 #endif
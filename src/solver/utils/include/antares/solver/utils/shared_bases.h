@@ -0,0 +1,76 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+#include "basis_status.h"
+
+namespace Antares::Optimization
+{
+/*!
+** \brief Optimal bases shared by all MC years, whatever the space they run on
+**
+** A weekly problem has the same constraint matrix for all MC years : the optimal basis found by
+** one year is a good starting point for the same problem of the other years, including the ones
+** running in parallel. For each problem, the basis kept is the one of the resolution which
+** needed the fewest simplex iterations. This ranks how close to the optimum the basis that
+** resolution started from was, not how good the kept basis is as a starting point.
+**
+** The basis a year starts from depends on the years which ended before, which changes from one
+** run to another : results are not reproducible. Thread-safe.
+*/
+class SharedBases
+{
+public:
+    //! (week, optimization interval, optimization number)
+    using Key = std::tuple<unsigned int, int, int>;
+
+    /*!
+    ** \brief Copy the best basis found for a problem
+    **
+    ** \return False if no basis has been found for this problem yet, `basis` is then unchanged
+    */
+    bool copyBestBasis(const Key& key, BasisStatus& basis) const;
+
+    /*!
+    ** \brief Offer the optimal basis of a resolution
+    **
+    ** The basis is kept if it is the first one for this problem, or if its resolution needed
+    ** fewer iterations than the resolution of the basis currently kept.
+    */
+    void offer(const Key& key, const BasisStatus& basis, long long iterations);
+
+private:
+    struct Entry
+    {
+        BasisStatus basis;
+        long long iterations = 0;
+    };
+
+    mutable std::mutex mutex_;
+    // Entries are never modified once in the map : they are replaced
+    std::map<Key, std::shared_ptr<const Entry>> entries_;
+};
+} // namespace Antares::Optimization
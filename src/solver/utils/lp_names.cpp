@@ -0,0 +1,184 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#include "antares/solver/utils/lp_names.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Antares::Optimization
+{
+namespace
+{
+const std::string_view SEPARATOR = "::";
+const std::string_view AREA_SEP = "$$";
+
+void appendIdentifier(std::string& out, std::string_view type, std::string_view value)
+{
+    out.append(type).append("<").append(value).append(">");
+}
+} // namespace
+
+LpNames::LpNames()
+{
+    // Label 0 is the empty string, so that a default descriptor refers to valid labels
+    label("");
+}
+
+LpNames::LpNames(std::size_t size):
+    LpNames()
+{
+    resize(size);
+}
+
+void LpNames::resize(std::size_t size)
+{
+    descriptors_.resize(size);
+}
+
+LpNames::LabelId LpNames::label(std::string_view text)
+{
+    if (auto it = labelIds_.find(text); it != labelIds_.end())
+    {
+        return it->second;
+    }
+    const auto id = static_cast<LabelId>(labels_.size());
+    labels_.emplace_back(text);
+    labelIds_.emplace(labels_.back(), id);
+    return id;
+}
+
+void LpNames::setVerbatim(std::size_t index, std::string_view name)
+{
+    Descriptor descriptor;
+    descriptor.type = label(name);
+    descriptor.location = Location::Verbatim;
+    descriptors_[index] = descriptor;
+}
+
+void LpNames::appendLocation(std::string& out, const Descriptor& descriptor) const
+{
+    switch (descriptor.location)
+    {
+    case Location::Link:
+        out.append("link<")
+          .append(labels_[descriptor.first])
+          .append(AREA_SEP)
+          .append(labels_[descriptor.second])
+          .append(">");
+        break;
+    case Location::Area:
+        appendIdentifier(out, "area", labels_[descriptor.first]);
+        break;
+    case Location::AreaLayer:
+        appendIdentifier(out, "area", labels_[descriptor.first]);
+        out.append(SEPARATOR);
+        appendIdentifier(out, "Layer", std::to_string(descriptor.second));
+        break;
+    case Location::ThermalCluster:
+        appendIdentifier(out, "area", labels_[descriptor.first]);
+        out.append(SEPARATOR);
+        appendIdentifier(out, "ThermalCluster", labels_[descriptor.second]);
+        break;
+    case Location::ShortTermStorage:
+        appendIdentifier(out, "area", labels_[descriptor.first]);
+        out.append(SEPARATOR);
+        appendIdentifier(out, "ShortTermStorage", labels_[descriptor.second]);
+        break;
+    case Location::Granularity:
+        switch (descriptor.timeStepType)
+        {
+        case TimeStep::Day:
+            out.append("daily");
+            break;
+        case TimeStep::Week:
+            out.append("weekly");
+            break;
+        default:
+            out.append("hourly");
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void LpNames::appendTime(std::string& out, const Descriptor& descriptor) const
+{
+    switch (descriptor.timeStepType)
+    {
+    case TimeStep::Hour:
+        appendIdentifier(out, "hour", std::to_string(descriptor.timeStep));
+        break;
+    case TimeStep::Day:
+        appendIdentifier(out, "day", std::to_string(descriptor.timeStep));
+        break;
+    case TimeStep::Week:
+        appendIdentifier(out, "week", std::to_string(descriptor.timeStep));
+        break;
+    case TimeStep::Constraint:
+        appendIdentifier(out, "Constraint", labels_[descriptor.timeStep]);
+        break;
+    }
+}
+
+std::string LpNames::operator[](std::size_t index) const
+{
+    const Descriptor& descriptor = descriptors_[index];
+    switch (descriptor.location)
+    {
+    case Location::None:
+        return {};
+    case Location::Verbatim:
+        return labels_[descriptor.type];
+    default:
+        break;
+    }
+
+    std::string result = labels_[descriptor.type];
+    result.append(SEPARATOR);
+    appendLocation(result, descriptor);
+    result.append(SEPARATOR);
+    appendTime(result, descriptor);
+    std::replace(result.begin(), result.end(), ' ', '*');
+    return result;
+}
+
+std::string LpNames::at(std::size_t index) const
+{
+    if (index >= descriptors_.size())
+    {
+        throw std::out_of_range("LpNames: index " + std::to_string(index) + " out of range");
+    }
+    return (*this)[index];
+}
+
+std::vector<std::string> LpNames::materialize() const
+{
+    std::vector<std::string> names;
+    names.reserve(descriptors_.size());
+    for (std::size_t index = 0; index < descriptors_.size(); ++index)
+    {
+        names.push_back((*this)[index]);
+    }
+    return names;
+}
+} // namespace Antares::Optimization
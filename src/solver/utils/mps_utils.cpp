@@ -97,14 +97,26 @@ public:
         dest->B = src->SecondMembre;
         dest->SensDeLaContrainte = src->Sens;
 
-        // Names
-        dest->LabelDeLaVariable = nameTranslator.translate(src->VariableNames(), mVariableNames);
-        dest->LabelDeLaContrainte = nameTranslator.translate(src->ConstraintNames(),
+        // Names, only built when they are actually written
+        if (src->UseNamedProblems())
+        {
+            mVariableNameStorage = src->VariableNames().materialize();
+            mConstraintNameStorage = src->ConstraintNames().materialize();
+        }
+        else
+        {
+            mVariableNameStorage.resize(src->VariableNames().size());
+            mConstraintNameStorage.resize(src->ConstraintNames().size());
+        }
+        dest->LabelDeLaVariable = nameTranslator.translate(mVariableNameStorage, mVariableNames);
+        dest->LabelDeLaContrainte = nameTranslator.translate(mConstraintNameStorage,
                                                              mConstraintNames);
     }
 
 private:
     std::vector<int> mVariableType;
+    std::vector<std::string> mVariableNameStorage;
+    std::vector<std::string> mConstraintNameStorage;
     std::vector<char*> mVariableNames;
     std::vector<char*> mConstraintNames;
 };
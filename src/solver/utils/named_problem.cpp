@@ -26,8 +26,8 @@
 
 namespace Antares::Optimization
 {
-PROBLEME_SIMPLEXE_NOMME::PROBLEME_SIMPLEXE_NOMME(const std::vector<std::string>& NomDesVariables,
-                                                 const std::vector<std::string>& NomDesContraintes,
+PROBLEME_SIMPLEXE_NOMME::PROBLEME_SIMPLEXE_NOMME(const LpNames& NomDesVariables,
+                                                 const LpNames& NomDesContraintes,
                                                  const std::vector<bool>& VariablesEntieres,
                                                  BasisStatus& basisStatus,
                                                  bool UseNamedProblems,
@@ -91,7 +91,7 @@ static void TuneSolverSpecificOptions(MPSolver* solver,
     }
 }
 
-static bool solverSupportsWarmStart(const MPSolver::OptimizationProblemType solverType)
+bool solverSupportsWarmStart(const MPSolver::OptimizationProblemType solverType)
 {
     switch (solverType)
     {
@@ -257,46 +257,73 @@ MPSolver* ORTOOLS_Simplexe(Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* Probl
     return solver;
 }
 
-void ORTOOLS_ModifierLeVecteurCouts(MPSolver* solver, const double* costs, int nbVar)
+int ORTOOLS_ModifierLeVecteurCouts(MPSolver* solver, const double* costs, int nbVar)
 {
     auto& variables = solver->variables();
+    MPObjective* objective = solver->MutableObjective();
+    int nbModified = 0;
     for (int idxVar = 0; idxVar < nbVar; ++idxVar)
     {
         auto& var = variables[idxVar];
-        solver->MutableObjective()->SetCoefficient(var, costs[idxVar]);
+        if (objective->GetCoefficient(var) != costs[idxVar])
+        {
+            objective->SetCoefficient(var, costs[idxVar]);
+            ++nbModified;
+        }
     }
+    return nbModified;
 }
 
-void ORTOOLS_ModifierLeVecteurSecondMembre(MPSolver* solver,
-                                           const double* rhs,
-                                           const char* sens,
-                                           int nbRow)
+template<class T>
+static bool setBoundsIfModified(T* element, double lb, double ub)
+{
+    if (element->lb() == lb && element->ub() == ub)
+    {
+        return false;
+    }
+    element->SetBounds(lb, ub);
+    return true;
+}
+
+int ORTOOLS_ModifierLeVecteurSecondMembre(MPSolver* solver,
+                                          const double* rhs,
+                                          const char* sens,
+                                          int nbRow)
 {
     auto& constraints = solver->constraints();
+    int nbModified = 0;
     for (int idxRow = 0; idxRow < nbRow; ++idxRow)
     {
+        bool modified = false;
         if (sens[idxRow] == '=')
         {
-            constraints[idxRow]->SetBounds(rhs[idxRow], rhs[idxRow]);
+            modified = setBoundsIfModified(constraints[idxRow], rhs[idxRow], rhs[idxRow]);
         }
         else if (sens[idxRow] == '<')
         {
-            constraints[idxRow]->SetBounds(-MPSolver::infinity(), rhs[idxRow]);
+            modified = setBoundsIfModified(constraints[idxRow],
+                                           -MPSolver::infinity(),
+                                           rhs[idxRow]);
         }
         else if (sens[idxRow] == '>')
         {
-            constraints[idxRow]->SetBounds(rhs[idxRow], MPSolver::infinity());
+            modified = setBoundsIfModified(constraints[idxRow],
+                                           rhs[idxRow],
+                                           MPSolver::infinity());
         }
+        nbModified += modified;
     }
+    return nbModified;
 }
 
-void ORTOOLS_CorrigerLesBornes(MPSolver* solver,
-                               const double* bMin,
-                               const double* bMax,
-                               const int* typeVar,
-                               int nbVar)
+int ORTOOLS_CorrigerLesBornes(MPSolver* solver,
+                              const double* bMin,
+                              const double* bMax,
+                              const int* typeVar,
+                              int nbVar)
 {
     auto& variables = solver->variables();
+    int nbModified = 0;
     for (int idxVar = 0; idxVar < nbVar; ++idxVar)
     {
         double min_l = ((typeVar[idxVar] == VARIABLE_NON_BORNEE)
@@ -307,9 +334,9 @@ void ORTOOLS_CorrigerLesBornes(MPSolver* solver,
                             || (typeVar[idxVar] == VARIABLE_BORNEE_INFERIEUREMENT)
                           ? MPSolver::infinity()
                           : bMax[idxVar]);
-        auto& var = variables[idxVar];
-        var->SetBounds(min_l, max_l);
+        nbModified += setBoundsIfModified(variables[idxVar], min_l, max_l);
     }
+    return nbModified;
 }
 
 void ORTOOLS_LibererProbleme(MPSolver* solver)
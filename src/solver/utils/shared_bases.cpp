@@ -0,0 +1,66 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include <antares/solver/utils/shared_bases.h>
+
+namespace Antares::Optimization
+{
+bool SharedBases::copyBestBasis(const Key& key, BasisStatus& basis) const
+{
+    std::shared_ptr<const Entry> entry;
+    {
+        std::lock_guard lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end())
+        {
+            return false;
+        }
+        entry = it->second;
+    }
+    // The entry can't be modified anymore : copied without holding the lock
+    basis.copyFrom(entry->basis);
+    return true;
+}
+
+void SharedBases::offer(const Key& key, const BasisStatus& basis, long long iterations)
+{
+    {
+        std::lock_guard lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end() && it->second->iterations <= iterations)
+        {
+            return;
+        }
+    }
+
+    auto entry = std::make_shared<Entry>();
+    entry->basis.copyFrom(basis);
+    entry->iterations = iterations;
+
+    std::lock_guard lock(mutex_);
+    auto& kept = entries_[key];
+    // Another year may have offered a better basis in the meantime
+    if (!kept || iterations < kept->iterations)
+    {
+        kept = std::move(entry);
+    }
+}
+} // namespace Antares::Optimization
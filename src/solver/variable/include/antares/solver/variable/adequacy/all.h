@@ -60,6 +60,7 @@
 #include "antares/solver/variable/economy/thermalAirPollutantEmissions.h"
 #include "antares/solver/variable/economy/unsupliedEnergy.h"
 #include "antares/solver/variable/economy/waterValue.h"
+#include "antares/solver/variable/prunable.h"
 #include "antares/solver/variable/setofareas.h"
 #include "antares/solver/variable/variable.h"
 
@@ -80,121 +81,115 @@ namespace Adequacy
 /*!
 ** \brief All variables for a single area (economy)
 */
-typedef                                              // Prices
-  Variable::Adequacy::OverallCost                    // Overall Cost (Op. Cost + Unsupplied Eng.)
-  <Variable::Economy::OperatingCost                  // Operating Cost
-   <Variable::Economy::Price                         // Marginal price
-                                                     // pollutant
-    <Variable::Economy::ThermalAirPollutantEmissions // Pollutant emissions (from all thermal
-                                                     // dispatchable clusters) Production by thermal
-                                                     // cluster
-     <Variable::Economy::ProductionByDispatchablePlant  // Energy generated by thermal dispatchable
-                                                        // clusters
-      <Variable::Economy::ProductionByRenewablePlant    // Energy generated by renewable clusters
-                                                        // (must-run)
-       <Variable::Economy::Balance                      // Nodal Energy Balance
-                                                        // Misc Gen.
-        <Variable::Economy::RowBalance                  // Misc Gen. Row balance
-         <Variable::Economy::PSP                        // PSP
-          <Variable::Economy::MiscGenMinusRowPSP        // Misc Gen. - Row Balance - PSP
-                                                        // Time series
-           <Variable::Economy::TimeSeriesValuesLoad     // Load
-            <Variable::Economy::TimeSeriesValuesHydro   // Hydro
-             <Variable::Economy::TimeSeriesValuesWind   // Wind
-              <Variable::Economy::TimeSeriesValuesSolar // Solar
-                                                        // Other
-               <Variable::Economy::DispatchableGeneration // All dispatchable generation
-                <Variable::Economy::RenewableGeneration<
-                  Variable::Economy::HydroStorage     // Hydro Storage Generation
-                  <Variable::Economy::Pumping         // Pumping generation
-                   <Variable::Economy::ReservoirLevel // Reservoir levels
-                    <Variable::Economy::Inflows       // Hydraulic inflows
-                     <Variable::Economy::Overflows    // Hydraulic overflows
-                      <Variable::Economy::WaterValue  // Water values
-                       <Variable::Economy::HydroCost  // Hydro costs
-                        <Variable::Economy::STSbyGroup<
-                          Variable::Economy::STstorageInjectionByCluster<
-                            Variable::Economy::STstorageWithdrawalByCluster<
-                              Variable::Economy::STstorageLevelsByCluster<
-                                Variable::Economy::UnsupliedEnergy // Unsuplied Energy
-                                <Variable::Adequacy::SpilledEnergy // Spilled Energy
-                                 <Variable::Economy::LOLD          // LOLD
-                                  <Variable::Economy::LOLP         // LOLP
-                                   <Variable::Economy::AvailableDispatchGen<
-                                     Variable::Economy::DispatchableGenMargin<
-                                       Variable::Economy::Marge // OP. MRG
-                                       <Variable::Economy::ProfitByPlant
-                                        // Links
-                                        <Variable::Adequacy::Links // All links
-                                         >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+typedef // Variables which are not printed are skipped (see Prunable)
+                                                            // Overall Cost (Op. Cost + Unsupplied Eng.)
+  Variable::Adequacy::OverallCost
+  <Prunable<Variable::Economy::OperatingCost                // Operating Cost
+  <Prunable<Variable::Economy::Price                        // Marginal price
+  <Prunable<Variable::Economy::ThermalAirPollutantEmissions // Pollutant emissions
+  <Variable::Economy::ProductionByDispatchablePlant         // Always computed (thermal production)
+                                                            // Energy generated by renewable clusters
+  <Prunable<Variable::Economy::ProductionByRenewablePlant
+  <Variable::Economy::Balance                               // Always computed (quadratic flows)
+  <Prunable<Variable::Economy::RowBalance                   // Misc Gen. Row balance
+  <Prunable<Variable::Economy::PSP                          // PSP
+  <Prunable<Variable::Economy::MiscGenMinusRowPSP           // Misc Gen. - Row Balance - PSP
+  <Prunable<Variable::Economy::TimeSeriesValuesLoad         // Load
+  <Prunable<Variable::Economy::TimeSeriesValuesHydro        // Hydro
+  <Prunable<Variable::Economy::TimeSeriesValuesWind         // Wind
+  <Prunable<Variable::Economy::TimeSeriesValuesSolar        // Solar
+  <Prunable<Variable::Economy::DispatchableGeneration       // All dispatchable generation
+  <Prunable<Variable::Economy::RenewableGeneration
+  <Prunable<Variable::Economy::HydroStorage                 // Hydro Storage Generation
+  <Prunable<Variable::Economy::Pumping                      // Pumping generation
+  <Prunable<Variable::Economy::ReservoirLevel               // Reservoir levels
+  <Prunable<Variable::Economy::Inflows                      // Hydraulic inflows
+  <Prunable<Variable::Economy::Overflows                    // Hydraulic overflows
+  <Prunable<Variable::Economy::WaterValue                   // Water values
+  <Prunable<Variable::Economy::HydroCost                    // Hydro costs
+  <Prunable<Variable::Economy::STSbyGroup
+  <Prunable<Variable::Economy::STstorageInjectionByCluster
+  <Prunable<Variable::Economy::STstorageWithdrawalByCluster
+  <Prunable<Variable::Economy::STstorageLevelsByCluster
+  <Variable::Economy::UnsupliedEnergy                       // Always computed (LOLD of the sets)
+  <Prunable<Variable::Adequacy::SpilledEnergy               // Spilled Energy
+  <Prunable<Variable::Economy::LOLD                         // LOLD
+  <Prunable<Variable::Economy::LOLP                         // LOLP
+  <Prunable<Variable::Economy::AvailableDispatchGen
+  <Prunable<Variable::Economy::DispatchableGenMargin
+  <Prunable<Variable::Economy::Marge                        // OP. MRG
+  <Prunable<Variable::Economy::ProfitByPlant
+  <Variable::Adequacy::Links                                // All links
+  >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+  >>>>>>
     VariablesPerArea;
 
 /*!
 ** \brief All variables for a single set of areas (economy)
 */
 typedef // Prices
-  Common::SpatialAggregate<
+  Common::PrunableSpatialAggregate<
     Variable::Adequacy::OverallCost,
-    Common::SpatialAggregate<
+    Common::PrunableSpatialAggregate<
       Variable::Economy::OperatingCost,
-      Common::SpatialAggregate<
+      Common::PrunableSpatialAggregate<
         Variable::Economy::Price,
         // pollutant
-        Common::SpatialAggregate<
+        Common::PrunableSpatialAggregate<
           Variable::Economy::ThermalAirPollutantEmissions,
           // Production by thermal cluster
-          Common::SpatialAggregate<
+          Common::PrunableSpatialAggregate<
             Variable::Economy::Balance,
             // Misc Gen.
-            Common::SpatialAggregate<
+            Common::PrunableSpatialAggregate<
               Variable::Economy::RowBalance,
-              Common::SpatialAggregate<
+              Common::PrunableSpatialAggregate<
                 Variable::Economy::PSP,
-                Common::SpatialAggregate<
+                Common::PrunableSpatialAggregate<
                   Variable::Economy::MiscGenMinusRowPSP,
                   // Time series
-                  Common::SpatialAggregate<
+                  Common::PrunableSpatialAggregate<
                     Variable::Economy::TimeSeriesValuesLoad,
-                    Common::SpatialAggregate<
+                    Common::PrunableSpatialAggregate<
                       Variable::Economy::TimeSeriesValuesHydro,
-                      Common::SpatialAggregate<
+                      Common::PrunableSpatialAggregate<
                         Variable::Economy::TimeSeriesValuesWind,
-                        Common::SpatialAggregate<
+                        Common::PrunableSpatialAggregate<
                           Variable::Economy::TimeSeriesValuesSolar,
                           // Other
-                          Common::SpatialAggregate<
+                          Common::PrunableSpatialAggregate<
                             Variable::Economy::DispatchableGeneration,
-                            Common::SpatialAggregate<
+                            Common::PrunableSpatialAggregate<
                               Variable::Economy::RenewableGeneration,
-                              Common::SpatialAggregate<
+                              Common::PrunableSpatialAggregate<
                                 Variable::Economy::HydroStorage,
-                                Common::SpatialAggregate<
+                                Common::PrunableSpatialAggregate<
                                   Variable::Economy::Pumping,
-                                  Common::SpatialAggregate<
+                                  Common::PrunableSpatialAggregate<
                                     Variable::Economy::ReservoirLevel,
-                                    Common::SpatialAggregate<
+                                    Common::PrunableSpatialAggregate<
                                       Variable::Economy::Inflows,
-                                      Common::SpatialAggregate<
+                                      Common::PrunableSpatialAggregate<
                                         Variable::Economy::Overflows,
-                                        Common::SpatialAggregate<
+                                        Common::PrunableSpatialAggregate<
                                           Variable::Economy::WaterValue,
-                                          Common::SpatialAggregate<
+                                          Common::PrunableSpatialAggregate<
                                             Variable::Economy::HydroCost,
-                                            Common::SpatialAggregate<
+                                            Common::PrunableSpatialAggregate<
                                               Variable::Economy::UnsupliedEnergy,
-                                              Common::SpatialAggregate<
+                                              Common::PrunableSpatialAggregate<
                                                 Variable::Adequacy::SpilledEnergy,
                                                 // LOLD
-                                                Common::SpatialAggregate<
+                                                Common::PrunableSpatialAggregate<
                                                   Variable::Economy::LOLD,
-                                                  Common::SpatialAggregate<
+                                                  Common::PrunableSpatialAggregate<
                                                     Variable::Economy::LOLP,
 
-                                                    Common::SpatialAggregate<
+                                                    Common::PrunableSpatialAggregate<
                                                       Variable::Economy::AvailableDispatchGen,
-                                                      Common::SpatialAggregate<
+                                                      Common::PrunableSpatialAggregate<
                                                         Variable::Economy::DispatchableGenMargin,
-                                                        Common::SpatialAggregate<
+                                                        Common::PrunableSpatialAggregate<
                                                           Variable::Economy::
                                                             Marge>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     VariablesPerSetOfAreas;
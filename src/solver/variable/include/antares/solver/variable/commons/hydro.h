@@ -223,11 +223,10 @@ public:
     void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
                         unsigned int nbYearsForCurrentSummary)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year]: numSpaceToYear)
         {
             // Merge all those values with the global results
-            AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/,
-                                         pValuesForTheCurrentYear[numSpace]);
+            AncestorType::pResults.merge(year, pValuesForTheCurrentYear[numSpace]);
         }
 
         // Next variable
@@ -277,11 +276,11 @@ private:
     //! The attached area
     Data::Area* pArea;
     //!
-    Matrix<>::ColumnType** pFatalValues;
+    Matrix<>::ColumnType** pFatalValues = nullptr;
 
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
-    unsigned int pNbYearsParallel;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
+    unsigned int pNbYearsParallel = 0;
 
 }; // class TimeSeriesValuesHydro
 
@@ -226,10 +226,9 @@ public:
     void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
                         unsigned int nbYearsForCurrentSummary)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year]: numSpaceToYear)
         {
-            AncestorType::pResults.merge(numSpaceToYear[numSpace],
-                                         pValuesForTheCurrentYear[numSpace]);
+            AncestorType::pResults.merge(year, pValuesForTheCurrentYear[numSpace]);
         }
 
         // Next variable
@@ -275,8 +274,8 @@ public:
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
-    unsigned int pNbYearsParallel;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
+    unsigned int pNbYearsParallel = 0;
 
 }; // class MiscGenMinusRowPSP
 
@@ -21,6 +21,7 @@
 #ifndef __SOLVER_VARIABLE_ECONOMY_SPATIAL_AGGREGATE_H__
 #define __SOLVER_VARIABLE_ECONOMY_SPATIAL_AGGREGATE_H__
 
+#include "antares/solver/variable/prunable.h"
 #include "antares/solver/variable/variable.h"
 
 // #include <antares/logs/logs.h>	// In case it is needed
@@ -489,27 +490,33 @@ private:
       std::map<unsigned int, unsigned int>& numSpaceToYear,
       uint nbYearsForCurrentSummary)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year]: numSpaceToYear)
         {
             // Merge all those values with the global results
             VariableAccessorType::ComputeSummary(pValuesForTheCurrentYear[numSpace],
                                                  AncestorType::pResults,
-                                                 numSpaceToYear[numSpace]);
+                                                 year);
         }
     }
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesTypeForSpatialAg pValuesForTheCurrentYear;
+    typename VCardType::IntermediateValuesTypeForSpatialAg pValuesForTheCurrentYear = nullptr;
 
     double pRatioYear;
     double pRatioDay;
     double pRatioMonth;
     double pRatioWeek;
-    unsigned int pNbYearsParallel;
+    unsigned int pNbYearsParallel = 0;
 
 }; // class SpatialAggregate
 
+/*!
+** \brief Spatial aggregate skipped when it is not printed (see Prunable)
+*/
+template<template<class> class VarT, class NextT = Container::EndOfList>
+using PrunableSpatialAggregate = Prunable<SpatialAggregate<VarT, NextT>>;
+
 } // namespace Common
 } // namespace Variable
 } // namespace Solver
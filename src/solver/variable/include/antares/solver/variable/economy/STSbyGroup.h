@@ -276,11 +276,11 @@ public:
         //  For instance :
         //      - we compute the average of the results of the first hour over all MC years
         //      - or we compute the average of the results of the n-th day over all MC years
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year]: numSpaceToYear)
         {
             VariableAccessorType::ComputeSummary(pValuesForTheCurrentYear[numSpace],
                                                  AncestorType::pResults,
-                                                 numSpaceToYear[numSpace]);
+                                                 year);
         }
 
         // Next variable
@@ -419,12 +419,12 @@ public:
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
     size_t nbColumns_ = 0;
     std::vector<std::string> groupNames_; // Names of group containing the clusters of the area
     std::map<std::string, unsigned int> groupToNumbers_; // Gives to each group (of area) a number
     const int NB_COLS_PER_GROUP = 3; // Injection + withdrawal + levels = 3 variables
-    unsigned int pNbYearsParallel;
+    unsigned int pNbYearsParallel = 0;
 
 }; // class STSbyGroup
 
@@ -204,13 +204,13 @@ public:
     void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
                         unsigned int nbYearsForCurrentSummary)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year]: numSpaceToYear)
         {
             for (unsigned int clusterIndex = 0; clusterIndex < nbClusters_; ++clusterIndex)
             {
                 // Merge all those values with the global results
                 AncestorType::pResults[clusterIndex].merge(
-                  numSpaceToYear[numSpace],
+                  year,
                   pValuesForTheCurrentYear[numSpace][clusterIndex]);
             }
         }
@@ -34,6 +34,7 @@
 #include "../commons/solar.h"
 #include "../commons/spatial-aggregate.h"
 #include "../commons/wind.h"
+#include "../prunable.h"
 #include "../setofareas.h"
 #include "balance.h"
 #include "price.h"
@@ -96,141 +97,136 @@ namespace Antares::Solver::Variable::Economy
 /*!
 ** \brief All variables for a single area (economy)
 */
-typedef           // Prices
-  OverallCost     // Overall Cost (Op. Cost + Unsupplied Eng.)
-  <OverallCostCsr // Overall Cost after CSR (adequacy patch Curtailment ShaRing)
-   <OperatingCost // Operating Cost
-    <Price        // Marginal price
-     <PriceCSR
-      // Thermal pollutants
-      <ThermalAirPollutantEmissions    // Overall pollutant emissions(from all thermal dispatchable
-                                       // clusters) Production by thermal cluster
-       <ProductionByDispatchablePlant  // Energy generated by thermal dispatchable clusters
-        <ProductionByRenewablePlant    // Energy generated by renewable clusters (must-run)
-         <Balance                      // Nodal Energy Balance
-                                       // Misc Gen.
-          <RowBalance                  // Misc Gen. Row balance
-           <PSP                        // PSP
-            <MiscGenMinusRowPSP        // Misc Gen. - Row Balance - PSP
-                                       // Time series
-             <TimeSeriesValuesLoad     // Load
-              <TimeSeriesValuesHydro   // Hydro
-               <TimeSeriesValuesWind   // Wind
-                <TimeSeriesValuesSolar // Solar
-                                       // Other
-                 <DispatchableGeneration // All dispatchable generation
-                  <RenewableGeneration   // All renewable generation
-                   <HydroStorage         // Hydro Storage Generation
-                    <Pumping             // Pumping generation
-                     <ReservoirLevel     // Reservoir levels
-                      <Inflows           // Hydraulic inflows
-                       <Overflows        // Hydraulic overflows
-                        <WaterValue      // Water values
-                         <HydroCost      // Hydro costs
-                          <STSbyGroup<STstorageInjectionByCluster<STstorageWithdrawalByCluster<
-                            STstorageLevelsByCluster<STstorageCashFlowByCluster<
-                              UnsupliedEnergy            // Unsuplied Energy
-                              <UnsupliedEnergyCSR        // Unsupplied energy CSR
-                               <DomesticUnsuppliedEnergy // Domestic Unsupplied Energy
-                                <LMRViolations           // LMR Violations
-                                 <SpilledEnergy          // Spilled Energy
-                                  <LOLD                  // LOLD
-                                   <LOLD_CSR<
-                                     LOLP // LOLP
-                                     <LOLP_CSR<AvailableDispatchGen<DispatchableGenMargin<
-                                       DtgMarginCsr // DTG MRG CSR
-                                       <Marge<MaxMrgCsr<NonProportionalCost<
-                                         NonProportionalCostByDispatchablePlant // Startup
-                                                                                // cost +
-                                                                                // Fixed cost
-                                                                                // per
-                                                                                // thermal
-                                                                                // plant
-                                                                                // detail
-                                         <NbOfDispatchedUnits         // Number of Units Dispatched
-                                          <NbOfDispatchedUnitsByPlant // Number of Units
-                                                                      // Dispatched by plant
-                                           <ProfitByPlant
-                                            // Links
-                                            <Variable::Economy::Links // All links
-                                             >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+typedef // Variables which are not printed are skipped (see Prunable)
+  OverallCost                                      // Overall Cost, always computed (annual cost)
+  <Prunable<OverallCostCsr                         // Overall Cost after CSR (adequacy patch)
+  <Prunable<OperatingCost                          // Operating Cost
+  <Prunable<Price                                  // Marginal price
+  <Prunable<PriceCSR
+  <Prunable<ThermalAirPollutantEmissions           // Overall pollutant emissions
+  <ProductionByDispatchablePlant                   // Always computed (thermal production)
+  <Prunable<ProductionByRenewablePlant             // Energy generated by renewable clusters
+  <Balance                                         // Always computed (quadratic flows)
+  <Prunable<RowBalance                             // Misc Gen. Row balance
+  <Prunable<PSP                                    // PSP
+  <Prunable<MiscGenMinusRowPSP                     // Misc Gen. - Row Balance - PSP
+  <Prunable<TimeSeriesValuesLoad                   // Load
+  <Prunable<TimeSeriesValuesHydro                  // Hydro
+  <Prunable<TimeSeriesValuesWind                   // Wind
+  <Prunable<TimeSeriesValuesSolar                  // Solar
+  <Prunable<DispatchableGeneration                 // All dispatchable generation
+  <Prunable<RenewableGeneration                    // All renewable generation
+  <Prunable<HydroStorage                           // Hydro Storage Generation
+  <Prunable<Pumping                                // Pumping generation
+  <Prunable<ReservoirLevel                         // Reservoir levels
+  <Prunable<Inflows                                // Hydraulic inflows
+  <Prunable<Overflows                              // Hydraulic overflows
+  <Prunable<WaterValue                             // Water values
+  <Prunable<HydroCost                              // Hydro costs
+  <Prunable<STSbyGroup
+  <Prunable<STstorageInjectionByCluster
+  <Prunable<STstorageWithdrawalByCluster
+  <Prunable<STstorageLevelsByCluster
+  <Prunable<STstorageCashFlowByCluster
+  <UnsupliedEnergy                                 // Always computed (LOLD of the sets)
+  <Prunable<UnsupliedEnergyCSR                     // Unsupplied energy CSR
+  <Prunable<DomesticUnsuppliedEnergy               // Domestic Unsupplied Energy
+  <Prunable<LMRViolations                          // LMR Violations
+  <Prunable<SpilledEnergy                          // Spilled Energy
+  <Prunable<LOLD                                   // LOLD
+  <Prunable<LOLD_CSR
+  <Prunable<LOLP                                   // LOLP
+  <Prunable<LOLP_CSR
+  <Prunable<AvailableDispatchGen
+  <Prunable<DispatchableGenMargin
+  <Prunable<DtgMarginCsr                           // DTG MRG CSR
+  <Prunable<Marge
+  <Prunable<MaxMrgCsr
+  <Prunable<NonProportionalCost
+  <Prunable<NonProportionalCostByDispatchablePlant // Startup + Fixed cost per plant
+  <Prunable<NbOfDispatchedUnits                    // Number of Units Dispatched
+  <NbOfDispatchedUnitsByPlant                      // Always computed (dispatched units)
+  <Prunable<ProfitByPlant
+  <Variable::Economy::Links                        // All links
+  >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+  >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     VariablesPerArea;
 
 /*!
 ** \brief All variables for a single set of areas (economy)
 */
 typedef // Prices
-  Common::SpatialAggregate<
+  Common::PrunableSpatialAggregate<
     OverallCost,
-    Common::SpatialAggregate<
+    Common::PrunableSpatialAggregate<
       OperatingCost,
-      Common::SpatialAggregate<
+      Common::PrunableSpatialAggregate<
         Price,
         // Thermal pollutants
-        Common::SpatialAggregate<
+        Common::PrunableSpatialAggregate<
           ThermalAirPollutantEmissions,
           // Production by thermal cluster
-          Common::SpatialAggregate<
+          Common::PrunableSpatialAggregate<
             Balance,
             // Misc Gen.
-            Common::SpatialAggregate<
+            Common::PrunableSpatialAggregate<
               RowBalance,
-              Common::SpatialAggregate<
+              Common::PrunableSpatialAggregate<
                 PSP,
-                Common::SpatialAggregate<
+                Common::PrunableSpatialAggregate<
                   MiscGenMinusRowPSP,
                   // Time series
-                  Common::SpatialAggregate<
+                  Common::PrunableSpatialAggregate<
                     TimeSeriesValuesLoad,
-                    Common::SpatialAggregate<
+                    Common::PrunableSpatialAggregate<
                       TimeSeriesValuesHydro,
-                      Common::SpatialAggregate<
+                      Common::PrunableSpatialAggregate<
                         TimeSeriesValuesWind,
-                        Common::SpatialAggregate<
+                        Common::PrunableSpatialAggregate<
                           TimeSeriesValuesSolar,
                           // Other
-                          Common::SpatialAggregate<
+                          Common::PrunableSpatialAggregate<
                             DispatchableGeneration,
-                            Common::SpatialAggregate<
+                            Common::PrunableSpatialAggregate<
                               RenewableGeneration,
-                              Common::SpatialAggregate<
+                              Common::PrunableSpatialAggregate<
                                 HydroStorage,
-                                Common::SpatialAggregate<
+                                Common::PrunableSpatialAggregate<
                                   Pumping,
-                                  Common::SpatialAggregate<
+                                  Common::PrunableSpatialAggregate<
                                     ReservoirLevel,
-                                    Common::SpatialAggregate<
+                                    Common::PrunableSpatialAggregate<
                                       Inflows,
-                                      Common::SpatialAggregate<
+                                      Common::PrunableSpatialAggregate<
                                         Overflows,
-                                        Common::SpatialAggregate<
+                                        Common::PrunableSpatialAggregate<
                                           WaterValue,
-                                          Common::SpatialAggregate<
+                                          Common::PrunableSpatialAggregate<
                                             HydroCost,
-                                            Common::SpatialAggregate<
+                                            Common::PrunableSpatialAggregate<
                                               UnsupliedEnergy,
-                                              Common::SpatialAggregate<
+                                              Common::PrunableSpatialAggregate<
                                                 DomesticUnsuppliedEnergy,
-                                                Common::SpatialAggregate<
+                                                Common::PrunableSpatialAggregate<
                                                   LMRViolations,
-                                                  Common::SpatialAggregate<
+                                                  Common::PrunableSpatialAggregate<
                                                     SpilledEnergy,
                                                     // LOLD
-                                                    Common::SpatialAggregate<
+                                                    Common::PrunableSpatialAggregate<
                                                       LOLD,
-                                                      Common::SpatialAggregate<
+                                                      Common::PrunableSpatialAggregate<
                                                         LOLP,
-                                                        Common::SpatialAggregate<
+                                                        Common::PrunableSpatialAggregate<
                                                           AvailableDispatchGen,
-                                                          Common::SpatialAggregate<
+                                                          Common::PrunableSpatialAggregate<
                                                             DispatchableGenMargin,
-                                                            Common::SpatialAggregate<
+                                                            Common::PrunableSpatialAggregate<
                                                               DtgMarginCsr,
-                                                              Common::SpatialAggregate<
+                                                              Common::PrunableSpatialAggregate<
                                                                 Marge,
 
                                                                 // Detail Prices
-                                                                Common::SpatialAggregate<
+                                                                Common::PrunableSpatialAggregate<
                                                                   NonProportionalCost, // MBO
                                                                                        // 13/05/2014
                                                                                        // -
@@ -238,7 +234,7 @@ typedef // Prices
                                                                                        // #21
 
                                                                   // Number Of Dispatched Units
-                                                                  Common::SpatialAggregate<
+                                                                  Common::PrunableSpatialAggregate<
                                                                     NbOfDispatchedUnits // MBO
                                                                                         // 25/02/2016
                                                                                         // -
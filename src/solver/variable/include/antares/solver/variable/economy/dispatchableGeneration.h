@@ -255,11 +255,11 @@ public:
     void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
                         unsigned int nbYearsForCurrentSummary)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year]: numSpaceToYear)
         {
             VariableAccessorType::ComputeSummary(pValuesForTheCurrentYear[numSpace],
                                                  AncestorType::pResults,
-                                                 numSpaceToYear[numSpace]);
+                                                 year);
         }
         // Next variable
         NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
@@ -316,8 +316,8 @@ public:
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
-    unsigned int pNbYearsParallel;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
+    unsigned int pNbYearsParallel = 0;
 
 }; // class DispatchableGeneration
 
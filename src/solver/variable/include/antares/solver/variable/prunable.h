@@ -0,0 +1,277 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __SOLVER_VARIABLE_PRUNABLE_H__
+#define __SOLVER_VARIABLE_PRUNABLE_H__
+
+#include <utility>
+
+#include "antares/solver/variable/variable.h"
+
+namespace Antares::Solver::Variable
+{
+namespace // anonymous
+{
+// Is at least one column of a variable printed ? (see GetPrintStatusHelper)
+template<int ColumnT, class VCardT>
+struct AnyColumnPrinted
+{
+    static bool Check(const Data::AllVariablesPrintInfo& printInfo)
+    {
+        for (int i = 0; i < ColumnT; ++i)
+        {
+            if (printInfo.isPrinted(VCardT::Multiple::Caption(i)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+template<class VCardT>
+struct AnyColumnPrinted<Category::singleColumn, VCardT>
+{
+    static bool Check(const Data::AllVariablesPrintInfo& printInfo)
+    {
+        return printInfo.isPrinted(VCardT::Caption());
+    }
+};
+
+template<class VCardT>
+struct AnyColumnPrinted<Category::dynamicColumns, VCardT>
+{
+    static bool Check(const Data::AllVariablesPrintInfo& printInfo)
+    {
+        return printInfo.isPrinted(VCardT::Caption());
+    }
+};
+
+template<class VCardT>
+struct AnyColumnPrinted<Category::noColumn, VCardT>
+{
+    static bool Check(const Data::AllVariablesPrintInfo&)
+    {
+        // Nothing to print, but the variable may be here for its side effects
+        return true;
+    }
+};
+} // namespace
+
+/*!
+** \brief Remove a variable from the static list when none of its columns is printed
+**
+** The variable is kept in the list (its print status and its column count are still
+** provided), but it is not initialized and all the events are directly forwarded
+** to the next variable: no memory is allocated for its results, and nothing is
+** computed for it.
+**
+** Only variables without side effects should be wrapped : the variables providing data
+** to the state (thermal production, annual system cost...) or to other variables (e.g.
+** the unsupplied energy for the spatial aggregates of the LOLD) must always be computed.
+**
+** \code
+** typedef Balance<Prunable<Price<Links>>> VariablesPerArea;
+** \endcode
+**
+** \tparam VariableT The variable
+*/
+template<class VariableT>
+class Prunable: public VariableT
+{
+public:
+    //! The variable
+    typedef VariableT VariableType;
+    //! Type of the next static variable
+    typedef typename VariableT::NextType NextType;
+    //! VCard
+    typedef typename VariableT::VCardType VCardType;
+
+    //! Does the variable have at least one printed column ?
+    static bool IsRequired(const Data::AllVariablesPrintInfo& printInfo)
+    {
+        return AnyColumnPrinted<VCardType::columnCount, VCardType>::Check(printInfo);
+    }
+
+public:
+    void initializeFromStudy(Data::Study& study)
+    {
+        pEnabled = IsRequired(study.parameters.variablesPrintInfo);
+        if (pEnabled)
+        {
+            VariableT::initializeFromStudy(study);
+        }
+        else
+        {
+            NextType::initializeFromStudy(study);
+        }
+    }
+
+    //! Is the variable computed ?
+    bool enabled() const
+    {
+        return pEnabled;
+    }
+
+#define ANTARES_PRUNABLE_FORWARD(NAME)                               \
+    template<class... ArgsT>                                         \
+    void NAME(ArgsT&&... args)                                       \
+    {                                                                \
+        if (pEnabled)                                                \
+        {                                                            \
+            VariableT::NAME(std::forward<ArgsT>(args)...);           \
+        }                                                            \
+        else                                                         \
+        {                                                            \
+            NextType::NAME(std::forward<ArgsT>(args)...);            \
+        }                                                            \
+    }
+
+    ANTARES_PRUNABLE_FORWARD(initializeFromArea)
+    ANTARES_PRUNABLE_FORWARD(initializeFromLink)
+    ANTARES_PRUNABLE_FORWARD(initializeFromAreaLink)
+    ANTARES_PRUNABLE_FORWARD(initializeFromThermalCluster)
+    ANTARES_PRUNABLE_FORWARD(simulationBegin)
+    ANTARES_PRUNABLE_FORWARD(simulationEnd)
+    ANTARES_PRUNABLE_FORWARD(yearBegin)
+    ANTARES_PRUNABLE_FORWARD(yearEndBuild)
+    ANTARES_PRUNABLE_FORWARD(yearEndBuildPrepareDataForEachThermalCluster)
+    ANTARES_PRUNABLE_FORWARD(yearEndBuildForEachThermalCluster)
+    ANTARES_PRUNABLE_FORWARD(yearEnd)
+    ANTARES_PRUNABLE_FORWARD(yearEndSpatialAggregates)
+    ANTARES_PRUNABLE_FORWARD(computeSummary)
+    ANTARES_PRUNABLE_FORWARD(computeSpatialAggregatesSummary)
+    ANTARES_PRUNABLE_FORWARD(simulationEndSpatialAggregates)
+    ANTARES_PRUNABLE_FORWARD(hourBegin)
+    ANTARES_PRUNABLE_FORWARD(hourForEachArea)
+    ANTARES_PRUNABLE_FORWARD(hourForEachLink)
+    ANTARES_PRUNABLE_FORWARD(hourEnd)
+    ANTARES_PRUNABLE_FORWARD(weekBegin)
+    ANTARES_PRUNABLE_FORWARD(weekForEachArea)
+    ANTARES_PRUNABLE_FORWARD(weekEnd)
+    ANTARES_PRUNABLE_FORWARD(beforeYearByYearExport)
+
+#undef ANTARES_PRUNABLE_FORWARD
+
+    template<class VCardSearchT, class O, class... ArgsT>
+    void computeSpatialAggregateWith(O& out, ArgsT&&... args)
+    {
+        if (pEnabled)
+        {
+            VariableT::template computeSpatialAggregateWith<VCardSearchT, O>(
+              out,
+              std::forward<ArgsT>(args)...);
+        }
+        else
+        {
+            NextType::template computeSpatialAggregateWith<VCardSearchT, O>(
+              out,
+              std::forward<ArgsT>(args)...);
+        }
+    }
+
+    template<class VCardToFindT>
+    const double* retrieveHourlyResultsForCurrentYear(uint numSpace) const
+    {
+        return pEnabled
+                 ? VariableT::template retrieveHourlyResultsForCurrentYear<VCardToFindT>(numSpace)
+                 : NextType::template retrieveHourlyResultsForCurrentYear<VCardToFindT>(numSpace);
+    }
+
+    template<class VCardToFindT>
+    void retrieveResultsForArea(typename Storage<VCardToFindT>::ResultsType** result,
+                                const Data::Area* area)
+    {
+        if (pEnabled)
+        {
+            VariableT::template retrieveResultsForArea<VCardToFindT>(result, area);
+        }
+        else
+        {
+            NextType::template retrieveResultsForArea<VCardToFindT>(result, area);
+        }
+    }
+
+    template<class VCardToFindT>
+    void retrieveResultsForThermalCluster(typename Storage<VCardToFindT>::ResultsType** result,
+                                          const Data::ThermalCluster* cluster)
+    {
+        if (pEnabled)
+        {
+            VariableT::template retrieveResultsForThermalCluster<VCardToFindT>(result, cluster);
+        }
+        else
+        {
+            NextType::template retrieveResultsForThermalCluster<VCardToFindT>(result, cluster);
+        }
+    }
+
+    void buildSurveyReport(SurveyResults& results,
+                           int dataLevel,
+                           int fileLevel,
+                           int precision) const
+    {
+        if (pEnabled)
+        {
+            VariableT::buildSurveyReport(results, dataLevel, fileLevel, precision);
+        }
+        else
+        {
+            NextType::buildSurveyReport(results, dataLevel, fileLevel, precision);
+        }
+    }
+
+    void buildAnnualSurveyReport(SurveyResults& results,
+                                 int dataLevel,
+                                 int fileLevel,
+                                 int precision,
+                                 uint numSpace) const
+    {
+        if (pEnabled)
+        {
+            VariableT::buildAnnualSurveyReport(results, dataLevel, fileLevel, precision, numSpace);
+        }
+        else
+        {
+            NextType::buildAnnualSurveyReport(results, dataLevel, fileLevel, precision, numSpace);
+        }
+    }
+
+    void buildDigest(SurveyResults& results, int digestLevel, int dataLevel) const
+    {
+        if (pEnabled)
+        {
+            VariableT::buildDigest(results, digestLevel, dataLevel);
+        }
+        else
+        {
+            NextType::buildDigest(results, digestLevel, dataLevel);
+        }
+    }
+
+private:
+    //! Flag to know if the variable is computed
+    bool pEnabled = true;
+
+}; // class Prunable
+
+} // namespace Antares::Solver::Variable
+
+#endif // __SOLVER_VARIABLE_PRUNABLE_H__
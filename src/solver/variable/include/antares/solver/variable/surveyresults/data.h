@@ -21,6 +21,11 @@
 #ifndef __SOLVER_VARIABLE_SURVEY_RESULTS_DATA_H__
 #define __SOLVER_VARIABLE_SURVEY_RESULTS_DATA_H__
 
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <yuni/yuni.h>
 #include <yuni/core/string.h>
 
@@ -54,6 +59,16 @@ public:
     */
     void exportGridInfos(IResultWriter& writer);
 
+    /*!
+    ** \brief Label of a row (index, date...) in the reports, for a given precision level
+    **
+    ** The labels of all rows are generated at once, the first time a precision level
+    ** is requested. The returned view starts with a tab.
+    **
+    ** \param row The row index (one-based)
+    */
+    std::string_view rowLabel(unsigned int row, int precisionLevel);
+
 public:
     //! The current column index
     unsigned int columnIndex;
@@ -96,6 +111,17 @@ public:
 
     Yuni::Clob fileBuffer;
 
+private:
+    //! Labels of all rows for a precision level, one after the other
+    struct RowLabels
+    {
+        std::string text;
+        //! Offset of each label in `text`, plus the final size
+        std::vector<unsigned int> offsets;
+    };
+    //! Row labels, for each precision level (hourly, daily, weekly, monthly, annual)
+    std::array<RowLabels, 5> pRowLabels;
+
 }; // class SurveyResultsData
 
 /*!
@@ -105,6 +131,16 @@ void InternalExportDigestLinksMatrix(const Data::Study& study,
                                      const char* title,
                                      std::string& fileBuffer,
                                      const Matrix<>& matrix);
+
+/*!
+** \brief Append the label of a row (index, date...) in the reports
+**
+** \param row The row index (one-based)
+*/
+void AppendRowLabel(Yuni::Clob& out,
+                    const Date::Calendar& calendar,
+                    unsigned int row,
+                    int precisionLevel);
 } // namespace Private
 } // namespace Variable
 } // namespace Solver
@@ -136,16 +136,22 @@ public:
     IResultWriter& pResultWriter;
 
 private:
-    template<class StringT, class ConvertT, class PrecisionT>
+    //! Estimated size of a value in the text files (tab included), to reserve the buffer
+    static constexpr uint averageValueSize = 10;
+
+    template<class StringT, class PrecisionT>
     void AppendDoubleValue(uint& error,
                            const double v,
                            StringT& buffer,
-                           ConvertT& conversionBuffer,
+                           int decimals,
                            const PrecisionT& precision,
                            const bool isNotApplicable);
 
     void writeDateToFileDescriptor(uint row, int precisionLevel);
 
+    //! Write the data as a columnar table, instead of text (see Antares::Columnar)
+    void saveToColumnarFile(uint heightBegin, uint heightEnd, int precisionLevel);
+
 }; // class SurveyResults
 
 } // namespace Antares::Solver::Variable
@@ -23,13 +23,16 @@
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include <yuni/yuni.h>
 
+#include <antares/columnar/writer.h>
 #include <antares/logs/logs.h>
 #include <antares/solver/variable/print.h>
 #include <antares/study/study.h>
 #include <antares/utils/utils.h>
+#include <antares/utils/value-format.h>
 
 using namespace Antares;
 
@@ -49,10 +52,6 @@ void InternalExportDigestLinksMatrix(const Data::Study& study,
     }
     buffer.append("\n");
 
-    char conversionBuffer[256];
-    conversionBuffer[0] = '\t';
-    int sizePrintf;
-
     uint count = study.areas.size();
     buffer.reserve(10 + count * (1 /*tab*/ + 7));
 
@@ -79,29 +78,9 @@ void InternalExportDigestLinksMatrix(const Data::Study& study,
                     {
                         buffer.append("\t0");
                     }
-                    else
+                    else if (!Utils::AppendFixedValue(buffer, v, 0, "%.0f"))
                     {
-// The snprintf routine is required since we may not have the ending zero
-// with the standard printf. The conversion may require a bigger buffer.
-#ifdef YUNI_OS_MSVC
-                        sizePrintf = ::sprintf_s(conversionBuffer + 1,
-                                                 sizeof(conversionBuffer) - 2,
-                                                 "%.0f",
-                                                 v);
-#else
-                        sizePrintf = ::snprintf(conversionBuffer + 1,
-                                                sizeof(conversionBuffer) - 2,
-                                                "%.0f",
-                                                v);
-#endif
-                        if (sizePrintf >= 0)
-                        {
-                            buffer.append((const char*)conversionBuffer);
-                        }
-                        else
-                        {
-                            buffer.append("\tERR");
-                        }
+                        buffer.append("\tERR");
                     }
                 }
             }
@@ -219,39 +198,12 @@ void SurveyResultsData::exportGridInfos(IResultWriter& writer)
     output.clear();
     Solver::Variable::Private::ExportGridInfosAreas(study, originalOutput, writer);
 }
-} // namespace Antares::Solver::Variable::Private
 
-namespace Antares
-{
-namespace Solver
-{
-namespace Variable
-{
-static inline uint GetRangeLimit(const Data::Study& study, int precisionLevel, int index)
+void AppendRowLabel(Yuni::Clob& out,
+                    const Date::Calendar& calendar,
+                    unsigned int row,
+                    int precisionLevel)
 {
-    switch (precisionLevel)
-    {
-    case Category::hourly:
-        return study.runtime.rangeLimits.hour[index];
-    case Category::daily:
-        return study.runtime.rangeLimits.day[index];
-    case Category::weekly:
-        return study.runtime.rangeLimits.week[index];
-    case Category::monthly:
-        return study.runtime.rangeLimits.month[index];
-    case Category::annual:
-        return 0;
-    default:
-        return 0;
-    }
-}
-
-// inline : only used in this cpp file
-inline void SurveyResults::writeDateToFileDescriptor(uint row, int precisionLevel)
-{
-    auto& out = data.fileBuffer;
-    auto& calendar = data.study.calendarOutput; // data.study.calendar;
-
     switch (precisionLevel)
     {
     case Category::hourly:
@@ -335,11 +287,104 @@ inline void SurveyResults::writeDateToFileDescriptor(uint row, int precisionLeve
     }
 }
 
-template<class StringT, class ConvertT, class PrecisionT>
+std::string_view SurveyResultsData::rowLabel(unsigned int row, int precisionLevel)
+{
+    uint index;
+    uint count;
+    switch (precisionLevel)
+    {
+    case Category::hourly:
+        index = 0;
+        count = Date::Calendar::maxHoursInYear;
+        break;
+    case Category::daily:
+        index = 1;
+        count = Date::Calendar::maxDaysInYear;
+        break;
+    case Category::weekly:
+        index = 2;
+        count = Date::Calendar::maxWeeksInYear;
+        break;
+    case Category::monthly:
+        index = 3;
+        count = 12;
+        break;
+    case Category::annual:
+        index = 4;
+        count = 1;
+        break;
+    default:
+        return {};
+    }
+
+    if (row == 0 || row > count)
+    {
+        return {};
+    }
+
+    auto& labels = pRowLabels[index];
+    if (labels.offsets.empty())
+    {
+        Yuni::Clob text;
+        labels.offsets.reserve(count + 1);
+        for (uint r = 1; r <= count; ++r)
+        {
+            labels.offsets.push_back(text.size());
+            AppendRowLabel(text, study.calendarOutput, r, precisionLevel);
+        }
+        labels.offsets.push_back(text.size());
+        labels.text.assign(text.c_str(), text.size());
+    }
+
+    uint offset = labels.offsets[row - 1];
+    return std::string_view(labels.text).substr(offset, labels.offsets[row] - offset);
+}
+} // namespace Antares::Solver::Variable::Private
+
+namespace Antares
+{
+namespace Solver
+{
+namespace Variable
+{
+static inline uint GetRangeLimit(const Data::Study& study, int precisionLevel, int index)
+{
+    switch (precisionLevel)
+    {
+    case Category::hourly:
+        return study.runtime.rangeLimits.hour[index];
+    case Category::daily:
+        return study.runtime.rangeLimits.day[index];
+    case Category::weekly:
+        return study.runtime.rangeLimits.week[index];
+    case Category::monthly:
+        return study.runtime.rangeLimits.month[index];
+    case Category::annual:
+        return 0;
+    default:
+        return 0;
+    }
+}
+
+// inline : only used in this cpp file
+inline void SurveyResults::writeDateToFileDescriptor(uint row, int precisionLevel)
+{
+    auto label = data.rowLabel(row, precisionLevel);
+    if (!label.empty())
+    {
+        data.fileBuffer.append(label.data(), (uint)label.size());
+    }
+    else
+    {
+        Private::AppendRowLabel(data.fileBuffer, data.study.calendarOutput, row, precisionLevel);
+    }
+}
+
+template<class StringT, class PrecisionT>
 inline void SurveyResults::AppendDoubleValue(uint& error,
                                              double v,
                                              StringT& buffer,
-                                             ConvertT& conversionBuffer,
+                                             int decimals,
                                              const PrecisionT& precision,
                                              const bool isNotApplicable)
 {
@@ -370,30 +415,9 @@ inline void SurveyResults::AppendDoubleValue(uint& error,
                     logs.error() << "'infinite' value detected";
                 }
             }
-            else
+            else if (!Utils::AppendFixedValue(buffer, v, decimals, precision.c_str()))
             {
-#ifdef YUNI_OS_MSVC
-                int sizePrintf = ::sprintf_s(conversionBuffer + 1,
-                                             sizeof(conversionBuffer) - 2,
-                                             precision.c_str(),
-                                             v);
-#else
-                int sizePrintf = ::snprintf(conversionBuffer + 1,
-                                            sizeof(conversionBuffer) - 2,
-                                            precision.c_str(),
-                                            v);
-#endif
-
-                if (sizePrintf >= 0)
-                {
-                    // +1 is related to the tab character already present in the
-                    // conversion buffer
-                    buffer.append((const char*)conversionBuffer, 1 + sizePrintf);
-                }
-                else
-                {
-                    buffer += "\tERR";
-                }
+                buffer += "\tERR";
             }
         }
     }
@@ -620,9 +644,11 @@ void SurveyResults::exportDigestAllYears(std::string& buffer)
         buffer.append("\n");
     }
 
-    char conversionBuffer[128];
-    conversionBuffer[0] = '\t';
-    int sizePrintf;
+    std::vector<int> decimals(data.columnIndex);
+    for (uint i = 0; i != data.columnIndex; ++i)
+    {
+        decimals[i] = Utils::FixedFormatDecimals(precision[i].c_str());
+    }
 
     auto end = data.rowCaptions.end();
     uint y = 0;
@@ -649,29 +675,12 @@ void SurveyResults::exportDigestAllYears(std::string& buffer)
             {
                 buffer.append("\t0");
             }
-            else
+            else if (!Utils::AppendFixedValue(buffer,
+                                              values[i][y],
+                                              decimals[i],
+                                              precision[i].c_str()))
             {
-// The snprintf routine is required since we may not have the ending zero
-// with the standard printf. The conversion may require a bigger buffer.
-#ifdef YUNI_OS_MSVC
-                sizePrintf = ::sprintf_s(conversionBuffer + 1,
-                                         sizeof(conversionBuffer) - 2,
-                                         precision[i].c_str(),
-                                         values[i][y]);
-#else
-                sizePrintf = ::snprintf(conversionBuffer + 1,
-                                        sizeof(conversionBuffer) - 2,
-                                        precision[i].c_str(),
-                                        values[i][y]);
-#endif
-                if (sizePrintf >= 0)
-                {
-                    buffer.append((const char*)conversionBuffer);
-                }
-                else
-                {
-                    buffer.append("\tERR");
-                }
+                buffer.append("\tERR");
             }
         }
 
@@ -692,7 +701,6 @@ void SurveyResults::saveToFile(int dataLevel, int fileLevel, int precisionLevel)
 
     // Clearing the buffer
     data.fileBuffer.clear();
-    data.fileBuffer.reserve(2 * 1024 * 1024);
 
     // How many rows have we got ?
     const uint heightBegin = GetRangeLimit(data.study, precisionLevel, Data::rangeBegin);
@@ -766,17 +774,28 @@ void SurveyResults::saveToFile(int dataLevel, int fileLevel, int precisionLevel)
                                             data.columnIndex);
     }
 
-    char conversionBuffer[256];
-    conversionBuffer[0] = '\t';
+    if (data.study.parameters.resultFormat == Data::columnar)
+    {
+        saveToColumnarFile(heightBegin, heightEnd, precisionLevel);
+        return;
+    }
+
     uint error = 0;
 
-#ifndef NDEBUG
-    // A few preliminary checks
+    // The format of each column is parsed once for all rows
+    std::vector<int> decimals(data.columnIndex);
     for (uint x = 0; x != data.columnIndex; ++x)
     {
         assert(not precision[x].empty() && "invalid precision");
+        decimals[x] = Utils::FixedFormatDecimals(precision[x].c_str());
+    }
+
+    // Room for all rows, so the buffer grows at most once per file
+    {
+        const uint labelSize = (uint)data.rowLabel(heightBegin + 1, precisionLevel).size();
+        const uint rowSize = labelSize + 1 /*\n*/ + data.columnIndex * averageValueSize;
+        data.fileBuffer.reserve(data.fileBuffer.size() + (heightEnd - heightBegin) * rowSize);
     }
-#endif
 
     // Each row
     for (uint y = heightBegin; y < heightEnd; ++y)
@@ -794,7 +813,7 @@ void SurveyResults::saveToFile(int dataLevel, int fileLevel, int precisionLevel)
             AppendDoubleValue(error,
                               values[x][y],
                               data.fileBuffer,
-                              conversionBuffer,
+                              decimals[x],
                               precision[x],
                               nonApplicableStatus[x]);
         }
@@ -807,6 +826,62 @@ void SurveyResults::saveToFile(int dataLevel, int fileLevel, int precisionLevel)
     pResultWriter.addEntryFromBuffer(data.filename.c_str(), data.fileBuffer);
 }
 
+void SurveyResults::saveToColumnarFile(uint heightBegin, uint heightEnd, int precisionLevel)
+{
+    // The header is already in the buffer, followed by the label of each row
+    const std::size_t preambleSize = data.fileBuffer.size();
+    for (uint y = heightBegin; y < heightEnd; ++y)
+    {
+        writeDateToFileDescriptor(y + 1, precisionLevel);
+        data.fileBuffer += '\n';
+    }
+    std::string_view text(data.fileBuffer.c_str(), data.fileBuffer.size());
+
+    const auto& parameters = data.study.parameters.columnarResults;
+    Columnar::Options options;
+    options.valueType = parameters.float32 ? Columnar::ValueType::float32
+                                           : Columnar::ValueType::float64;
+    options.compress = parameters.compress;
+
+    Columnar::TableWriter table(options, heightEnd - heightBegin);
+    table.setText(text.substr(0, preambleSize), text.substr(preambleSize));
+
+    bool hasNaN = false;
+    bool hasInf = false;
+    for (uint x = 0; x != data.columnIndex; ++x)
+    {
+        Columnar::Column column{captions[0][x].c_str(),
+                                captions[1][x].c_str(),
+                                captions[2][x].c_str(),
+                                precision[x].c_str(),
+                                nonApplicableStatus[x]};
+        const double* columnValues = values[x] + heightBegin;
+        if (!column.notApplicable)
+        {
+            for (uint y = 0; y != heightEnd - heightBegin; ++y)
+            {
+                hasNaN = hasNaN || std::isnan(columnValues[y]);
+                hasInf = hasInf || std::isinf(columnValues[y]);
+            }
+        }
+        table.addColumn(column, columnValues);
+    }
+
+    // Same diagnostics as the text files
+    if (hasNaN && !data.study.runtime.quadraticOptimizationHasFailed)
+    {
+        logs.error() << "'NaN' value detected";
+    }
+    if (hasInf)
+    {
+        logs.error() << "'infinite' value detected";
+    }
+
+    std::filesystem::path filename = data.filename.c_str();
+    filename.replace_extension(Columnar::extension);
+    pResultWriter.addEntryFromBuffer(filename, table.finalize());
+}
+
 void SurveyResults::exportGridInfos()
 {
     data.exportGridInfos(pResultWriter);
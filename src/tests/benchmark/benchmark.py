@@ -58,6 +58,9 @@ class StudyList(object):
         json_data["durations_s"] = dict(config.items('durations_ms'))
         json_data["optimization problem"] = dict(config.items('optimization problem'))
         json_data["study"] = dict(config.items('study'))
+        # MC years per hour, to compare the settings of the solver
+        if config.has_section('throughput'):
+            json_data["throughput"] = dict(config.items('throughput'))
 
         # convert ms into seconds
         durations = json_data['durations_s']
@@ -245,6 +245,7 @@ BOOST_FIXTURE_TEST_CASE(parallel, StudyFixture)
 {
     setNumberMCyears(10);
     study->maxNbYearsInParallel = 2;
+    study->maxNbYearsRunning = 2;
 
     simulation->create();
     simulation->run();
@@ -258,6 +259,7 @@ BOOST_FIXTURE_TEST_CASE(parallel2, StudyFixture)
 {
     setNumberMCyears(2);
     study->maxNbYearsInParallel = 2;
+    study->maxNbYearsRunning = 2;
 
     loadTSconfig.setColumnCount(2).fillColumnWith(0, 7.0).fillColumnWith(1, 7.0);
 
@@ -272,6 +274,37 @@ BOOST_FIXTURE_TEST_CASE(parallel2, StudyFixture)
     BOOST_TEST(output.load(area).hour(0) == loadInArea, tt::tolerance(0.001));
 }
 
+BOOST_FIXTURE_TEST_CASE(daily_problems_solved_in_parallel, StudyFixture)
+{
+    setNumberMCyears(1);
+    study->maxNbYearsInParallel = 1;
+    // Whatever the number of cores of the machine
+    study->nbNestedThreads = 4;
+
+    auto& p = study->parameters;
+    p.simplexOptimizationRange = sorDay;
+    p.optOptions.parallelDailyProblems = true;
+
+    // A different load for each day, to check that each day gets its own results
+    auto& load = area->load.series.timeSeries;
+    for (unsigned int hour = 0; hour < HOURS_PER_YEAR; ++hour)
+    {
+        load[0][hour] = loadInArea + (hour / 24) % 7;
+    }
+
+    simulation->create();
+    simulation->run();
+
+    OutputRetriever output(simulation->rawSimu());
+    for (unsigned int day = 0; day < 7; ++day)
+    {
+        const unsigned int hour = day * 24 + 12;
+        BOOST_TEST(output.load(area).hour(hour) == loadInArea + day, tt::tolerance(0.001));
+        BOOST_TEST(output.overallCost(area).hour(hour) == (loadInArea + day) * clusterCost,
+                   tt::tolerance(0.001));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(error_cases)
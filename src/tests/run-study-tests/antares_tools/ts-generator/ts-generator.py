@@ -6,6 +6,7 @@ from pathlib import Path
 from utils.find_output import find_dated_output_folder
 from utils.find_reference import find_reference_folder
 from parse_studies.look_for_studies import look_for_studies
+from parse_studies.expected_changes import expected_to_change
 
 def get_ts_files(path):
     ts_files = list(path.glob('**/*.txt'))
@@ -47,6 +48,8 @@ ROOT_FOLDER = Path('../resources/batches').resolve()
 study_paths = look_for_studies(ROOT_FOLDER)
 
 @pytest.mark.tsgenerator
+# The ts-generator only generates thermal or link availability series
+@expected_to_change(True)
 def test_ts_generator(tsgenerator_path):
     for study in study_paths:
         run_and_compare(tsgenerator_path, study)
@@ -0,0 +1,46 @@
+import json
+from configparser import ConfigParser, Error
+from pathlib import Path
+
+import pytest
+
+# SimTest versions whose reference results were generated before each thermal cluster got
+# its own random generator (seed derived from the thermal seed and the rank of the cluster).
+# Remove a version once simtest.json points to references regenerated with the new seeds.
+REFERENCES_WITH_SHARED_GENERATOR = {"v9.2.0h"}
+
+SIMTEST_JSON = Path(__file__).resolve().parents[4] / "simtest.json"
+
+REASON = ("Thermal availability series are generated with per-cluster seeds, "
+          "the reference results of SimTest %s must be regenerated")
+
+
+def simtest_version():
+    with open(SIMTEST_JSON, "r") as file:
+        return json.load(file)["version"]
+
+
+def references_predate_per_cluster_seeds() -> bool:
+    return simtest_version() in REFERENCES_WITH_SHARED_GENERATOR
+
+
+def generates_thermal_series(study_path) -> bool:
+    ini = ConfigParser(strict=False, interpolation=None)
+    try:
+        ini.read(Path(study_path) / "settings" / "generaldata.ini")
+    except Error:
+        return False
+    generate = ini.get("general", "generate", fallback="")
+    return "thermal" in [word.strip().lower() for word in generate.split(",")]
+
+
+def expected_to_change(generates_series: bool):
+    # Results generated with the previous seeds are expected to differ from their references :
+    # the test is reported as XFAIL instead of failing the whole batch
+    return pytest.mark.xfail(generates_series and references_predate_per_cluster_seeds(),
+                             reason=REASON % simtest_version(),
+                             strict=False)
+
+
+def expected_to_change_marks(study_path):
+    return [expected_to_change(generates_thermal_series(study_path))]
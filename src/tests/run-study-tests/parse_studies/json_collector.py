@@ -3,6 +3,10 @@ from jsonschema import validate, Draft7Validator
 from pathlib import Path
 import os.path
 
+import pytest
+
+from parse_studies.expected_changes import expected_to_change_marks
+
 class error:
     def __init__(self, type, items = []):
         self.type = type
@@ -45,7 +49,8 @@ class checksRetriever:
         for test in self.json_file_content:
             study_path_id = self.study_path.parts[-2] + " / " + self.study_path.parts[-1]
             self.test_ids.append(test["name"] + "  (%s)" % study_path_id)
-            self.test_pairs.append((self.study_path, test["checks"]))
+            self.test_pairs.append(pytest.param(self.study_path, test["checks"],
+                                                marks=expected_to_change_marks(self.study_path)))
 
     def json_file_exists(self) -> bool:
         if not os.path.isfile(self.json_file):
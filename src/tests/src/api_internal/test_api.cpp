@@ -23,6 +23,8 @@
 #define WIN32_LEAN_AND_MEAN
 
 #include <filesystem>
+#include <mutex>
+#include <set>
 
 #include <boost/test/unit_test.hpp>
 
@@ -89,6 +91,83 @@ BOOST_AUTO_TEST_CASE(result_contains_problems)
     BOOST_CHECK_EQUAL(results.antares_problems.weeklyProblems.size(), 52);
 }
 
+// Keeps track of what is received, without keeping the problems themselves
+class CountingConsumer: public Antares::API::ILpsConsumer
+{
+public:
+    explicit CountingConsumer(bool wantsSolutions = false):
+        wantsSolutions_(wantsSolutions)
+    {
+    }
+
+    void onConstantData(Antares::Solver::ConstantDataFromAntares&& data) override
+    {
+        std::lock_guard lock(mutex_);
+        constantDataCount++;
+        variablesCount = data.VariablesCount;
+    }
+
+    void onWeeklyProblem(Antares::Solver::WeeklyProblemId id,
+                         Antares::Solver::WeeklyDataFromAntares&& data) override
+    {
+        std::lock_guard lock(mutex_);
+        constantDataReceivedFirst = constantDataReceivedFirst && constantDataCount == 1;
+        problems.insert(id);
+        BOOST_CHECK_EQUAL(data.LinearCost.size(), variablesCount);
+    }
+
+    bool wantsSolutions() const override
+    {
+        return wantsSolutions_;
+    }
+
+    void onWeeklySolution(Antares::Solver::WeeklyProblemId id,
+                          Antares::Solver::WeeklySolutionFromAntares&& solution) override
+    {
+        std::lock_guard lock(mutex_);
+        solutions.insert(id);
+        BOOST_CHECK_EQUAL(solution.X.size(), variablesCount);
+    }
+
+    unsigned constantDataCount = 0;
+    unsigned variablesCount = 0;
+    bool constantDataReceivedFirst = true;
+    std::set<Antares::Solver::WeeklyProblemId> problems;
+    std::set<Antares::Solver::WeeklyProblemId> solutions;
+
+private:
+    bool wantsSolutions_;
+    std::mutex mutex_;
+};
+
+BOOST_AUTO_TEST_CASE(weekly_problems_are_streamed_to_the_consumer)
+{
+    Antares::API::APIInternal api;
+    auto study_loader = std::make_unique<InMemoryStudyLoader>();
+    CountingConsumer consumer;
+    auto results = api.run(*study_loader, {}, {}, &consumer);
+
+    BOOST_CHECK(!results.error);
+    // Problems are not kept in the results
+    BOOST_CHECK(results.antares_problems.empty());
+    BOOST_CHECK_EQUAL(consumer.constantDataCount, 1);
+    BOOST_CHECK(consumer.constantDataReceivedFirst);
+    BOOST_CHECK_EQUAL(consumer.problems.size(), 52);
+    BOOST_CHECK(consumer.solutions.empty());
+}
+
+BOOST_AUTO_TEST_CASE(weekly_solutions_are_streamed_when_asked)
+{
+    Antares::API::APIInternal api;
+    auto study_loader = std::make_unique<InMemoryStudyLoader>();
+    CountingConsumer consumer(true);
+    auto results = api.run(*study_loader, {}, {}, &consumer);
+
+    BOOST_CHECK(!results.error);
+    BOOST_CHECK_EQUAL(consumer.solutions.size(), 52);
+    BOOST_CHECK(consumer.solutions == consumer.problems);
+}
+
 // Test where data in problems are consistant with data in study
 BOOST_AUTO_TEST_CASE(result_with_ortools_coin)
 {
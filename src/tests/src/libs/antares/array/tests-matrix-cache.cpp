@@ -0,0 +1,131 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test - lib - antares - matrix cache
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <filesystem>
+#include <fstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/array/matrix-cache.h>
+#include <antares/array/matrix.h>
+
+#include "files-system.h"
+
+namespace fs = std::filesystem;
+using namespace Antares;
+
+namespace
+{
+void writeFile(const fs::path& path, const std::string& content)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+// Enable the cache for the duration of a test
+struct CacheFixture
+{
+    CacheFixture()
+    {
+        MatrixCache::folder = fs::temp_directory_path() / "antares-matrix-cache-tests";
+        fs::remove_all(MatrixCache::folder);
+    }
+
+    ~CacheFixture()
+    {
+        fs::remove_all(MatrixCache::folder);
+        MatrixCache::folder.clear();
+    }
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(matrix_cache, CacheFixture)
+
+BOOST_AUTO_TEST_CASE(matrix_loaded_twice___second_load_is_served_by_the_cache)
+{
+    auto working_tmp_dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    const fs::path source = working_tmp_dir / "matrix.txt";
+    writeFile(source, "1.5\t2\n3\t-4.25\n");
+
+    Matrix<double> first;
+    BOOST_CHECK(first.loadFromCSVFile(source.string(), 2, 2, Matrix<>::optFixedSize));
+    const MatrixCache::Key key{source, sizeof(double), 2, 2, Matrix<>::optFixedSize};
+    BOOST_REQUIRE(fs::exists(MatrixCache::EntryPath(key)));
+    BOOST_CHECK(MatrixCache::Verify(MatrixCache::EntryPath(key))
+                == MatrixCache::Status::upToDate);
+
+    // Same size and same modification time: the text is not parsed again
+    const auto lastWriteTime = fs::last_write_time(source);
+    writeFile(source, "9.5\t9\n9\t-9.25\n");
+    fs::last_write_time(source, lastWriteTime);
+
+    Matrix<double> second;
+    BOOST_CHECK(second.loadFromCSVFile(source.string(), 2, 2, Matrix<>::optFixedSize));
+    BOOST_REQUIRE_EQUAL(second.width, 2);
+    BOOST_REQUIRE_EQUAL(second.height, 2);
+    BOOST_CHECK_EQUAL(second[0][0], 1.5);
+    BOOST_CHECK_EQUAL(second[1][0], 2.);
+    BOOST_CHECK_EQUAL(second[0][1], 3.);
+    BOOST_CHECK_EQUAL(second[1][1], -4.25);
+}
+
+BOOST_AUTO_TEST_CASE(source_modified___entry_is_stale_and_text_is_parsed_again)
+{
+    auto working_tmp_dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    const fs::path source = working_tmp_dir / "matrix.txt";
+    writeFile(source, "1\t2\n");
+
+    Matrix<double> first;
+    BOOST_CHECK(first.loadFromCSVFile(source.string(), 1, 0, Matrix<>::optNone));
+
+    writeFile(source, "10\t20\t30\n");
+    const MatrixCache::Key key{source, sizeof(double), 1, 0, Matrix<>::optNone};
+    BOOST_CHECK(MatrixCache::Verify(MatrixCache::EntryPath(key)) == MatrixCache::Status::stale);
+
+    Matrix<double> second;
+    BOOST_CHECK(second.loadFromCSVFile(source.string(), 1, 0, Matrix<>::optNone));
+    BOOST_REQUIRE_EQUAL(second.width, 3);
+    BOOST_CHECK_EQUAL(second[2][0], 30.);
+    BOOST_CHECK(MatrixCache::Verify(MatrixCache::EntryPath(key))
+                == MatrixCache::Status::upToDate);
+}
+
+BOOST_AUTO_TEST_CASE(float_and_double_matrices___do_not_share_entries)
+{
+    auto working_tmp_dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    const fs::path source = working_tmp_dir / "matrix.txt";
+    writeFile(source, "0.1\n");
+
+    Matrix<double> asDouble;
+    BOOST_CHECK(asDouble.loadFromCSVFile(source.string(), 1, 1, Matrix<>::optFixedSize));
+    Matrix<float> asFloat;
+    BOOST_CHECK(asFloat.loadFromCSVFile(source.string(), 1, 1, Matrix<>::optFixedSize));
+    BOOST_CHECK_EQUAL(asFloat[0][0], 0.1f);
+
+    Matrix<float> asFloatFromCache;
+    BOOST_CHECK(asFloatFromCache.loadFromCSVFile(source.string(), 1, 1, Matrix<>::optFixedSize));
+    BOOST_CHECK_EQUAL(asFloatFromCache[0][0], 0.1f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
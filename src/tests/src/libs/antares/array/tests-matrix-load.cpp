@@ -24,9 +24,14 @@
 
 #include "tests-matrix-load.h"
 
+#include <charconv>
+#include <chrono>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <random>
 #include <stdio.h>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 
@@ -268,6 +273,39 @@ BOOST_AUTO_TEST_CASE(fake_file_double_thermal)
     BOOST_REQUIRE_EQUAL(mtx.entry[2][1], -6);
 }
 
+// 1.c.
+BOOST_AUTO_TEST_CASE(file_with_unusual_notations___coefs_are_the_same_as_strtod)
+{
+    const std::vector<std::string> cells = {"+1.5",
+                                            "1e-320",
+                                            "0x10",
+                                            "-0",
+                                            "3.14159265358979323846",
+                                            "1e400",
+                                            ".5",
+                                            "7."};
+    Clob* fake_buffer = new Clob;
+    for (uint i = 0; i != cells.size(); ++i)
+    {
+        fake_buffer->append(cells[i]);
+        fake_buffer->append(i + 1 == cells.size() ? "\n" : "\t");
+    }
+
+    Matrix_mock_load_to_buffer<double, double> mtx;
+    BOOST_CHECK(
+      mtx.loadFromCSVFile("path/to/a/file", cells.size(), 1, Matrix<>::optNone, fake_buffer));
+
+    delete fake_buffer;
+
+    BOOST_REQUIRE_EQUAL(mtx.height, 1);
+    BOOST_REQUIRE_EQUAL(mtx.width, cells.size());
+    for (uint x = 0; x != cells.size(); ++x)
+    {
+        const double expected = ::strtod(cells[x].c_str(), nullptr);
+        BOOST_CHECK_EQUAL(std::memcmp(&mtx.entry[x][0], &expected, sizeof(double)), 0);
+    }
+}
+
 // 1.f.
 BOOST_AUTO_TEST_CASE(file_with_alphabetic_char___load_fails_with_warning)
 {
@@ -891,3 +929,114 @@ BOOST_AUTO_TEST_CASE(
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+// Former cell loop of Matrix::loadFromBuffer : cells are delimited with find_first_of, measured
+// again with strlen and converted with strtod.
+// Used as a reference, both for the values and for the loading times.
+namespace Reference
+{
+void loadCells(Clob& data, uint width, uint height, std::vector<double>& entries)
+{
+    entries.assign(static_cast<size_t>(width) * height, 0.);
+    Clob::Size offset = 0;
+    uint y = 0;
+    AnyString converter;
+
+    while (y < height and offset < data.size())
+    {
+        uint x = 0;
+        Clob::Size pos = offset;
+        while ((offset = data.find_first_of(ANTARES_MATRIX_CSV_SEPARATORS, offset)) != Clob::npos)
+        {
+            const char separator = data[offset];
+            data[offset] = '\0';
+            converter = (const char*)data.c_str() + pos;
+            if (not converter.empty() and x < width)
+            {
+                char* pend;
+                entries[static_cast<size_t>(x) * height + y] = ::strtod(converter.c_str(), &pend);
+            }
+            pos = ++offset;
+            ++x;
+            if (separator == '\n')
+            {
+                break;
+            }
+        }
+        ++y;
+    }
+}
+} // namespace Reference
+
+BOOST_AUTO_TEST_SUITE(load_times)
+
+// A year of hourly values with 3 decimals, for 1000 columns
+static Clob* hourlyBuffer(uint width, uint height)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> distribution(-1000., 10000.);
+    Clob* buffer = new Clob;
+    buffer->reserve(static_cast<size_t>(width) * height * 10);
+    char cell[32];
+    for (uint y = 0; y != height; ++y)
+    {
+        for (uint x = 0; x != width; ++x)
+        {
+            auto result = std::to_chars(cell,
+                                        cell + sizeof(cell),
+                                        distribution(gen),
+                                        std::chars_format::fixed,
+                                        3);
+            buffer->append(cell, static_cast<uint>(result.ptr - cell));
+            *buffer += (x + 1 == width ? '\n' : '\t');
+        }
+    }
+    return buffer;
+}
+
+BOOST_AUTO_TEST_CASE(hourly_file_with_1000_columns___compare_loading_times_with_the_former_cell_loop)
+{
+    const uint width = 1000;
+    const uint height = 8760;
+    Clob* original = hourlyBuffer(width, height);
+
+    // Both loops write into the buffer : each one is given its own copy
+    Clob* referenceBuffer = new Clob(*original);
+    std::vector<double> expected;
+    const auto referenceStart = std::chrono::steady_clock::now();
+    Reference::loadCells(*referenceBuffer, width, height, expected);
+    const std::chrono::duration<double, std::milli> referenceDuration
+      = std::chrono::steady_clock::now() - referenceStart;
+    delete referenceBuffer;
+
+    // The whole loading is measured here, including the resizing of the matrix
+    Matrix_mock_load_to_buffer<double, double> mtx;
+    const auto start = std::chrono::steady_clock::now();
+    BOOST_CHECK(
+      mtx.loadFromCSVFile("path/to/a/file", width, height, Matrix<>::optImmediate, original));
+    const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now()
+                                                                - start;
+    delete original;
+
+    BOOST_TEST_MESSAGE("Loading of " << height << "x" << width << " cells : " << duration.count()
+                                     << " ms, former cell loop : " << referenceDuration.count()
+                                     << " ms");
+
+    BOOST_REQUIRE_EQUAL(mtx.width, width);
+    BOOST_REQUIRE_EQUAL(mtx.height, height);
+    uint nbDifferences = 0;
+    for (uint x = 0; x != width; ++x)
+    {
+        for (uint y = 0; y != height; ++y)
+        {
+            const double& reference = expected[static_cast<size_t>(x) * height + y];
+            if (std::memcmp(&mtx.entry[x][y], &reference, sizeof(double)) != 0)
+            {
+                ++nbDifferences;
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL(nbDifferences, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
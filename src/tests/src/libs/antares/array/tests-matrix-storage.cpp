@@ -0,0 +1,169 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test - lib - antares - matrix storage
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/array/matrix.h>
+
+using namespace Antares;
+
+namespace
+{
+bool isAligned(const void* pointer)
+{
+    return reinterpret_cast<std::uintptr_t>(pointer) % 64 == 0;
+}
+
+template<class T>
+void fillWithIndexes(Matrix<T>& m)
+{
+    for (uint x = 0; x != m.width; ++x)
+    {
+        for (uint y = 0; y != m.height; ++y)
+        {
+            m[x][y] = (T)(x * 1000 + y);
+        }
+    }
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(matrix_storage)
+
+BOOST_AUTO_TEST_CASE(columns_are_aligned_and_independent)
+{
+    Matrix<double> m(4, 365);
+    fillWithIndexes(m);
+
+    for (uint x = 0; x != m.width; ++x)
+    {
+        BOOST_CHECK(isAligned(m[x]));
+        BOOST_CHECK_EQUAL(m[x][0], x * 1000);
+        BOOST_CHECK_EQUAL(m[x][364], x * 1000 + 364);
+    }
+
+    Matrix<float> f(3, 5);
+    for (uint x = 0; x != f.width; ++x)
+    {
+        BOOST_CHECK(isAligned(f[x]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(column_view_shares_the_column)
+{
+    Matrix<double> m(2, 10);
+    m.zero();
+
+    auto view = m.columnView(1);
+    BOOST_CHECK_EQUAL(view.size(), 10);
+    BOOST_CHECK_EQUAL(view.data(), m[1]);
+
+    view[3] = 42.;
+    BOOST_CHECK_EQUAL(m[1][3], 42.);
+
+    const Matrix<double>& constMatrix = m;
+    BOOST_CHECK_EQUAL(constMatrix.columnView(1)[3], 42.);
+}
+
+BOOST_AUTO_TEST_CASE(zero_and_fill_cover_all_columns)
+{
+    Matrix<double> m(3, 7);
+    m.fill(2.5);
+    BOOST_CHECK_EQUAL(m.findLowerBound(), 2.5);
+    BOOST_CHECK_EQUAL(m.findUpperBound(), 2.5);
+
+    m.zero();
+    BOOST_CHECK_EQUAL(m.findLowerBound(), 0.);
+    BOOST_CHECK_EQUAL(m.findUpperBound(), 0.);
+}
+
+BOOST_AUTO_TEST_CASE(copy_move_and_swap)
+{
+    Matrix<double> m(3, 9);
+    fillWithIndexes(m);
+
+    Matrix<double> copy(m);
+    BOOST_CHECK_NE(copy[0], m[0]);
+    BOOST_CHECK_EQUAL(copy[2][8], 2008.);
+
+    Matrix<double, int32_t> otherReadWrite;
+    otherReadWrite.copyFrom(m);
+    BOOST_CHECK_EQUAL(otherReadWrite[1][5], 1005.);
+
+    Matrix<float> otherType;
+    otherType.copyFrom(m);
+    BOOST_CHECK_EQUAL(otherType[2][8], 2008.f);
+
+    Matrix<double> moved(std::move(copy));
+    BOOST_CHECK_EQUAL(moved.width, 3);
+    BOOST_CHECK_EQUAL(moved[2][8], 2008.);
+    BOOST_CHECK(copy.empty());
+
+    Matrix<double> other(1, 1);
+    other[0][0] = -1.;
+    other.swap(moved);
+    BOOST_CHECK_EQUAL(moved.width, 1);
+    BOOST_CHECK_EQUAL(moved[0][0], -1.);
+    BOOST_CHECK_EQUAL(other[1][5], 1005.);
+}
+
+BOOST_AUTO_TEST_CASE(average_keeps_a_single_column)
+{
+    Matrix<double> m(2, 4);
+    m.fillColumn(0, 1.);
+    m.fillColumn(1, 3.);
+
+    m.averageTimeseries(false);
+    BOOST_CHECK_EQUAL(m.width, 1);
+    BOOST_CHECK_EQUAL(m.height, 4);
+    BOOST_CHECK_EQUAL(m[0][0], 2.);
+    BOOST_CHECK_EQUAL(m[0][3], 2.);
+    BOOST_CHECK(isAligned(m[0]));
+}
+
+BOOST_AUTO_TEST_CASE(resize_without_data_lost)
+{
+    Matrix<double> m(3, 10);
+    fillWithIndexes(m);
+
+    // Shrinking keeps the buffer
+    m.resizeWithoutDataLost(2, 5);
+    BOOST_CHECK_EQUAL(m[1][4], 1004.);
+    m.zero();
+    BOOST_CHECK_EQUAL(m[1][4], 0.);
+
+    Matrix<double> copy(m);
+    BOOST_CHECK_EQUAL(copy.width, 2);
+    BOOST_CHECK_EQUAL(copy.height, 5);
+
+    // Growing
+    m.fillColumn(1, 7.);
+    m.resizeWithoutDataLost(3, 12, 1.);
+    BOOST_CHECK_EQUAL(m[1][4], 7.);
+    BOOST_CHECK_EQUAL(m[1][11], 1.);
+    BOOST_CHECK_EQUAL(m[2][0], 1.);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -21,11 +21,14 @@
 
 #define BOOST_TEST_MODULE test - benchmarking
 #define WIN32_LEAN_AND_MEAN
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 
 #include <antares/benchmarking/DurationCollector.h>
+#include <antares/benchmarking/file_content.h>
 #include <antares/benchmarking/timer.h>
 
 BOOST_AUTO_TEST_SUITE(durationCollector)
@@ -75,4 +78,131 @@ BOOST_AUTO_TEST_CASE(addDuration)
     BOOST_CHECK_CLOSE((double)d.getTime("test1"), 100., threshold);
 }
 
+BOOST_AUTO_TEST_CASE(unknownName)
+{
+    Benchmarking::DurationCollector d;
+    d.addDuration("test1", 1);
+
+    BOOST_CHECK_THROW(d.getTime("test2"), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(percentiles)
+{
+    Benchmarking::DurationCollector d;
+    for (int duration = 1; duration <= 100; duration++)
+    {
+        d.addDuration("test1", duration);
+    }
+
+    auto statistics = d.getStatistics("test1");
+    BOOST_CHECK_EQUAL(statistics.nbCalls, 100);
+    BOOST_CHECK_EQUAL(statistics.total, 5050);
+    BOOST_CHECK_EQUAL(statistics.max, 100);
+    // Approximated by buckets of 1/8 of a power of two
+    BOOST_CHECK_CLOSE((double)statistics.p50, 50., 12.5);
+    BOOST_CHECK_CLOSE((double)statistics.p95, 95., 12.5);
+    BOOST_CHECK_LE(statistics.p95, statistics.max);
+
+    d.addDuration("test2", 3);
+    statistics = d.getStatistics("test2");
+    BOOST_CHECK_EQUAL(statistics.p50, 3);
+    BOOST_CHECK_EQUAL(statistics.p95, 3);
+}
+
+BOOST_AUTO_TEST_CASE(manyThreads)
+{
+    Benchmarking::DurationCollector d;
+    const int nbThreads = 8;
+    const int nbCalls = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nbThreads; t++)
+    {
+        threads.emplace_back(
+          [&d, t]()
+          {
+              for (int i = 0; i < nbCalls; i++)
+              {
+                  d.addDuration("shared", 1);
+                  d.addDuration("thread" + std::to_string(t), 2);
+              }
+          });
+    }
+    // Merging while the threads are still writing
+    d.getAllStatistics();
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    auto all = d.getAllStatistics();
+    BOOST_CHECK_EQUAL(all.size(), nbThreads + 1);
+    BOOST_CHECK_EQUAL(all["shared"].nbCalls, nbThreads * nbCalls);
+    BOOST_CHECK_EQUAL(all["shared"].total, nbThreads * nbCalls);
+    BOOST_CHECK_EQUAL(all["thread3"].total, 2 * nbCalls);
+}
+
+BOOST_AUTO_TEST_CASE(toFileContent)
+{
+    Benchmarking::DurationCollector d;
+    d.addDuration("test1", 10);
+    d.addDuration("test1", 30);
+
+    Benchmarking::FileContent content;
+    d.toFileContent(content);
+    content.addItemToSection("study", "name", "a \"quoted\" name");
+
+    std::string json = content.saveToBufferAsJson();
+    BOOST_CHECK(json.find("\"durations_ms\": {\n    \"test1\": 40\n  }") != std::string::npos);
+    BOOST_CHECK(json.find("\"number_of_calls\": {\n    \"test1\": 2\n  }") != std::string::npos);
+    BOOST_CHECK(json.find("\"durations_max_ms\": {\n    \"test1\": 30\n  }")
+                != std::string::npos);
+    BOOST_CHECK(json.find("\"name\": \"a \\\"quoted\\\" name\"") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(toJsonOnlyValidNumbersAreUnquoted)
+{
+    Benchmarking::FileContent content;
+    for (const std::string value: {"0", "-12", "1.5", "-0.25", "3e8", "1.5E-3"})
+    {
+        content.addItemToSection("numbers", value, value);
+    }
+    for (const std::string value: {"007", "1.", ".5", "+1", "-", "1e", "0x10", "inf", "nan", ""})
+    {
+        content.addItemToSection("strings", value, value);
+    }
+
+    std::string json = content.saveToBufferAsJson();
+    for (const std::string value: {"0", "-12", "1.5", "-0.25", "3e8", "1.5E-3"})
+    {
+        BOOST_TEST_CONTEXT(value)
+        {
+            BOOST_CHECK(json.find("\"" + value + "\": " + value + "\n")
+                        != std::string::npos
+                        || json.find("\"" + value + "\": " + value + ",")
+                             != std::string::npos);
+        }
+    }
+    for (const std::string value: {"007", "1.", ".5", "+1", "-", "1e", "0x10", "inf", "nan", ""})
+    {
+        BOOST_TEST_CONTEXT(value)
+        {
+            BOOST_CHECK(json.find("\"" + value + "\": \"" + value + "\"") != std::string::npos);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(toJsonControlCharactersAreEscaped)
+{
+    Benchmarking::FileContent content;
+    content.addItemToSection("study", "name", "a\tb\rc\nd\x01\x1f");
+
+    std::string json = content.saveToBufferAsJson();
+    BOOST_CHECK(json.find("\"name\": \"a\\tb\\rc\\nd\\u0001\\u001f\"") != std::string::npos);
+    for (char c: json)
+    {
+        BOOST_CHECK(c == '\n' || static_cast<unsigned char>(c) >= 0x20);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // DurationCollector
@@ -0,0 +1,242 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test columnar results
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/utils/utils.h>
+#include <antares/utils/value-format.h>
+#include "antares/columnar/reader.h"
+#include "antares/columnar/writer.h"
+
+#include "files-system.h"
+
+using namespace Antares::Columnar;
+
+namespace
+{
+const std::string preamble = "area\tvalues\thourly\n\tVARIABLES\tBEGIN\tEND\n\t3\t1\t3\n\n"
+                             "area\thourly\t\tLOAD\tSOLAR\tMRG. PRICE\n"
+                             "\t\tMWh\tMWh\tEuro\n"
+                             "\tindex\tEXP\tEXP\tEXP\n";
+const std::string rowLabels = "\t1\t01\tJAN\n\t2\t01\tJAN\n\t3\t01\tJAN\n";
+
+const double load[] = {1234.6, 0., -2.25};
+const double price[] = {std::numeric_limits<double>::quiet_NaN(),
+                        std::numeric_limits<double>::infinity(),
+                        1e-9};
+
+// The text file written by the survey results for the same values
+const std::string expectedText = preamble
+                                 + "\t1\t01\tJAN\t1235\tN/A\tNaN\n"
+                                   "\t2\t01\tJAN\t0\tN/A\t+inf\n"
+                                   "\t3\t01\tJAN\t-2\tN/A\t0\n";
+
+std::string writeTable(const Options& options)
+{
+    TableWriter writer(options, 3);
+    writer.setText(preamble, rowLabels);
+    writer.addColumn({"LOAD", "MWh", "EXP", "%.0f", false}, load);
+    writer.addColumn({"SOLAR", "MWh", "EXP", "%.0f", true}, nullptr);
+    writer.addColumn({"MRG. PRICE", "Euro", "EXP", "%.2f", false}, price);
+    return writer.finalize();
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(columnar)
+
+BOOST_AUTO_TEST_CASE(float64_table_is_converted_back_to_the_same_text)
+{
+    for (bool compress: {false, true})
+    {
+        const std::string content = writeTable({ValueType::float64, compress});
+        TableReader reader(content.data(), content.size());
+        BOOST_CHECK_EQUAL(reader.rowCount(), 3);
+        BOOST_CHECK_EQUAL(reader.columns().size(), 3);
+        BOOST_CHECK(reader.options().compress == compress);
+
+        std::string text;
+        reader.toText(text);
+        BOOST_CHECK_EQUAL(text, expectedText);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(columns_are_found_by_name_and_read)
+{
+    const std::string content = writeTable({});
+    TableReader reader(content.data(), content.size());
+
+    const auto index = reader.find("LOAD");
+    BOOST_REQUIRE_EQUAL(index, 0);
+    BOOST_CHECK_EQUAL(reader.columns()[index].unit, "MWh");
+    BOOST_CHECK_EQUAL(reader.find("LOAD", "std"), TableReader::npos);
+    BOOST_CHECK_EQUAL(reader.find("UNKNOWN"), TableReader::npos);
+
+    std::vector<double> storage;
+    auto values = reader.values(index, storage);
+    BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), load, load + 3);
+    BOOST_CHECK(reader.values(reader.find("SOLAR"), storage).empty());
+}
+
+BOOST_AUTO_TEST_CASE(float32_values_are_rounded_to_float)
+{
+    const std::string content = writeTable({ValueType::float32, true});
+    TableReader reader(content.data(), content.size());
+
+    std::vector<double> storage;
+    auto values = reader.values(0, storage);
+    BOOST_REQUIRE_EQUAL(values.size(), 3);
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        BOOST_CHECK_EQUAL(values[i], static_cast<double>(static_cast<float>(load[i])));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(table_is_read_in_place_from_a_mapped_file)
+{
+    auto folder = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    const auto path = folder / (std::string("values-hourly") + extension);
+    {
+        const std::string content = writeTable({});
+        std::ofstream file(path, std::ios::binary);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    TableReader reader(path);
+    std::vector<double> storage;
+    auto values = reader.values(0, storage);
+    BOOST_CHECK(storage.empty()); // not copied
+    BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), load, load + 3);
+
+    std::string text;
+    reader.toText(text);
+    BOOST_CHECK_EQUAL(text, expectedText);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_tables_are_rejected)
+{
+    const std::string invalid = "not a table";
+    BOOST_CHECK_THROW(TableReader(invalid.data(), invalid.size()), std::runtime_error);
+
+    std::string content = writeTable({});
+    content[0] = 'X';
+    BOOST_CHECK_THROW(TableReader(content.data(), content.size()), std::runtime_error);
+
+    // Truncated: the trailer is missing
+    content = writeTable({});
+    content.resize(content.size() - 8);
+    BOOST_CHECK_THROW(TableReader(content.data(), content.size()), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(uncompressed_column_shorter_than_its_values_is_rejected)
+{
+    for (auto valueType: {ValueType::float64, ValueType::float32})
+    {
+        std::string content = writeTable({valueType, false});
+
+        // In the index, the name of the column follows its offset, size, raw size and flags
+        const auto name = content.rfind(std::string("\x04\0\0\0LOAD", 8));
+        BOOST_REQUIRE(name != std::string::npos);
+        const auto sizePosition = name - 1 - 2 * sizeof(uint64_t);
+        uint64_t size;
+        std::memcpy(&size, content.data() + sizePosition, sizeof(size));
+        BOOST_REQUIRE_GT(size, 0);
+        --size;
+        std::memcpy(content.data() + sizePosition, &size, sizeof(size));
+
+        BOOST_CHECK_THROW(TableReader(content.data(), content.size()), std::runtime_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(random_values_are_converted_back_to_the_text_of_the_survey_results)
+{
+    const char* const formats[] = {"%.0f", "%.1f", "%.2f", "%.3f", "%.4f", "%.5f", "%.6f", "%.10f"};
+    const uint32_t rowCount = 2000;
+
+    std::mt19937_64 generator(42);
+    std::uniform_real_distribution<double> mantissa(-10., 10.);
+    std::uniform_int_distribution<int> exponent(-8, 12);
+    std::vector<std::vector<double>> values(std::size(formats), std::vector<double>(rowCount));
+    for (auto& column: values)
+    {
+        for (double& v: column)
+        {
+            v = mantissa(generator) * std::pow(10., exponent(generator));
+        }
+    }
+
+    std::string labels;
+    for (uint32_t row = 0; row != rowCount; ++row)
+    {
+        labels += "\t" + std::to_string(row + 1) + "\n";
+    }
+
+    TableWriter writer({}, rowCount);
+    writer.setText("values\n", labels);
+    for (std::size_t i = 0; i != std::size(formats); ++i)
+    {
+        writer.addColumn({"V" + std::to_string(i), "MWh", "EXP", formats[i], false},
+                         values[i].data());
+    }
+    const std::string content = writer.finalize();
+
+    // Text written by the survey results, and by printf, for the same values
+    std::string expected = "values\n";
+    std::string withPrintf = "values\n";
+    char conversion[512];
+    for (uint32_t row = 0; row != rowCount; ++row)
+    {
+        const std::string label = "\t" + std::to_string(row + 1);
+        expected += label;
+        withPrintf += label;
+        for (std::size_t i = 0; i != std::size(formats); ++i)
+        {
+            const double v = values[i][row];
+            if (Antares::Utils::isZero(v))
+            {
+                expected += "\t0";
+                withPrintf += "\t0";
+                continue;
+            }
+            const int decimals = Antares::Utils::FixedFormatDecimals(formats[i]);
+            BOOST_REQUIRE(Antares::Utils::AppendFixedValue(expected, v, decimals, formats[i]));
+            const int size = std::snprintf(conversion, sizeof(conversion), formats[i], v);
+            withPrintf.append("\t").append(conversion, size);
+        }
+        expected += '\n';
+        withPrintf += '\n';
+    }
+    BOOST_REQUIRE(expected == withPrintf);
+
+    TableReader reader(content.data(), content.size());
+    std::string text;
+    reader.toText(text);
+    BOOST_CHECK(text == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,190 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#define BOOST_TEST_MODULE load tasks
+#define WIN32_LEAN_AND_MEAN
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/logs/logs.h>
+#include "antares/benchmarking/DurationCollector.h"
+#include "antares/study/load-tasks.h"
+
+using namespace Antares::Data;
+
+namespace
+{
+// Tasks finishing in the reverse order they were given in
+std::vector<LoadingTask> reverseOrderTasks(std::size_t count,
+                                           const std::function<bool(std::size_t)>& result)
+{
+    std::vector<LoadingTask> tasks;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        tasks.emplace_back(
+          [i, count, result]
+          {
+              std::this_thread::sleep_for(std::chrono::milliseconds(5 * (count - i)));
+              return result(i);
+          });
+    }
+    return tasks;
+}
+
+// Messages written by the logger, in the order they are written
+class LogRecorder final: public Yuni::IEventObserver<LogRecorder, Yuni::Policy::SingleThreaded>
+{
+public:
+    LogRecorder()
+    {
+        Antares::logs.callback.connect(this, &LogRecorder::onLogMessage);
+    }
+
+    ~LogRecorder()
+    {
+        destroyBoundEvents();
+    }
+
+    void onLogMessage(int, const std::string& message)
+    {
+        messages.push_back(message);
+    }
+
+    std::vector<std::string> messages;
+};
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(load_tasks)
+
+BOOST_AUTO_TEST_CASE(all_tasks_are_run_once)
+{
+    std::atomic<int> calls = 0;
+    std::vector<LoadingTask> tasks(20, [&calls] { return ++calls > 0; });
+    BOOST_CHECK(RunLoadingTasks(tasks, 4));
+    BOOST_CHECK_EQUAL(calls, 20);
+}
+
+BOOST_AUTO_TEST_CASE(one_failed_task_fails_the_whole_but_others_are_run)
+{
+    std::atomic<int> calls = 0;
+    auto result = [&calls](std::size_t i)
+    {
+        ++calls;
+        return i != 2;
+    };
+    BOOST_CHECK(!RunLoadingTasks(reverseOrderTasks(6, result), 3));
+    BOOST_CHECK_EQUAL(calls, 6);
+}
+
+BOOST_AUTO_TEST_CASE(tasks_are_reported_in_the_order_they_were_given)
+{
+    for (uint nbThreads: {1u, 4u})
+    {
+        std::vector<std::size_t> reported;
+        RunLoadingTasks(reverseOrderTasks(8, [](std::size_t) { return true; }),
+                        nbThreads,
+                        [&reported](std::size_t i) { reported.push_back(i); });
+
+        const std::vector<std::size_t> expected{0, 1, 2, 3, 4, 5, 6, 7};
+        BOOST_CHECK_EQUAL_COLLECTIONS(reported.begin(),
+                                      reported.end(),
+                                      expected.begin(),
+                                      expected.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(messages_of_the_tasks_are_written_in_order_after_their_report)
+{
+    for (uint nbThreads: {1u, 4u})
+    {
+        auto result = [](std::size_t i)
+        {
+            Antares::logs.info() << "task " << i << " begins";
+            Antares::logs.warning() << "task " << i << " ends";
+            return true;
+        };
+
+        LogRecorder recorder;
+        RunLoadingTasks(reverseOrderTasks(4, result),
+                        nbThreads,
+                        [](std::size_t i) { Antares::logs.info() << "task " << i << " done"; });
+
+        std::vector<std::string> expected;
+        for (std::size_t i = 0; i != 4; ++i)
+        {
+            for (const char* step: {" done", " begins", " ends"})
+            {
+                expected.push_back("task " + std::to_string(i) + step);
+            }
+        }
+        BOOST_CHECK_EQUAL_COLLECTIONS(recorder.messages.begin(),
+                                      recorder.messages.end(),
+                                      expected.begin(),
+                                      expected.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(exception_of_the_first_failing_task_is_rethrown)
+{
+    // Task 5 fails first in time, but task 1 comes first
+    for (uint nbThreads: {1u, 4u})
+    {
+        std::atomic<int> calls = 0;
+        auto result = [&calls](std::size_t i) -> bool
+        {
+            ++calls;
+            if (i == 1 || i == 5)
+            {
+                throw std::runtime_error("task " + std::to_string(i));
+            }
+            return true;
+        };
+
+        try
+        {
+            RunLoadingTasks(reverseOrderTasks(8, result), nbThreads);
+            BOOST_FAIL("An exception was expected");
+        }
+        catch (const std::runtime_error& e)
+        {
+            BOOST_CHECK_EQUAL(std::string(e.what()), "task 1");
+        }
+        BOOST_CHECK_EQUAL(calls, 8);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(phase_duration_is_recorded_when_a_collector_is_given)
+{
+    StudyLoadOptions options;
+    BOOST_CHECK(RunLoadingPhase(options, "none", [] { return true; }));
+
+    Benchmarking::DurationCollector collector;
+    options.durationCollector = &collector;
+    BOOST_CHECK(!RunLoadingPhase(options, "areas", [] { return false; }));
+    BOOST_CHECK_EQUAL(collector.getStatistics("study_loading_areas").nbCalls, 1);
+    BOOST_CHECK_THROW(collector.getTime("study_loading_none"), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test value format
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/utils/value-format.h>
+
+using namespace Antares::Utils;
+
+namespace
+{
+std::string withPrintf(double v, const char* format)
+{
+    char buffer[512];
+    int size = std::snprintf(buffer, sizeof(buffer), format, v);
+    return "\t" + std::string(buffer, size);
+}
+
+std::string withFormatter(double v, const char* format)
+{
+    std::string out;
+    BOOST_REQUIRE(AppendFixedValue(out, v, FixedFormatDecimals(format), format));
+    return out;
+}
+
+const char* const formats[] = {"%.0f", "%.1f", "%.2f", "%.3f", "%.4f", "%.5f", "%.6f"};
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(value_format)
+
+BOOST_AUTO_TEST_CASE(decimals_are_read_from_fixed_formats_only)
+{
+    BOOST_CHECK_EQUAL(FixedFormatDecimals("%.0f"), 0);
+    BOOST_CHECK_EQUAL(FixedFormatDecimals("%.6f"), 6);
+    BOOST_CHECK_EQUAL(FixedFormatDecimals("%f"), -1);
+    BOOST_CHECK_EQUAL(FixedFormatDecimals("%.2e"), -1);
+    BOOST_CHECK_EQUAL(FixedFormatDecimals("%.10f"), -1);
+    BOOST_CHECK_EQUAL(FixedFormatDecimals(""), -1);
+}
+
+BOOST_AUTO_TEST_CASE(same_characters_as_printf_for_remarkable_values)
+{
+    const double values[] = {0.5,
+                             1.5,
+                             2.5,
+                             -0.5,
+                             0.125,
+                             0.0625,
+                             1e-7,
+                             -1e-7,
+                             0.1,
+                             0.7,
+                             1234567.891,
+                             -98765.4321,
+                             1e15 + 0.3,
+                             1e22,
+                             std::numeric_limits<double>::max(),
+                             std::numeric_limits<double>::lowest(),
+                             std::numeric_limits<double>::min(),
+                             std::numeric_limits<double>::denorm_min()};
+    for (const char* format: formats)
+    {
+        for (double v: values)
+        {
+            BOOST_CHECK_EQUAL(withFormatter(v, format), withPrintf(v, format));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(same_characters_as_printf_for_random_values)
+{
+    std::mt19937_64 generator(42);
+    std::uniform_real_distribution<double> mantissa(-10., 10.);
+    std::uniform_int_distribution<int> exponent(-8, 12);
+    for (int i = 0; i != 20000; ++i)
+    {
+        double v = mantissa(generator) * std::pow(10., exponent(generator));
+        const char* format = formats[i % 7];
+        BOOST_CHECK_EQUAL(withFormatter(v, format), withPrintf(v, format));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(other_formats_fall_back_to_printf)
+{
+    BOOST_CHECK_EQUAL(withFormatter(1234.5678, "%.3e"), withPrintf(1234.5678, "%.3e"));
+    BOOST_CHECK_EQUAL(withFormatter(-0.25, "%g"), withPrintf(-0.25, "%g"));
+}
+
+BOOST_AUTO_TEST_CASE(values_are_appended_after_a_tab)
+{
+    std::string out = "label";
+    BOOST_CHECK(AppendFixedValue(out, 3.14159, 2, "%.2f"));
+    BOOST_CHECK(AppendFixedValue(out, -2., 0, "%.0f"));
+    BOOST_CHECK_EQUAL(out, "label\t3.14\t-2");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
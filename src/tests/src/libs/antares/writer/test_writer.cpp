@@ -123,6 +123,41 @@ BOOST_AUTO_TEST_CASE(test_zip)
     mz_zip_reader_close(readerHandle);
 }
 
+BOOST_AUTO_TEST_CASE(test_zip_entries_compressed_in_parallel)
+{
+    // Many entries, compressed by 4 threads and appended to the archive one at a time
+    auto working_tmp_dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    auto zipPath = working_tmp_dir / "test.zip";
+    auto context = createContext(zipPath, 4, Antares::Data::zipArchive);
+    const int nbEntries = 64;
+    auto expectedContent = [](int entry)
+    {
+        std::string content;
+        for (int line = 0; line < 100; line++)
+        {
+            content += std::to_string(entry) + "\t" + std::to_string(line) + "\n";
+        }
+        return content;
+    };
+
+    for (int entry = 0; entry < nbEntries; entry++)
+    {
+        std::string content = expectedContent(entry);
+        context.writer->addEntryFromBuffer("entry-" + std::to_string(entry), content);
+    }
+    context.writer->flush();
+    context.writer->finalize(true);
+
+    ZipReaderHandle readerHandle = mz_zip_reader_create();
+    std::string zipPathStr = zipPath.string();
+    BOOST_CHECK(mz_zip_reader_open_file(readerHandle, zipPathStr.c_str()) == MZ_OK);
+    for (int entry = 0; entry < nbEntries; entry++)
+    {
+        checkZipContent(readerHandle, "entry-" + std::to_string(entry), expectedContent(entry));
+    }
+    mz_zip_reader_close(readerHandle);
+}
+
 BOOST_AUTO_TEST_CASE(test_in_memory_concrete)
 {
     // Writer some content to test.zip, possibly from 2 threads
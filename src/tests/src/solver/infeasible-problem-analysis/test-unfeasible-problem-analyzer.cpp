@@ -32,6 +32,7 @@
 #include "antares/solver/infeasible-problem-analysis/report.h"
 #include "antares/solver/infeasible-problem-analysis/unfeasible-pb-analyzer.h"
 #include "antares/solver/infeasible-problem-analysis/variables-bounds-consistency.h"
+#include "antares/solver/utils/lp_names.h"
 
 namespace bdata = boost::unit_test::data;
 
@@ -39,6 +40,7 @@ using namespace operations_research;
 
 using Antares::Optimization::ConstraintSlackAnalysis;
 using Antares::Optimization::InfeasibleProblemReport;
+using Antares::Optimization::LpNames;
 using Antares::Optimization::UnfeasibilityAnalysis;
 using Antares::Optimization::UnfeasiblePbAnalyzer;
 using Antares::Optimization::VariableBounds;
@@ -180,6 +182,29 @@ BOOST_AUTO_TEST_CASE(analysis_should_detect_inconsistent_variable_bounds)
     auto expected = VariableBounds("not-ok-var", 1, -1);
     BOOST_CHECK(variableEquals(incorrectVars[0], expected));
 }
+
+BOOST_AUTO_TEST_CASE(incorrect_variables_are_named_from_their_description)
+{
+    std::unique_ptr<MPSolver> problem(MPSolver::CreateSolver("GLOP"));
+    problem->MakeNumVar(-1, 1, "");
+    problem->MakeNumVar(1, -1, "");
+
+    LpNames variableNames(2);
+    LpNames::Descriptor descriptor;
+    descriptor.type = variableNames.label("HydProd");
+    descriptor.first = variableNames.label("some-area");
+    descriptor.timeStep = 3;
+    descriptor.location = LpNames::Location::Area;
+    variableNames.set(1, descriptor);
+
+    VariablesBoundsConsistency analysis(variableNames);
+    analysis.run(problem.get());
+    auto incorrectVars = analysis.incorrectVars();
+    BOOST_CHECK_EQUAL(incorrectVars.size(), 1);
+
+    auto expected = VariableBounds("HydProd::area<some-area>::hour<3>", 1, -1);
+    BOOST_CHECK(variableEquals(incorrectVars[0], expected));
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(slack_variables_analyzer)
@@ -257,6 +282,73 @@ BOOST_AUTO_TEST_CASE(analysis_slack_variables_are_ordered_and_limited_to_10)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(slack_variables_analyzer_from_descriptions)
+
+/*!
+ * Unnamed problem, whose constraints are described as they are by the constraint builders
+ */
+struct DescribedProblem
+{
+    std::unique_ptr<MPSolver> problem{MPSolver::CreateSolver("GLOP")};
+    LpNames constraintNames;
+
+    void addConstraint(std::string_view type,
+                       LpNames::Location location,
+                       LpNames::TimeStep timeStepType,
+                       uint32_t timeStep,
+                       double ConstLowBnd)
+    {
+        auto* var = problem->MakeNumVar(0., 1., "");
+        auto* constraint = problem->MakeRowConstraint("");
+        constraint->SetCoefficient(var, 1);
+        constraint->SetBounds(ConstLowBnd, problem->infinity());
+
+        LpNames::Descriptor descriptor;
+        descriptor.type = constraintNames.label(type);
+        descriptor.first = constraintNames.label("some-area");
+        descriptor.timeStep = timeStep;
+        descriptor.location = location;
+        descriptor.timeStepType = timeStepType;
+        constraintNames.resize(constraintNames.size() + 1);
+        constraintNames.set(constraintNames.size() - 1, descriptor);
+    }
+};
+
+BOOST_FIXTURE_TEST_CASE(analysis_should_select_constraints_from_their_description, DescribedProblem)
+{
+    // Satisfied, and not watched
+    addConstraint("AreaBalance", LpNames::Location::Area, LpNames::TimeStep::Hour, 12, 0.);
+    // Cannot be satisfied
+    addConstraint("BC-1", LpNames::Location::Granularity, LpNames::TimeStep::Hour, 36, 2.);
+    addConstraint("HydroPower", LpNames::Location::Area, LpNames::TimeStep::Week, 45, 3.);
+    BOOST_CHECK(problem->Solve() == MPSolver::INFEASIBLE);
+
+    ConstraintSlackAnalysis analysis(constraintNames);
+    analysis.run(problem.get());
+    BOOST_CHECK(analysis.hasDetectedInfeasibilityCause());
+    BOOST_CHECK_EQUAL(analysis.largestSlackVariables().size(), 2);
+
+    InfeasibleProblemReport report(analysis.largestSlackConstraints());
+    report.storeSuspiciousConstraints();
+    auto reportLogs = report.getLogs();
+
+    BOOST_CHECK_EQUAL(reportLogs.size(), 3);
+    BOOST_CHECK_EQUAL(reportLogs[1], "Hydro weekly production at area 'some-area'");
+    BOOST_CHECK_EQUAL(reportLogs[2], "Hourly BC 'BC-1' at hour 36");
+}
+
+BOOST_FIXTURE_TEST_CASE(analysis_should_ignore_constraints_of_other_types, DescribedProblem)
+{
+    addConstraint("AreaBalance", LpNames::Location::Area, LpNames::TimeStep::Hour, 12, 2.);
+    BOOST_CHECK(problem->Solve() == MPSolver::INFEASIBLE);
+
+    ConstraintSlackAnalysis analysis(constraintNames);
+    analysis.run(problem.get());
+    BOOST_CHECK(!analysis.hasDetectedInfeasibilityCause());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(slack_variables_report)
 
 BOOST_AUTO_TEST_CASE(constraints_associated_to_all_incoming_slack_vars_are_reported)
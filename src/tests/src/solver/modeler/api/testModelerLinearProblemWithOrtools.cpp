@@ -129,6 +129,61 @@ BOOST_FIXTURE_TEST_CASE(add_already_existing_constaint_to_problem_leads_to_excep
     BOOST_CHECK_EXCEPTION(pb->addConstraint(0, 1, "constraint"), std::exception, expectedMessage);
 }
 
+BOOST_FIXTURE_TEST_CASE(add_variables_in_batch___check_vars_exist_by_index_and_name,
+                        FixtureEmptyProblem)
+{
+    pb->addNumVariable(0, 1, "first");
+    Api::VariableBatch batch{.lb = {1, 2}, .ub = {10, 20}, .integer = {false, true}, .names = {}};
+    BOOST_CHECK_EQUAL(pb->addVariables(batch), 1);
+    BOOST_CHECK_EQUAL(pb->variableCount(), 3);
+
+    BOOST_CHECK_EQUAL(pb->getVariable(0), pb->getVariable("first"));
+    auto* var = pb->getVariable(2);
+    BOOST_CHECK(var->isInteger());
+    BOOST_CHECK_EQUAL(var->getLb(), 2);
+    BOOST_CHECK_EQUAL(var->getUb(), 20);
+}
+
+BOOST_FIXTURE_TEST_CASE(add_constraints_in_batch___check_csr_coefficients, FixtureEmptyProblem)
+{
+    Api::VariableBatch variables{.lb = {0, 0},
+                                 .ub = {1, 1},
+                                 .integer = {false, false},
+                                 .names = {"x", "y"}};
+    pb->addVariables(variables);
+
+    // ct1: 2x + 3y, ct2: -y
+    Api::ConstraintBatch constraints{.lb = {0, -1},
+                                     .ub = {5, 1},
+                                     .rowStart = {0, 2, 3},
+                                     .columns = {0, 1, 1},
+                                     .coefficients = {2, 3, -1},
+                                     .names = {"ct1", "ct2"}};
+    BOOST_CHECK_EQUAL(pb->addConstraints(constraints), 0);
+    BOOST_CHECK_EQUAL(pb->constraintCount(), 2);
+
+    auto* x = pb->getVariable("x");
+    auto* y = pb->getVariable("y");
+    BOOST_CHECK_EQUAL(pb->getConstraint("ct1")->getCoefficient(x), 2);
+    BOOST_CHECK_EQUAL(pb->getConstraint("ct1")->getCoefficient(y), 3);
+    BOOST_CHECK_EQUAL(pb->getConstraint(1)->getCoefficient(x), 0);
+    BOOST_CHECK_EQUAL(pb->getConstraint(1)->getCoefficient(y), -1);
+    BOOST_CHECK_EQUAL(pb->getConstraint(1)->getLb(), -1);
+}
+
+BOOST_FIXTURE_TEST_CASE(add_constraints_with_inconsistent_csr_leads_to_exception,
+                        FixtureEmptyProblem)
+{
+    pb->addNumVariable(0, 1, "x");
+    Api::ConstraintBatch constraints{.lb = {0},
+                                     .ub = {1},
+                                     .rowStart = {0, 2},
+                                     .columns = {0},
+                                     .coefficients = {1},
+                                     .names = {}};
+    BOOST_CHECK_THROW(pb->addConstraints(constraints), std::invalid_argument);
+}
+
 BOOST_FIXTURE_TEST_CASE(minimize_problem___check_minimize_status, FixtureEmptyProblem)
 {
     pb->setMinimization();
@@ -0,0 +1,166 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <unit_test_utils.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/solver/expressions/nodes/ExpressionsNodes.h>
+#include <antares/solver/expressions/visitors/EvalVisitor.h>
+#include <antares/solver/optim-model-filler/CompiledModel.h>
+#include <antares/study/system-model/component.h>
+#include <antares/study/system-model/parameter.h>
+
+using namespace Antares::Optimization;
+using namespace Antares::Solver::Nodes;
+using namespace Antares::Solver::Visitors;
+using namespace Antares::Study::SystemModel;
+
+BOOST_AUTO_TEST_SUITE(_compiled_model_)
+
+BOOST_AUTO_TEST_CASE(parametric_value_of_literals)
+{
+    auto value = (ParametricValue::literal(2) + ParametricValue::literal(3))
+                 * ParametricValue::literal(4);
+    BOOST_CHECK_EQUAL(value.evaluate({}), 20.);
+}
+
+BOOST_AUTO_TEST_CASE(parametric_value_of_parameters)
+{
+    // (p0 - p1) / -2
+    auto value = (ParametricValue::parameter(0) - ParametricValue::parameter(1))
+                 / ParametricValue::literal(2).negate();
+    BOOST_CHECK_EQUAL(value.evaluate({5., 1.}), -2.);
+    BOOST_CHECK_EQUAL(value.evaluate({1., 5.}), 2.);
+}
+
+BOOST_AUTO_TEST_CASE(division_by_zero___exception_is_raised)
+{
+    // 1 / p
+    auto value = ParametricValue::literal(1) / ParametricValue::parameter(0);
+    BOOST_CHECK_EQUAL(value.evaluate({4.}), 0.25);
+    BOOST_CHECK_THROW(value.evaluate({0.}), EvalVisitorDivisionException);
+
+    BOOST_CHECK_THROW(ParametricValue::literal(1) / ParametricValue::literal(0),
+                      EvalVisitorDivisionException);
+}
+
+BOOST_AUTO_TEST_CASE(deep_parametric_value___evaluated_like_a_shallow_one)
+{
+    // p0 + (p0 + (p0 + ...)), deeper than the stack kept on the call stack
+    auto value = ParametricValue::parameter(0);
+    for (int i = 0; i != 100; ++i)
+    {
+        value = ParametricValue::parameter(0) + value.negate();
+    }
+    BOOST_CHECK_EQUAL(value.evaluate({1.}), 1.);
+}
+
+BOOST_AUTO_TEST_CASE(model_compiled_once___evaluated_for_two_components)
+{
+    // x in [0, p], y in [-1, 1], p * x - q * y <= 2 * q
+    Antares::Solver::Registry<Node> nodes;
+    Node* lbX = nodes.create<LiteralNode>(0);
+    Node* ubX = nodes.create<ParameterNode>("p");
+    Node* lbY = nodes.create<LiteralNode>(-1);
+    Node* ubY = nodes.create<LiteralNode>(1);
+    Node* ct = nodes.create<LessThanOrEqualNode>(
+      nodes.create<SubtractionNode>(
+        nodes.create<MultiplicationNode>(nodes.create<ParameterNode>("p"),
+                                         nodes.create<VariableNode>("x")),
+        nodes.create<MultiplicationNode>(nodes.create<ParameterNode>("q"),
+                                         nodes.create<VariableNode>("y"))),
+      nodes.create<MultiplicationNode>(nodes.create<LiteralNode>(2),
+                                       nodes.create<ParameterNode>("q")));
+    auto expression = [&nodes](Node* node)
+    {
+        return Expression("expression", Antares::Solver::NodeRegistry(node, std::move(nodes)));
+    };
+
+    std::vector<Variable> variables;
+    variables.emplace_back("x", expression(lbX), expression(ubX), ValueType::FLOAT);
+    variables.emplace_back("y", expression(lbY), expression(ubY), ValueType::INTEGER);
+    std::vector<Constraint> constraints;
+    constraints.emplace_back("ct", expression(ct));
+    std::vector<Parameter> parameters;
+    parameters.emplace_back("p", Parameter::TimeDependent::NO, Parameter::ScenarioDependent::NO);
+    parameters.emplace_back("q", Parameter::TimeDependent::NO, Parameter::ScenarioDependent::NO);
+    ModelBuilder modelBuilder;
+    auto model = modelBuilder.withId("model")
+                   .withParameters(std::move(parameters))
+                   .withVariables(std::move(variables))
+                   .withConstraints(std::move(constraints))
+                   .build();
+
+    CompiledModel compiled(model);
+    BOOST_REQUIRE_EQUAL(compiled.variables().size(), 2);
+    BOOST_REQUIRE_EQUAL(compiled.constraints().size(), 1);
+    BOOST_CHECK(!compiled.objective());
+    BOOST_CHECK(compiled.variables()[1].integer);
+
+    const auto& constraint = compiled.constraints().front();
+    BOOST_REQUIRE_EQUAL(constraint.expression.coefPerVar.size(), 2);
+
+    ComponentBuilder componentBuilder;
+    for (auto [p, q]: {std::pair{2., 3.}, std::pair{5., 1.}})
+    {
+        auto component = componentBuilder.withId("component")
+                           .withModel(&model)
+                           .withParameterValues({{"p", p}, {"q", q}})
+                           .withScenarioGroupId("group")
+                           .build();
+        auto parameters = compiled.parameterValues(component);
+
+        BOOST_CHECK_EQUAL(compiled.variables()[0].ub.evaluate(parameters), p);
+        BOOST_CHECK_EQUAL(constraint.expression.coefPerVar.at(0).evaluate(parameters), p);
+        BOOST_CHECK_EQUAL(constraint.expression.coefPerVar.at(1).evaluate(parameters), -q);
+        BOOST_CHECK_EQUAL(constraint.ub.evaluate(parameters), 2 * q);
+        BOOST_CHECK_EQUAL(constraint.lb.evaluate(parameters),
+                          -std::numeric_limits<double>::infinity());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(component_without_a_used_parameter___exception_is_raised)
+{
+    Antares::Solver::Registry<Node> nodes;
+    Node* lb = nodes.create<LiteralNode>(0);
+    Node* ub = nodes.create<ParameterNode>("p");
+    auto expression = [&nodes](Node* node)
+    {
+        return Expression("expression", Antares::Solver::NodeRegistry(node, std::move(nodes)));
+    };
+    std::vector<Variable> variables;
+    variables.emplace_back("x", expression(lb), expression(ub), ValueType::FLOAT);
+    ModelBuilder modelBuilder;
+    auto model = modelBuilder.withId("model").withVariables(std::move(variables)).build();
+
+    CompiledModel compiled(model);
+    ComponentBuilder componentBuilder;
+    auto component = componentBuilder.withId("component")
+                       .withModel(&model)
+                       .withScenarioGroupId("group")
+                       .build();
+    BOOST_CHECK_THROW(compiled.parameterValues(component), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,297 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test hourly curtailment sharing problem
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <yuni/job/queue/service.h>
+
+#include <antares/solver/simulation/adequacy_patch_runtime_data.h>
+#include <antares/study/study.h>
+#include "antares/solver/optimisation/adequacy_patch_csr/hourly_csr_problem.h"
+#include "antares/solver/simulation/sim_structure_probleme_economique.h"
+
+using namespace Antares::Data;
+using namespace Antares::Data::AdequacyPatch;
+
+namespace
+{
+constexpr unsigned int nbHoursInWeek = 168;
+constexpr unsigned int year = 0;
+
+// Hours triggering the curtailment sharing, for two consecutive weeks
+const std::map<unsigned int, std::set<int>> triggeredHours = {{0, {2, 3, 7, 100}},
+                                                              {1, {0, 3, 101, 167}}};
+
+AdqPatchParams createParams()
+{
+    AdqPatchParams p;
+    p.enabled = true;
+    p.setToZeroOutsideInsideLinks = false;
+    p.curtailmentSharing.priceTakingOrder = AdqPatchPTO::isDens;
+    p.curtailmentSharing.thresholdRun = 0.;
+    p.curtailmentSharing.thresholdDisplayViolations = 0.;
+    p.curtailmentSharing.thresholdVarBoundsRelaxation = 3;
+    p.curtailmentSharing.includeHurdleCost = true;
+    p.curtailmentSharing.checkCsrCostFunction = false;
+    return p;
+}
+
+// Areas a and b are inside the adequacy patch, area c is outside.
+// Link 0 : a -> b, link 1 : a -> c.
+class ThreeAreasWeeklyProblem
+{
+public:
+    ThreeAreasWeeklyProblem()
+    {
+        auto* a = study.areaAdd("a");
+        auto* b = study.areaAdd("b");
+        auto* c = study.areaAdd("c");
+        const std::vector<AreaLink*> links = {AreaAddLinkBetweenAreas(a, b),
+                                              AreaAddLinkBetweenAreas(a, c)};
+
+        problem.adequacyPatchRuntimeData = std::make_shared<AdequacyPatchRuntimeData>(study.areas,
+                                                                                      links);
+        auto& runtimeData = *problem.adequacyPatchRuntimeData;
+        runtimeData.areaMode = {physicalAreaInsideAdqPatch,
+                                physicalAreaInsideAdqPatch,
+                                physicalAreaOutsideAdqPatch};
+        runtimeData.originAreaMode = {physicalAreaInsideAdqPatch, physicalAreaInsideAdqPatch};
+        runtimeData.extremityAreaMode = {physicalAreaInsideAdqPatch, physicalAreaOutsideAdqPatch};
+        runtimeData.hurdleCostCoefficients = {1. / 3000., 1. / 3000.};
+
+        const unsigned int nbAreas = 3;
+        const unsigned int nbLinks = 2;
+        problem.NombreDePays = nbAreas;
+        problem.NombreDInterconnexions = nbLinks;
+        problem.NombreDeContraintesCouplantes = 0;
+        problem.NombreDePasDeTemps = nbHoursInWeek;
+        problem.NombreDePasDeTempsPourUneOptimisation = nbHoursInWeek;
+        problem.NomsDesPays = {"a", "b", "c"};
+
+        problem.PaysOrigineDeLInterconnexion = {0, 0};
+        problem.PaysExtremiteDeLInterconnexion = {1, 2};
+        problem.IndexDebutIntercoOrigine = {0, -1, -1};
+        problem.IndexSuivantIntercoOrigine = {1, -1};
+        problem.IndexDebutIntercoExtremite = {-1, 0, 1};
+        problem.IndexSuivantIntercoExtremite = {-1, -1};
+
+        problem.CorrespondanceVarNativesVarOptim.resize(nbHoursInWeek);
+        for (auto& correspondance: problem.CorrespondanceVarNativesVarOptim)
+        {
+            correspondance.NumeroDeVariableDefaillancePositive.assign(nbAreas, -1);
+            correspondance.NumeroDeVariableDefaillanceNegative.assign(nbAreas, -1);
+            correspondance.NumeroDeVariableDeLInterconnexion.assign(nbLinks, -1);
+            correspondance.NumeroDeVariableCoutOrigineVersExtremiteDeLInterconnexion
+              .assign(nbLinks, -1);
+            correspondance.NumeroDeVariableCoutExtremiteVersOrigineDeLInterconnexion
+              .assign(nbLinks, -1);
+        }
+
+        problem.ResultatsHoraires.resize(nbAreas);
+        for (auto& results: problem.ResultatsHoraires)
+        {
+            results.ValeursHorairesDeDefaillancePositive.assign(nbHoursInWeek, 0.);
+            results.ValeursHorairesDeDefaillanceNegative.assign(nbHoursInWeek, 0.);
+            results.ValeursHorairesDENS.assign(nbHoursInWeek, 0.);
+            results.ValeursHorairesLmrViolations.assign(nbHoursInWeek, 0);
+        }
+
+        problem.ValeursDeNTC.resize(nbHoursInWeek);
+        for (auto& ntc: problem.ValeursDeNTC)
+        {
+            ntc.ValeurDeNTCOrigineVersExtremite.assign(nbLinks, 0.);
+            ntc.ValeurDeNTCExtremiteVersOrigine.assign(nbLinks, 0.);
+            ntc.ValeurDuFlux.assign(nbLinks, 0.);
+        }
+
+        problem.CoutDeTransport.resize(nbLinks);
+        for (auto& cost: problem.CoutDeTransport)
+        {
+            cost.IntercoGereeAvecDesCouts = true;
+            cost.CoutDeTransportOrigineVersExtremite.assign(nbHoursInWeek, 0.);
+            cost.CoutDeTransportExtremiteVersOrigine.assign(nbHoursInWeek, 0.);
+        }
+    }
+
+    // Results of the first optimization of a week : area a has unsupplied energy while exporting
+    // to area b, with values depending on the hour of the year
+    void fillWeek(unsigned int week)
+    {
+        for (unsigned int hour = 0; hour < nbHoursInWeek; ++hour)
+        {
+            const unsigned int step = (week * nbHoursInWeek + hour) % 7;
+
+            auto& a = problem.ResultatsHoraires[0];
+            a.ValeursHorairesDeDefaillancePositive[hour] = 100. + 10. * step;
+            a.ValeursHorairesDENS[hour] = 150. + 10. * step;
+            a.ValeursHorairesDeDefaillanceNegative[hour] = 0.;
+
+            auto& b = problem.ResultatsHoraires[1];
+            b.ValeursHorairesDeDefaillancePositive[hour] = 20. * (step % 3);
+            b.ValeursHorairesDENS[hour] = 20. * (step % 3) + 5.;
+            b.ValeursHorairesDeDefaillanceNegative[hour] = 0.;
+
+            auto& ntc = problem.ValeursDeNTC[hour];
+            ntc.ValeurDeNTCOrigineVersExtremite = {200. + step, 100.};
+            ntc.ValeurDeNTCExtremiteVersOrigine = {180., 100.};
+            ntc.ValeurDuFlux = {50. + 5. * step, -20.};
+
+            for (auto& cost: problem.CoutDeTransport)
+            {
+                cost.CoutDeTransportOrigineVersExtremite[hour] = 1. + step;
+                cost.CoutDeTransportExtremiteVersOrigine[hour] = 2. + step;
+            }
+        }
+    }
+
+    struct HourResults
+    {
+        std::vector<double> unsuppliedEnergy;
+        std::vector<double> spilledEnergy;
+        std::vector<double> flows;
+    };
+
+    HourResults resultsOfHour(int hour) const
+    {
+        HourResults results;
+        for (const auto& area: problem.ResultatsHoraires)
+        {
+            results.unsuppliedEnergy.push_back(area.ValeursHorairesDeDefaillancePositive[hour]);
+            results.spilledEnergy.push_back(area.ValeursHorairesDeDefaillanceNegative[hour]);
+        }
+        results.flows = problem.ValeursDeNTC[hour].ValeurDuFlux;
+        return results;
+    }
+
+    Study study;
+    PROBLEME_HEBDO problem;
+};
+
+using HourResults = ThreeAreasWeeklyProblem::HourResults;
+
+// Reference : a new weekly problem and a new curtailment sharing problem for each hour
+std::map<unsigned int, std::map<int, HourResults>> solveEachHourSeparately(
+  const AdqPatchParams& params)
+{
+    std::map<unsigned int, std::map<int, HourResults>> results;
+    for (const auto& [week, hours]: triggeredHours)
+    {
+        for (int hour: hours)
+        {
+            ThreeAreasWeeklyProblem weekly;
+            weekly.fillWeek(week);
+            HourlyCSRProblem csrProblem(params, &weekly.problem);
+            csrProblem.run({hour}, week, year);
+            results[week][hour] = weekly.resultsOfHour(hour);
+        }
+    }
+    return results;
+}
+
+// One weekly problem and one curtailment sharing problem for all the hours of all the weeks
+std::map<unsigned int, std::map<int, HourResults>> solveAllHoursWithOneProblem(
+  const AdqPatchParams& params,
+  std::shared_ptr<Yuni::Job::QueueService> threadPool)
+{
+    ThreeAreasWeeklyProblem weekly;
+    weekly.problem.threadPool = threadPool;
+    weekly.problem.parallelCsrHours = threadPool != nullptr;
+    HourlyCSRProblem csrProblem(params, &weekly.problem);
+
+    std::map<unsigned int, std::map<int, HourResults>> results;
+    for (const auto& [week, hours]: triggeredHours)
+    {
+        weekly.fillWeek(week);
+        csrProblem.run(hours, week, year);
+        for (int hour: hours)
+        {
+            results[week][hour] = weekly.resultsOfHour(hour);
+        }
+    }
+    return results;
+}
+
+// The interior point method stops within a tolerance : a problem reused, or solved on another
+// thread, may end on slightly different values
+void checkCloseValues(const std::vector<double>& values, const std::vector<double>& expected)
+{
+    BOOST_REQUIRE_EQUAL(values.size(), expected.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        BOOST_TEST_CONTEXT("index " << i)
+        {
+            BOOST_CHECK_LE(std::abs(values[i] - expected[i]),
+                           1e-6 * std::max(1., std::abs(expected[i])));
+        }
+    }
+}
+
+void checkSameResults(const std::map<unsigned int, std::map<int, HourResults>>& results,
+                      const std::map<unsigned int, std::map<int, HourResults>>& expected)
+{
+    for (const auto& [week, hours]: triggeredHours)
+    {
+        for (int hour: hours)
+        {
+            BOOST_TEST_CONTEXT("week " << week << ", hour " << hour)
+            {
+                const auto& result = results.at(week).at(hour);
+                const auto& reference = expected.at(week).at(hour);
+                checkCloseValues(result.unsuppliedEnergy, reference.unsuppliedEnergy);
+                checkCloseValues(result.spilledEnergy, reference.spilledEnergy);
+                checkCloseValues(result.flows, reference.flows);
+            }
+        }
+    }
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(hours_of_consecutive_weeks___same_results_as_one_problem_per_hour)
+{
+    const auto params = createParams();
+    const auto expected = solveEachHourSeparately(params);
+    const auto results = solveAllHoursWithOneProblem(params, nullptr);
+    checkSameResults(results, expected);
+}
+
+BOOST_AUTO_TEST_CASE(hours_solved_in_parallel___same_results_as_one_problem_per_hour)
+{
+    const auto params = createParams();
+    const auto expected = solveEachHourSeparately(params);
+
+    auto threadPool = std::make_shared<Yuni::Job::QueueService>();
+    threadPool->maximumThreadCount(4);
+    threadPool->start();
+    const auto results = solveAllHoursWithOneProblem(params, threadPool);
+    threadPool->stop();
+
+    checkSameResults(results, expected);
+}
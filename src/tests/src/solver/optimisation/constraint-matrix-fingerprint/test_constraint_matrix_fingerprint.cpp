@@ -0,0 +1,96 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#define BOOST_TEST_MODULE test_constraint_matrix_fingerprint
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/optimisation/ConstraintMatrixFingerprint.h"
+#include "antares/solver/optimisation/opt_structure_probleme_a_resoudre.h"
+#include "antares/solver/simulation/sim_structure_probleme_economique.h"
+
+struct WeeklyProblemFixture
+{
+    WeeklyProblemFixture()
+    {
+        problem.ProblemeAResoudre = std::make_unique<PROBLEME_ANTARES_A_RESOUDRE>();
+        problem.ProblemeAResoudre->NombreDeVariables = 42;
+        problem.NombreDePasDeTemps = 168;
+        problem.NombreDePasDeTempsPourUneOptimisation = 168;
+
+        problem.NombreDePays = 1;
+        problem.PaliersThermiquesDuPays.resize(1);
+        problem.CaracteristiquesHydrauliques.resize(1);
+        problem.CaracteristiquesHydrauliques[0].PumpingRatio = 0.75;
+        problem.ShortTermStorage.resize(1);
+        problem.DefaillanceNegativeUtiliserHydro.assign(1, false);
+
+        problem.NombreDeContraintesCouplantes = 1;
+        problem.MatriceDesContraintesCouplantes.resize(1);
+        auto& constraint = problem.MatriceDesContraintesCouplantes[0];
+        constraint.TypeDeContrainteCouplante = CONTRAINTE_HORAIRE;
+        constraint.SensDeLaContrainteCouplante = '<';
+        constraint.NombreDInterconnexionsDansLaContrainteCouplante = 1;
+        constraint.PoidsDeLInterconnexion = {1.};
+        constraint.NumeroDeLInterconnexion = {0};
+        constraint.OffsetTemporelSurLInterco = {0};
+        constraint.NombreDePaliersDispatchDansLaContrainteCouplante = 0;
+    }
+
+    PROBLEME_HEBDO problem;
+};
+
+BOOST_FIXTURE_TEST_SUITE(constraint_matrix_fingerprint, WeeklyProblemFixture)
+
+BOOST_AUTO_TEST_CASE(fingerprint_does_not_depend_on_the_week)
+{
+    problem.weekInTheYear = 0;
+    problem.year = 0;
+    const auto first = ConstraintMatrixFingerprint(problem);
+
+    problem.weekInTheYear = 12;
+    problem.year = 3;
+    BOOST_CHECK_EQUAL(first, ConstraintMatrixFingerprint(problem));
+}
+
+BOOST_AUTO_TEST_CASE(fingerprint_changes_with_binding_constraint_weights)
+{
+    const auto before = ConstraintMatrixFingerprint(problem);
+    problem.MatriceDesContraintesCouplantes[0].PoidsDeLInterconnexion[0] = 2.;
+    BOOST_CHECK_NE(before, ConstraintMatrixFingerprint(problem));
+}
+
+BOOST_AUTO_TEST_CASE(fingerprint_changes_with_pumping_ratio)
+{
+    const auto before = ConstraintMatrixFingerprint(problem);
+    problem.CaracteristiquesHydrauliques[0].PumpingRatio = 0.8;
+    BOOST_CHECK_NE(before, ConstraintMatrixFingerprint(problem));
+}
+
+BOOST_AUTO_TEST_CASE(fingerprint_changes_with_number_of_variables)
+{
+    const auto before = ConstraintMatrixFingerprint(problem);
+    problem.ProblemeAResoudre->NombreDeVariables++;
+    BOOST_CHECK_NE(before, ConstraintMatrixFingerprint(problem));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
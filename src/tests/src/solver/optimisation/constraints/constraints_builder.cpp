@@ -83,7 +83,7 @@ struct BB
     std::vector<std::vector<int>> NumeroDeVariableDeTrancheDeStock = std::vector<std::vector<int>>(
       10,
       std::vector<int>(5, -1));
-    std::vector<std::string> NomDesContraintes = std::vector<std::string>(100, "");
+    Antares::Optimization::LpNames NomDesContraintes = Antares::Optimization::LpNames(100);
     const bool NamedProblems = true;
     const std::vector<const char*> NomsDesPays = {"CountryA", "CountryB", "CountryC"};
     const uint32_t weekInTheYear = 1;        // Example week
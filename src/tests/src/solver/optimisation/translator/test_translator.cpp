@@ -40,6 +40,16 @@ public:
     }
 };
 
+Antares::Optimization::LpNames verbatimNames(const std::vector<std::string>& names)
+{
+    Antares::Optimization::LpNames result(names.size());
+    for (size_t index = 0; index < names.size(); index++)
+    {
+        result.setVerbatim(index, names[index]);
+    }
+    return result;
+}
+
 BOOST_AUTO_TEST_CASE(null_hebdo_is_empty_lps)
 {
     HebdoProblemToLpsTranslator translator;
@@ -63,8 +73,10 @@ BOOST_AUTO_TEST_CASE(Data_properly_copied)
     problemHebdo.CoutLineaire = {0, 1, 2};
     problemHebdo.Xmax = {10, 11, 12};
     problemHebdo.Xmin = {20, 21, 22};
-    problemHebdo.NomDesVariables = {"a", "b", "c"};
-    problemHebdo.NomDesContraintes = {"d", "e", "f"};
+    const std::vector<std::string> variables = {"a", "b", "c"};
+    const std::vector<std::string> constraints = {"d", "e", "f"};
+    problemHebdo.NomDesVariables = verbatimNames(variables);
+    problemHebdo.NomDesContraintes = verbatimNames(constraints);
     problemHebdo.SecondMembre = {30, 31, 32};
 
     auto ret = translator.translate(&problemHebdo, std::string());
@@ -73,8 +85,8 @@ BOOST_AUTO_TEST_CASE(Data_properly_copied)
     BOOST_CHECK(ret.Xmin == problemHebdo.Xmin);
     BOOST_CHECK(ret.RHS == problemHebdo.SecondMembre);
 
-    BOOST_CHECK(ret.variables == problemHebdo.NomDesVariables);
-    BOOST_CHECK(ret.constraints == problemHebdo.NomDesContraintes);
+    BOOST_CHECK(ret.variables == variables);
+    BOOST_CHECK(ret.constraints == constraints);
 }
 
 BOOST_AUTO_TEST_CASE(translate_sens)
@@ -105,6 +117,28 @@ BOOST_AUTO_TEST_CASE(translate_name_is_properly_filled)
     BOOST_CHECK_EQUAL(ret.name, "problem-Plop--optim-nb-1.mps");
 }
 
+BOOST_AUTO_TEST_CASE(null_hebdo_is_empty_solution)
+{
+    HebdoProblemToLpsTranslator translator;
+    auto ret = translator.translateSolution(nullptr, std::string());
+    BOOST_CHECK(ret == WeeklySolutionFromAntares());
+}
+
+BOOST_AUTO_TEST_CASE(solution_properly_copied)
+{
+    HebdoProblemToLpsTranslator translator;
+    PROBLEME_ANTARES_A_RESOUDRE problemHebdo;
+    problemHebdo.X = {1, 2, 3};
+    problemHebdo.CoutsReduits = {4, 5, 6};
+    problemHebdo.CoutsMarginauxDesContraintes = {7, 8};
+
+    auto ret = translator.translateSolution(&problemHebdo, "problem-Plop--optim-nb-1.mps");
+    BOOST_CHECK(ret.X == problemHebdo.X);
+    BOOST_CHECK(ret.ReducedCosts == problemHebdo.CoutsReduits);
+    BOOST_CHECK(ret.MarginalCosts == problemHebdo.CoutsMarginauxDesContraintes);
+    BOOST_CHECK_EQUAL(ret.name, "problem-Plop--optim-nb-1.mps");
+}
+
 BOOST_AUTO_TEST_CASE(empty_problem_empty_const_data)
 {
     HebdoProblemToLpsTranslator translator;
@@ -0,0 +1,352 @@
+#define BOOST_TEST_MODULE hydro remix randomized
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/simulation/shave-peaks-by-remix-hydro.h"
+
+using namespace Antares::Solver::Simulation;
+
+// Former implementation of shavePeaksByRemixingHydro, without the input checks : for each
+// exchange of hydro generation, bottom and peak hours are found by scanning the whole week.
+// Used as a reference, both for the results and for the computation times.
+namespace Reference
+{
+int find_min_index(const std::vector<double>& TotalGen,
+                   const std::vector<double>& OutUnsupE,
+                   const std::vector<double>& OutHydroGen,
+                   const std::vector<bool>& triedBottom,
+                   const std::vector<double>& HydroPmax,
+                   const std::vector<bool>& enabledHours,
+                   double top)
+{
+    double min_val = top;
+    int min_hour = -1;
+    for (unsigned int h = 0; h < TotalGen.size(); ++h)
+    {
+        if (OutUnsupE[h] > 0 && OutHydroGen[h] < HydroPmax[h] && !triedBottom[h] && enabledHours[h])
+        {
+            if (TotalGen[h] < min_val)
+            {
+                min_val = TotalGen[h];
+                min_hour = h;
+            }
+        }
+    }
+    return min_hour;
+}
+
+int find_max_index(const std::vector<double>& TotalGen,
+                   const std::vector<double>& OutHydroGen,
+                   const std::vector<bool>& triedPeak,
+                   const std::vector<double>& HydroPmin,
+                   const std::vector<bool>& enabledHours,
+                   double ref_value,
+                   double eps)
+{
+    double max_val = 0;
+    int max_hour = -1;
+    for (unsigned int h = 0; h < TotalGen.size(); ++h)
+    {
+        if (OutHydroGen[h] > HydroPmin[h] && TotalGen[h] >= ref_value + eps && !triedPeak[h]
+            && enabledHours[h])
+        {
+            if (TotalGen[h] > max_val)
+            {
+                max_val = TotalGen[h];
+                max_hour = h;
+            }
+        }
+    }
+    return max_hour;
+}
+
+RemixHydroOutput shavePeaksByRemixingHydro(const std::vector<double>& DispatchGen,
+                                           const std::vector<double>& HydroGen,
+                                           const std::vector<double>& UnsupE,
+                                           const std::vector<double>& HydroPmax,
+                                           const std::vector<double>& HydroPmin,
+                                           double initial_level,
+                                           double capa,
+                                           const std::vector<double>& inflows,
+                                           const std::vector<double>& overflow,
+                                           const std::vector<double>& pump,
+                                           const std::vector<double>& Spillage,
+                                           const std::vector<double>& DTG_MRG)
+{
+    std::vector<double> levels(DispatchGen.size());
+    levels[0] = initial_level + inflows[0] - overflow[0] + pump[0] - HydroGen[0];
+    for (size_t h = 1; h < levels.size(); ++h)
+    {
+        levels[h] = levels[h - 1] + inflows[h] - overflow[h] + pump[h] - HydroGen[h];
+    }
+
+    std::vector<double> OutHydroGen = HydroGen;
+    std::vector<double> OutUnsupE = UnsupE;
+
+    int loop = 1000;
+    double eps = 1e-3;
+    double top = *std::max_element(DispatchGen.begin(), DispatchGen.end())
+                 + *std::max_element(HydroGen.begin(), HydroGen.end())
+                 + *std::max_element(UnsupE.begin(), UnsupE.end()) + 1;
+
+    std::vector<bool> enabledHours(DispatchGen.size(), false);
+    for (unsigned int h = 0; h < enabledHours.size(); h++)
+    {
+        if (Spillage[h] + DTG_MRG[h] == 0. && HydroGen[h] + UnsupE[h] > 0.)
+        {
+            enabledHours[h] = true;
+        }
+    }
+
+    std::vector<double> TotalGen(DispatchGen.size());
+    std::transform(DispatchGen.begin(),
+                   DispatchGen.end(),
+                   HydroGen.begin(),
+                   TotalGen.begin(),
+                   std::plus<>());
+
+    while (loop-- > 0)
+    {
+        std::vector<bool> triedBottom(DispatchGen.size(), false);
+        double delta = 0;
+
+        while (true)
+        {
+            int hourBottom = find_min_index(TotalGen,
+                                            OutUnsupE,
+                                            OutHydroGen,
+                                            triedBottom,
+                                            HydroPmax,
+                                            enabledHours,
+                                            top);
+            if (hourBottom == -1)
+            {
+                break;
+            }
+
+            std::vector<bool> triedPeak(DispatchGen.size(), false);
+            while (true)
+            {
+                int hourPeak = find_max_index(TotalGen,
+                                              OutHydroGen,
+                                              triedPeak,
+                                              HydroPmin,
+                                              enabledHours,
+                                              TotalGen[hourBottom],
+                                              eps);
+                if (hourPeak == -1)
+                {
+                    break;
+                }
+
+                std::vector<double> intermediate_level(levels.begin()
+                                                         + std::min(hourBottom, hourPeak),
+                                                       levels.begin()
+                                                         + std::max(hourBottom, hourPeak));
+                double max_pic, max_creux;
+                if (hourBottom < hourPeak)
+                {
+                    max_pic = capa;
+                    max_creux = *std::min_element(intermediate_level.begin(),
+                                                  intermediate_level.end());
+                }
+                else
+                {
+                    max_pic = capa
+                              - *std::max_element(intermediate_level.begin(),
+                                                  intermediate_level.end());
+                    max_creux = capa;
+                }
+
+                max_pic = std::min(OutHydroGen[hourPeak] - HydroPmin[hourPeak], max_pic);
+                max_creux = std::min({HydroPmax[hourBottom] - OutHydroGen[hourBottom],
+                                      OutUnsupE[hourBottom],
+                                      max_creux});
+
+                double dif_pic_creux = std::max(TotalGen[hourPeak] - TotalGen[hourBottom], 0.);
+
+                delta = std::max(std::min({max_pic, max_creux, dif_pic_creux / 2.}), 0.);
+
+                if (delta > 0)
+                {
+                    OutHydroGen[hourPeak] -= delta;
+                    OutHydroGen[hourBottom] += delta;
+                    OutUnsupE[hourPeak] = HydroGen[hourPeak] + UnsupE[hourPeak]
+                                          - OutHydroGen[hourPeak];
+                    OutUnsupE[hourBottom] = HydroGen[hourBottom] + UnsupE[hourBottom]
+                                            - OutHydroGen[hourBottom];
+                    break;
+                }
+                else
+                {
+                    triedPeak[hourPeak] = true;
+                }
+            }
+
+            if (delta > 0)
+            {
+                break;
+            }
+            triedBottom[hourBottom] = true;
+        }
+
+        if (delta == 0)
+        {
+            break;
+        }
+
+        std::transform(DispatchGen.begin(),
+                       DispatchGen.end(),
+                       OutHydroGen.begin(),
+                       TotalGen.begin(),
+                       std::plus<>());
+        levels[0] = initial_level + inflows[0] - overflow[0] + pump[0] - OutHydroGen[0];
+        for (size_t h = 1; h < levels.size(); ++h)
+        {
+            levels[h] = levels[h - 1] + inflows[h] - overflow[h] + pump[h] - OutHydroGen[h];
+        }
+    }
+    return {OutHydroGen, OutUnsupE, levels};
+}
+} // namespace Reference
+
+struct RandomWeek
+{
+    explicit RandomWeek(std::mt19937& gen)
+    {
+        const unsigned int size = 168;
+        std::uniform_int_distribution<int> load(0, 1000);
+        std::uniform_int_distribution<int> power(0, 300);
+        std::uniform_int_distribution<int> percent(0, 99);
+
+        DispatchGen.resize(size);
+        HydroGen.resize(size);
+        UnsupE.resize(size);
+        HydroPmax.resize(size);
+        HydroPmin.resize(size);
+        inflows.resize(size);
+        ovf.assign(size, 0.);
+        pump.assign(size, 0.);
+        Spillage.assign(size, 0.);
+        DTG_MRG.assign(size, 0.);
+
+        // Integer values, so that the levels computed by the remix are exactly the ones below.
+        // Small reservoirs often prevent hydro generation from being moved between two hours.
+        const int capacities[] = {200, 2000, 20000};
+        capacity = capacities[std::uniform_int_distribution<int>(0, 2)(gen)];
+        init_level = std::uniform_int_distribution<int>(0, static_cast<int>(capacity))(gen);
+        double level = init_level;
+        for (unsigned int h = 0; h < size; h++)
+        {
+            DispatchGen[h] = load(gen);
+            HydroPmax[h] = power(gen);
+            HydroPmin[h] = percent(gen) < 80 ? 0. : HydroPmax[h] / 4;
+            inflows[h] = power(gen) / 2;
+            level += inflows[h];
+
+            HydroGen[h] = std::min(HydroPmin[h] + power(gen), HydroPmax[h]);
+            HydroGen[h] = std::max(std::min(HydroGen[h], level), HydroPmin[h]);
+            if (HydroGen[h] > level)
+            {
+                inflows[h] += HydroGen[h] - level;
+                level = HydroGen[h];
+            }
+            level -= HydroGen[h];
+            if (level > capacity)
+            {
+                ovf[h] = level - capacity;
+                level = capacity;
+            }
+
+            UnsupE[h] = percent(gen) < 40 ? load(gen) / 2 : 0.;
+            if (percent(gen) < 5)
+            {
+                Spillage[h] = power(gen);
+            }
+            if (percent(gen) < 5)
+            {
+                DTG_MRG[h] = power(gen);
+            }
+        }
+    }
+
+    template<class Remix>
+    RemixHydroOutput remix(Remix&& shavePeaks) const
+    {
+        return shavePeaks(DispatchGen,
+                          HydroGen,
+                          UnsupE,
+                          HydroPmax,
+                          HydroPmin,
+                          init_level,
+                          capacity,
+                          inflows,
+                          ovf,
+                          pump,
+                          Spillage,
+                          DTG_MRG);
+    }
+
+    std::vector<double> DispatchGen, HydroGen, UnsupE, HydroPmax, HydroPmin, inflows, ovf, pump,
+      Spillage, DTG_MRG;
+    double init_level = 0.;
+    double capacity = 0.;
+};
+
+static std::vector<RandomWeek> randomWeeks(unsigned int nbWeeks)
+{
+    std::mt19937 gen(42);
+    std::vector<RandomWeek> weeks;
+    for (unsigned int w = 0; w < nbWeeks; w++)
+    {
+        weeks.emplace_back(gen);
+    }
+    return weeks;
+}
+
+BOOST_AUTO_TEST_CASE(random_weeks__results_are_the_ones_of_the_reference_implementation)
+{
+    for (const auto& week: randomWeeks(200))
+    {
+        auto expected = week.remix(Reference::shavePeaksByRemixingHydro);
+        auto result = week.remix(shavePeaksByRemixingHydro);
+
+        BOOST_CHECK(result.HydroGen == expected.HydroGen);
+        BOOST_CHECK(result.UnsupE == expected.UnsupE);
+        BOOST_CHECK(result.levels == expected.levels);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(random_weeks__compare_computation_times_with_the_reference_implementation)
+{
+    const auto weeks = randomWeeks(200);
+
+    auto measure = [&weeks](auto&& shavePeaks)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        double checksum = 0.;
+        for (const auto& week: weeks)
+        {
+            checksum += week.remix(shavePeaks).levels.back();
+        }
+        const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now()
+                                                                    - start;
+        return std::make_pair(duration.count(), checksum);
+    };
+
+    const auto [referenceDuration, referenceChecksum] = measure(
+      Reference::shavePeaksByRemixingHydro);
+    const auto [duration, checksum] = measure(shavePeaksByRemixingHydro);
+
+    BOOST_TEST_MESSAGE("Remix of " << weeks.size() << " random weeks : " << duration
+                                   << " ms, reference implementation : " << referenceDuration
+                                   << " ms");
+    BOOST_CHECK_EQUAL(checksum, referenceChecksum);
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE monthly hydro problem pool
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/hydro/management/MonthlyProblemPool.h"
+#include "antares/solver/hydro/monthly/h2o_m_fonctions.h"
+
+using namespace Antares;
+
+namespace
+{
+void fillProblem(DONNEES_ANNUELLES& problem, double inflows)
+{
+    problem.CoutDepassementVolume = 1e2;
+    problem.CoutViolMaxDuVolumeMin = 1e5;
+    problem.VolumeInitial = 0.5;
+    for (int month = 0; month < problem.NombreDePasDeTemps; ++month)
+    {
+        problem.TurbineMax[month] = 12. * inflows;
+        problem.TurbineMin[month] = 0.;
+        problem.TurbineCible[month] = inflows * (1. + month % 3);
+        problem.Apport[month] = inflows;
+        problem.VolumeMin[month] = 0.1;
+        problem.VolumeMax[month] = 0.9;
+    }
+}
+
+std::vector<double> solve(MonthlyProblemPool& pool, double inflows)
+{
+    auto problem = pool.acquire();
+    fillProblem(*problem, inflows);
+    H2O_M_OptimiserUneAnnee(*problem, 0);
+    BOOST_REQUIRE(problem->ResultatsValides == OUI);
+    return problem->Turbine;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(a_released_problem_is_reused)
+{
+    MonthlyProblemPool pool;
+    const DONNEES_ANNUELLES* address = nullptr;
+    {
+        auto problem = pool.acquire();
+        address = problem.get();
+    }
+
+    auto reused = pool.acquire();
+    BOOST_CHECK(reused.get() == address);
+}
+
+BOOST_AUTO_TEST_CASE(a_problem_is_given_back_when_its_optimization_throws)
+{
+    MonthlyProblemPool pool;
+    const DONNEES_ANNUELLES* address = nullptr;
+    try
+    {
+        auto problem = pool.acquire();
+        address = problem.get();
+        throw std::runtime_error("optimization failed");
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+
+    auto reused = pool.acquire();
+    BOOST_CHECK(reused.get() == address);
+}
+
+BOOST_AUTO_TEST_CASE(problems_in_use_are_distinct)
+{
+    MonthlyProblemPool pool;
+    auto first = pool.acquire();
+    auto second = pool.acquire();
+    BOOST_CHECK(first.get() != second.get());
+}
+
+BOOST_AUTO_TEST_CASE(the_simplex_problem_is_released_with_the_problem)
+{
+    MonthlyProblemPool pool;
+    solve(pool, 0.1);
+
+    auto problem = pool.acquire();
+    for (auto* spx: problem->ProblemeHydraulique.ProblemeSpx)
+    {
+        BOOST_CHECK(spx == nullptr);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(a_reused_problem_gives_the_results_of_a_new_one)
+{
+    MonthlyProblemPool pool;
+    const auto expected = solve(pool, 0.1);
+
+    // Another area is optimized with the same problem in between
+    solve(pool, 0.05);
+
+    const auto turbine = solve(pool, 0.1);
+    BOOST_CHECK_EQUAL_COLLECTIONS(turbine.begin(), turbine.end(), expected.begin(), expected.end());
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test thermal time-series generation
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/solver/ts-generator/generator.h>
+#include <antares/study/study.h>
+
+using namespace Antares;
+using namespace Antares::Data;
+
+namespace
+{
+constexpr unsigned nbTimeSeries = 4;
+constexpr unsigned seed = 1234;
+
+std::shared_ptr<Yuni::Job::QueueService> createThreadPool(int size)
+{
+    auto threadPool = std::make_shared<Yuni::Job::QueueService>();
+    threadPool->maximumThreadCount(size);
+    return threadPool;
+}
+} // namespace
+
+/*!
+ * Study with one area, holding several clusters with forced outages
+ */
+struct ThermalStudy
+{
+    ThermalStudy()
+    {
+        study.parameters.derated = false;
+        study.parameters.nbTimeSeriesThermal = nbTimeSeries;
+        auto* area = study.areaAdd("A");
+
+        for (int i = 0; i < 6; i++)
+        {
+            auto cluster = std::make_shared<ThermalCluster>(area);
+            cluster->setName("cluster" + std::to_string(i));
+            cluster->reset();
+            cluster->unitCount = 5;
+            cluster->nominalCapacity = 100.;
+            cluster->prepro->data.fillColumn(PreproAvailability::foRate, 0.2);
+            cluster->prepro->data.fillColumn(PreproAvailability::foDuration, 3.);
+            area->thermal.list.addToCompleteList(cluster);
+            clusters.push_back(cluster.get());
+        }
+    }
+
+    std::vector<Matrix<double>> generate(const std::shared_ptr<Yuni::Job::QueueService>& pool)
+    {
+        MersenneTwister random;
+        random.reset(seed);
+        BOOST_CHECK(TSGenerator::generateThermalTimeSeries(study, clusters, random, pool));
+
+        std::vector<Matrix<double>> series;
+        for (auto* cluster: clusters)
+        {
+            series.emplace_back();
+            series.back().copyFrom(cluster->series.timeSeries);
+        }
+        return series;
+    }
+
+    Study study;
+    std::vector<ThermalCluster*> clusters;
+};
+
+bool sameSeries(const Matrix<double>& a, const Matrix<double>& b)
+{
+    if (a.width != b.width || a.height != b.height)
+    {
+        return false;
+    }
+    for (uint x = 0; x < a.width; ++x)
+    {
+        for (uint y = 0; y < a.height; ++y)
+        {
+            if (a[x][y] != b[x][y])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+BOOST_AUTO_TEST_SUITE(thermal_ts_generation)
+
+BOOST_FIXTURE_TEST_CASE(outages_are_drawn, ThermalStudy)
+{
+    auto series = generate(nullptr);
+
+    BOOST_REQUIRE_EQUAL(series.size(), clusters.size());
+    BOOST_CHECK_EQUAL(series[0].width, nbTimeSeries);
+    BOOST_CHECK_EQUAL(series[0].height, HOURS_PER_YEAR);
+    BOOST_CHECK(series[0].findLowerBound() < 500.);
+    BOOST_CHECK(series[0].findUpperBound() <= 500.);
+}
+
+BOOST_FIXTURE_TEST_CASE(clusters_get_independent_streams, ThermalStudy)
+{
+    auto series = generate(nullptr);
+
+    for (std::size_t i = 1; i < series.size(); ++i)
+    {
+        BOOST_CHECK(!sameSeries(series[0], series[i]));
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(same_series_whatever_the_number_of_threads, ThermalStudy)
+{
+    const auto sequential = generate(nullptr);
+
+    for (int threads: {1, 2, 4})
+    {
+        const auto parallel = generate(createThreadPool(threads));
+        BOOST_REQUIRE_EQUAL(parallel.size(), sequential.size());
+        for (std::size_t i = 0; i < parallel.size(); ++i)
+        {
+            BOOST_CHECK(sameSeries(sequential[i], parallel[i]));
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(running_thread_pool_is_left_running, ThermalStudy)
+{
+    auto pool = createThreadPool(2);
+    pool->start();
+
+    const auto sequential = generate(nullptr);
+    const auto parallel = generate(pool);
+    BOOST_CHECK(pool->started());
+    BOOST_CHECK(sameSeries(sequential[0], parallel[0]));
+
+    pool->stop();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
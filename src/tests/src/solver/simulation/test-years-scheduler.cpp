@@ -0,0 +1,136 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE years scheduler
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/simulation/years-scheduler.h"
+
+using namespace Antares::Solver::Simulation;
+
+BOOST_AUTO_TEST_CASE(spaces_are_taken_lowest_first_until_none_is_free)
+{
+    YearsScheduler scheduler(2, 2);
+    BOOST_CHECK(scheduler.hasFreeSpace());
+    BOOST_CHECK(!scheduler.hasYearsInFlight());
+
+    BOOST_CHECK_EQUAL(scheduler.dispatch(0), 0);
+    BOOST_CHECK_EQUAL(scheduler.dispatch(1), 1);
+    BOOST_CHECK(!scheduler.hasFreeSpace());
+    BOOST_CHECK(scheduler.hasYearsInFlight());
+}
+
+BOOST_AUTO_TEST_CASE(years_are_committed_in_dispatch_order_whatever_the_order_they_end_in)
+{
+    YearsScheduler scheduler(3, 3);
+    scheduler.dispatch(4);
+    scheduler.dispatch(5);
+    scheduler.dispatch(7);
+
+    scheduler.notifyEnded(7);
+    scheduler.notifyEnded(5);
+    BOOST_CHECK(!scheduler.oldestYearHasEnded());
+
+    scheduler.notifyEnded(4);
+    BOOST_CHECK(scheduler.oldestYearHasEnded());
+
+    std::vector<unsigned int> committed;
+    while (scheduler.hasYearsInFlight())
+    {
+        committed.push_back(scheduler.popOldestYear().year);
+    }
+    BOOST_CHECK(committed == std::vector<unsigned int>({4, 5, 7}));
+}
+
+BOOST_AUTO_TEST_CASE(space_of_a_committed_year_is_reused)
+{
+    YearsScheduler scheduler(2, 2);
+    scheduler.dispatch(0);
+    scheduler.dispatch(1);
+
+    scheduler.notifyEnded(0);
+    auto committed = scheduler.popOldestYear();
+    BOOST_CHECK_EQUAL(committed.year, 0);
+    BOOST_CHECK_EQUAL(committed.numSpace, 0);
+
+    BOOST_CHECK(scheduler.hasFreeSpace());
+    BOOST_CHECK_EQUAL(scheduler.dispatch(2), 0);
+}
+
+BOOST_AUTO_TEST_CASE(pop_waits_for_the_oldest_year_to_end)
+{
+    YearsScheduler scheduler(2, 2);
+    scheduler.dispatch(0);
+    scheduler.dispatch(1);
+
+    std::thread worker(
+      [&scheduler]
+      {
+          scheduler.notifyEnded(1);
+          scheduler.notifyEnded(0);
+      });
+
+    BOOST_CHECK_EQUAL(scheduler.popOldestYear().year, 0);
+    BOOST_CHECK_EQUAL(scheduler.popOldestYear().year, 1);
+    worker.join();
+}
+
+BOOST_AUTO_TEST_CASE(ended_year_frees_its_thread_but_keeps_its_space_until_committed)
+{
+    YearsScheduler scheduler(4, 2);
+    scheduler.dispatch(0);
+    BOOST_CHECK_EQUAL(scheduler.dispatch(1), 1);
+
+    // Year 1 ends while the oldest year is still running
+    scheduler.notifyEnded(1);
+    BOOST_CHECK(!scheduler.oldestYearHasEnded());
+    scheduler.waitForIdleThread();
+    BOOST_CHECK(scheduler.hasFreeSpace());
+    BOOST_CHECK_EQUAL(scheduler.dispatch(2), 2);
+
+    scheduler.notifyEnded(2);
+    scheduler.waitForIdleThread();
+    BOOST_CHECK_EQUAL(scheduler.dispatch(3), 3);
+    BOOST_CHECK(!scheduler.hasFreeSpace());
+
+    scheduler.notifyEnded(0);
+    BOOST_CHECK_EQUAL(scheduler.popOldestYear().numSpace, 0);
+    BOOST_CHECK_EQUAL(scheduler.popOldestYear().numSpace, 1);
+    BOOST_CHECK_EQUAL(scheduler.popOldestYear().numSpace, 2);
+    BOOST_CHECK(scheduler.hasFreeSpace());
+}
+
+BOOST_AUTO_TEST_CASE(wait_for_idle_thread_returns_when_a_running_year_ends)
+{
+    YearsScheduler scheduler(3, 1);
+    scheduler.dispatch(0);
+
+    std::thread worker([&scheduler] { scheduler.notifyEnded(0); });
+
+    scheduler.waitForIdleThread();
+    BOOST_CHECK_EQUAL(scheduler.dispatch(1), 1);
+    worker.join();
+}
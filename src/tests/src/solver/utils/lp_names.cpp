@@ -0,0 +1,134 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test lp names
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/solver/utils/lp_names.h>
+
+using Antares::Optimization::LpNames;
+
+BOOST_AUTO_TEST_CASE(unnamed_elements_have_empty_names)
+{
+    LpNames names(3);
+    BOOST_CHECK_EQUAL(names.size(), 3);
+    BOOST_CHECK(names.empty(1));
+    BOOST_CHECK_EQUAL(names[1], "");
+    BOOST_CHECK_THROW(names.at(3), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(labels_are_interned_once)
+{
+    LpNames names;
+    const auto fr = names.label("fr");
+    BOOST_CHECK_EQUAL(names.label("be"), fr + 1);
+    BOOST_CHECK_EQUAL(names.label(std::string("fr")), fr);
+}
+
+BOOST_AUTO_TEST_CASE(area_and_link_names)
+{
+    LpNames names(3);
+    LpNames::Descriptor descriptor;
+    descriptor.type = names.label("AreaBalance");
+    descriptor.first = names.label("fr");
+    descriptor.timeStep = 12;
+    descriptor.location = LpNames::Location::Area;
+    names.set(0, descriptor);
+
+    descriptor.timeStepType = LpNames::TimeStep::Week;
+    descriptor.type = names.label("HydroPower");
+    names.set(1, descriptor);
+
+    descriptor.type = names.label("NTCDirect");
+    descriptor.second = names.label("be");
+    descriptor.timeStepType = LpNames::TimeStep::Hour;
+    descriptor.location = LpNames::Location::Link;
+    names.set(2, descriptor);
+
+    BOOST_CHECK_EQUAL(names[0], "AreaBalance::area<fr>::hour<12>");
+    BOOST_CHECK_EQUAL(names[1], "HydroPower::area<fr>::week<12>");
+    BOOST_CHECK_EQUAL(names[2], "NTCDirect::link<fr$$be>::hour<12>");
+}
+
+BOOST_AUTO_TEST_CASE(spaces_are_replaced_in_structured_names_only)
+{
+    LpNames names(2);
+    LpNames::Descriptor descriptor;
+    descriptor.type = names.label("DispatchableProduction");
+    descriptor.first = names.label("fr");
+    descriptor.second = names.label("gas ccgt");
+    descriptor.timeStep = 3;
+    descriptor.location = LpNames::Location::ThermalCluster;
+    names.set(0, descriptor);
+    names.setVerbatim(1, "my variable");
+
+    BOOST_CHECK_EQUAL(names[0],
+                      "DispatchableProduction::area<fr>::ThermalCluster<gas*ccgt>::hour<3>");
+    BOOST_CHECK_EQUAL(names[1], "my variable");
+}
+
+BOOST_AUTO_TEST_CASE(binding_constraints_and_cumulation_names)
+{
+    LpNames names(3);
+    LpNames::Descriptor descriptor;
+    descriptor.type = names.label("bc");
+    descriptor.timeStep = 2;
+    descriptor.location = LpNames::Location::Granularity;
+    descriptor.timeStepType = LpNames::TimeStep::Day;
+    names.set(0, descriptor);
+
+    descriptor.type = names.label("LayerStorage");
+    descriptor.first = names.label("fr");
+    descriptor.second = 4;
+    descriptor.location = LpNames::Location::AreaLayer;
+    descriptor.timeStepType = LpNames::TimeStep::Hour;
+    names.set(1, descriptor);
+
+    descriptor.type = names.label("InjectionSum");
+    descriptor.second = names.label("battery");
+    descriptor.timeStep = names.label("c1_0");
+    descriptor.location = LpNames::Location::ShortTermStorage;
+    descriptor.timeStepType = LpNames::TimeStep::Constraint;
+    names.set(2, descriptor);
+
+    BOOST_CHECK_EQUAL(names[0], "bc::daily::day<2>");
+    BOOST_CHECK_EQUAL(names[1], "LayerStorage::area<fr>::Layer<4>::hour<2>");
+    BOOST_CHECK_EQUAL(names[2],
+                      "InjectionSum::area<fr>::ShortTermStorage<battery>::Constraint<c1_0>");
+}
+
+BOOST_AUTO_TEST_CASE(resize_keeps_labels)
+{
+    LpNames names(1);
+    names.setVerbatim(0, "x");
+    const auto fr = names.label("fr");
+    names.resize(4);
+    BOOST_CHECK_EQUAL(names.label("fr"), fr);
+    BOOST_CHECK_EQUAL(names[0], "x");
+    BOOST_CHECK(names.empty(3));
+
+    const auto all = names.materialize();
+    BOOST_CHECK_EQUAL(all.size(), 4);
+    BOOST_CHECK_EQUAL(all[0], "x");
+    BOOST_CHECK_EQUAL(all[3], "");
+}
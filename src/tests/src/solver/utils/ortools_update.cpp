@@ -0,0 +1,102 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test ortools problem updates
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/utils/ortools_utils.h"
+
+using namespace operations_research;
+
+// x in [0, 10], y >= 0
+// min x + 2y
+// c1 : x + y <= 5
+// c2 : x - y = 2
+struct SmallProblem
+{
+    SmallProblem()
+    {
+        x = solver.MakeNumVar(0, 10, "x");
+        y = solver.MakeNumVar(0, MPSolver::infinity(), "y");
+        solver.MutableObjective()->SetCoefficient(x, 1);
+        solver.MutableObjective()->SetCoefficient(y, 2);
+
+        c1 = solver.MakeRowConstraint(-MPSolver::infinity(), 5, "c1");
+        c1->SetCoefficient(x, 1);
+        c1->SetCoefficient(y, 1);
+        c2 = solver.MakeRowConstraint(2, 2, "c2");
+        c2->SetCoefficient(x, 1);
+        c2->SetCoefficient(y, -1);
+    }
+
+    MPSolver solver{"foo", MPSolver::GLOP_LINEAR_PROGRAMMING};
+    MPVariable* x;
+    MPVariable* y;
+    MPConstraint* c1;
+    MPConstraint* c2;
+};
+
+BOOST_FIXTURE_TEST_CASE(only_modified_costs_are_updated, SmallProblem)
+{
+    const double sameCosts[] = {1., 2.};
+    BOOST_CHECK_EQUAL(ORTOOLS_ModifierLeVecteurCouts(&solver, sameCosts, 2), 0);
+
+    const double costs[] = {1., 3.};
+    BOOST_CHECK_EQUAL(ORTOOLS_ModifierLeVecteurCouts(&solver, costs, 2), 1);
+    BOOST_CHECK_EQUAL(solver.Objective().GetCoefficient(x), 1.);
+    BOOST_CHECK_EQUAL(solver.Objective().GetCoefficient(y), 3.);
+}
+
+BOOST_FIXTURE_TEST_CASE(only_modified_right_hand_sides_are_updated, SmallProblem)
+{
+    const char sens[] = {'<', '='};
+    const double sameRhs[] = {5., 2.};
+    BOOST_CHECK_EQUAL(ORTOOLS_ModifierLeVecteurSecondMembre(&solver, sameRhs, sens, 2), 0);
+
+    const double rhs[] = {5., 3.};
+    BOOST_CHECK_EQUAL(ORTOOLS_ModifierLeVecteurSecondMembre(&solver, rhs, sens, 2), 1);
+    BOOST_CHECK_EQUAL(c1->ub(), 5.);
+    BOOST_CHECK_EQUAL(c2->lb(), 3.);
+    BOOST_CHECK_EQUAL(c2->ub(), 3.);
+
+    // Same right-hand side, other direction
+    const char otherSens[] = {'>', '='};
+    BOOST_CHECK_EQUAL(ORTOOLS_ModifierLeVecteurSecondMembre(&solver, rhs, otherSens, 2), 1);
+    BOOST_CHECK_EQUAL(c1->lb(), 5.);
+    BOOST_CHECK_EQUAL(c1->ub(), MPSolver::infinity());
+}
+
+BOOST_FIXTURE_TEST_CASE(only_modified_bounds_are_updated, SmallProblem)
+{
+    const int typeVar[] = {VARIABLE_BORNEE_DES_DEUX_COTES, VARIABLE_BORNEE_INFERIEUREMENT};
+    // The upper bound of y is not used
+    const double xmin[] = {0., 0.};
+    const double xmax[] = {10., 123.};
+    BOOST_CHECK_EQUAL(ORTOOLS_CorrigerLesBornes(&solver, xmin, xmax, typeVar, 2), 0);
+
+    const double otherXmin[] = {1., 0.};
+    BOOST_CHECK_EQUAL(ORTOOLS_CorrigerLesBornes(&solver, otherXmin, xmax, typeVar, 2), 1);
+    BOOST_CHECK_EQUAL(x->lb(), 1.);
+    BOOST_CHECK_EQUAL(x->ub(), 10.);
+    BOOST_CHECK_EQUAL(y->ub(), MPSolver::infinity());
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test shared bases
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/solver/utils/shared_bases.h>
+
+#include "basis_status_impl.h"
+#include "ortools/linear_solver/linear_solver.h"
+
+using namespace operations_research;
+using Antares::Optimization::BasisStatus;
+using Antares::Optimization::SharedBases;
+
+namespace Test
+{
+class BasisStatus
+{
+public:
+    BasisStatus(const Antares::Optimization::BasisStatus& b):
+        StatutDesVariables(b.impl->StatutDesVariables)
+    {
+    }
+
+    using Status = operations_research::MPSolver::BasisStatus;
+    const std::vector<Status>& StatutDesVariables;
+};
+} // namespace Test
+
+// Optimal basis of a problem with nbVariables variables
+static void solveProblem(BasisStatus& basis, int nbVariables)
+{
+    // CLP_LINEAR_PROGRAMMING should be always available
+    MPSolver solver("foo", MPSolver::CLP_LINEAR_PROGRAMMING);
+    auto c = solver.MakeRowConstraint(0, 2, "c");
+    auto obj = solver.MutableObjective();
+    for (int i = 0; i < nbVariables; i++)
+    {
+        auto x = solver.MakeNumVar(0, 1, "x" + std::to_string(i));
+        obj->SetCoefficient(x, 1);
+        c->SetCoefficient(x, 1);
+    }
+    solver.Solve();
+    basis.extractBasis(&solver);
+}
+
+static size_t nbVariables(const BasisStatus& basis)
+{
+    return Test::BasisStatus(basis).StatutDesVariables.size();
+}
+
+BOOST_AUTO_TEST_CASE(no_basis_offered__nothing_copied)
+{
+    SharedBases bases;
+    BasisStatus basis;
+    BOOST_CHECK(!bases.copyBestBasis({0, 0, 1}, basis));
+    BOOST_CHECK(!basis.exists());
+}
+
+BOOST_AUTO_TEST_CASE(basis_offered__copied_for_the_same_problem_only)
+{
+    SharedBases bases;
+    BasisStatus offered;
+    solveProblem(offered, 1);
+    bases.offer({0, 0, 1}, offered, 10);
+
+    BasisStatus basis;
+    BOOST_CHECK(bases.copyBestBasis({0, 0, 1}, basis));
+    BOOST_CHECK_EQUAL(nbVariables(basis), 1);
+
+    BasisStatus otherWeek;
+    BOOST_CHECK(!bases.copyBestBasis({1, 0, 1}, otherWeek));
+    BasisStatus otherOptimization;
+    BOOST_CHECK(!bases.copyBestBasis({0, 0, 2}, otherOptimization));
+}
+
+BOOST_AUTO_TEST_CASE(several_bases_offered__basis_with_fewest_iterations_kept)
+{
+    SharedBases bases;
+    BasisStatus first, better, worse;
+    solveProblem(first, 1);
+    solveProblem(better, 2);
+    solveProblem(worse, 3);
+
+    bases.offer({0, 0, 1}, first, 10);
+    bases.offer({0, 0, 1}, better, 5);
+    bases.offer({0, 0, 1}, worse, 8);
+
+    BasisStatus basis;
+    BOOST_CHECK(bases.copyBestBasis({0, 0, 1}, basis));
+    BOOST_CHECK_EQUAL(nbVariables(basis), 2);
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test prunable variables
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/study/study.h>
+#include "antares/solver/variable/prunable.h"
+
+using namespace Antares::Solver::Variable;
+using Antares::Data::AllVariablesPrintInfo;
+using Antares::Data::VariablePrintInfo;
+
+namespace
+{
+struct VCardSingle
+{
+    static std::string Caption()
+    {
+        return "SINGLE";
+    }
+
+    static constexpr int columnCount = Category::singleColumn;
+};
+
+struct VCardMultiple
+{
+    static std::string Caption()
+    {
+        return "MULTIPLE";
+    }
+
+    static constexpr int columnCount = 2;
+
+    struct Multiple
+    {
+        static std::string Caption(const unsigned int indx)
+        {
+            return indx == 0 ? "FIRST" : "SECOND";
+        }
+    };
+};
+
+// Last variable of the list, counting the events it receives
+struct EndOfListMock
+{
+    void initializeFromStudy(Antares::Data::Study&)
+    {
+        ++initialized;
+    }
+
+    void yearBegin(unsigned int)
+    {
+        ++yearsBegun;
+    }
+
+    int initialized = 0;
+    int yearsBegun = 0;
+};
+
+struct VariableMock: public EndOfListMock
+{
+    using NextType = EndOfListMock;
+    using VCardType = VCardSingle;
+
+    void initializeFromStudy(Antares::Data::Study& study)
+    {
+        ++ownInitialized;
+        NextType::initializeFromStudy(study);
+    }
+
+    void yearBegin(unsigned int year)
+    {
+        ++ownYearsBegun;
+        NextType::yearBegin(year);
+    }
+
+    int ownInitialized = 0;
+    int ownYearsBegun = 0;
+};
+
+void addVariable(AllVariablesPrintInfo& printInfo, const std::string& name, bool printed)
+{
+    VariablePrintInfo info(Category::DataLevel::area, Category::FileLevel::id);
+    info.enablePrint(printed);
+    printInfo.add(name, info);
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(prunable)
+
+BOOST_AUTO_TEST_CASE(single_column_variable_is_required_only_when_printed)
+{
+    AllVariablesPrintInfo printInfo;
+    addVariable(printInfo, "SINGLE", true);
+    BOOST_CHECK(Prunable<VariableMock>::IsRequired(printInfo));
+
+    printInfo.setPrintStatus("SINGLE", false);
+    BOOST_CHECK(!Prunable<VariableMock>::IsRequired(printInfo));
+}
+
+BOOST_AUTO_TEST_CASE(multiple_columns_variable_is_required_when_any_column_is_printed)
+{
+    struct MultipleVariableMock: public VariableMock
+    {
+        using VCardType = VCardMultiple;
+    };
+
+    AllVariablesPrintInfo printInfo;
+    addVariable(printInfo, "FIRST", false);
+    addVariable(printInfo, "SECOND", true);
+    BOOST_CHECK(Prunable<MultipleVariableMock>::IsRequired(printInfo));
+
+    printInfo.setPrintStatus("SECOND", false);
+    BOOST_CHECK(!Prunable<MultipleVariableMock>::IsRequired(printInfo));
+}
+
+BOOST_AUTO_TEST_CASE(events_of_a_variable_not_printed_go_to_the_next_variable_only)
+{
+    Antares::Data::Study study;
+    addVariable(study.parameters.variablesPrintInfo, "SINGLE", false);
+
+    Prunable<VariableMock> variable;
+    variable.initializeFromStudy(study);
+    variable.yearBegin(0);
+
+    BOOST_CHECK(!variable.enabled());
+    BOOST_CHECK_EQUAL(variable.ownInitialized, 0);
+    BOOST_CHECK_EQUAL(variable.ownYearsBegun, 0);
+    BOOST_CHECK_EQUAL(variable.initialized, 1);
+    BOOST_CHECK_EQUAL(variable.yearsBegun, 1);
+}
+
+BOOST_AUTO_TEST_CASE(events_of_a_printed_variable_go_through_the_variable)
+{
+    Antares::Data::Study study;
+    addVariable(study.parameters.variablesPrintInfo, "SINGLE", true);
+
+    Prunable<VariableMock> variable;
+    variable.initializeFromStudy(study);
+    variable.yearBegin(0);
+
+    BOOST_CHECK(variable.enabled());
+    BOOST_CHECK_EQUAL(variable.ownInitialized, 1);
+    BOOST_CHECK_EQUAL(variable.ownYearsBegun, 1);
+    BOOST_CHECK_EQUAL(variable.initialized, 1);
+    BOOST_CHECK_EQUAL(variable.yearsBegun, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
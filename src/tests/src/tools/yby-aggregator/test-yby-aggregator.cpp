@@ -0,0 +1,380 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#define BOOST_TEST_MODULE yby - aggregator
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <cmath>
+#include <ctime>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "files-system.h"
+#include "result.h"
+#include "statistics.h"
+#include "zip-archive.h"
+
+extern "C"
+{
+#include <mz.h>
+#include <mz_strm.h>
+#include <mz_zip.h>
+#include <mz_zip_rw.h>
+}
+
+namespace tt = boost::test_tools;
+
+namespace
+{
+RowStatistics statisticsOf(const std::vector<double>& values)
+{
+    RowStatistics statistics;
+    for (double value: values)
+    {
+        statistics.add(value);
+    }
+    return statistics;
+}
+
+void checkSameStatistics(const RowStatistics& result, const RowStatistics& expected)
+{
+    BOOST_CHECK_EQUAL(result.count(), expected.count());
+    BOOST_TEST(result.mean() == expected.mean(), tt::tolerance(1e-12));
+    BOOST_TEST(result.stdDeviation() == expected.stdDeviation(), tt::tolerance(1e-12));
+    BOOST_CHECK_EQUAL(result.min(), expected.min());
+    BOOST_CHECK_EQUAL(result.max(), expected.max());
+}
+
+void writeZip(const std::filesystem::path& path,
+              const std::vector<std::pair<std::string, std::string>>& entries)
+{
+    void* writer = mz_zip_writer_create();
+    BOOST_REQUIRE(mz_zip_writer_open_file(writer, path.string().c_str(), 0, 0) == MZ_OK);
+    for (const auto& [name, content]: entries)
+    {
+        mz_zip_file info;
+        memset(&info, 0, sizeof(mz_zip_file));
+        info.filename = name.c_str();
+        info.compression_method = MZ_COMPRESS_METHOD_DEFLATE;
+        info.modified_date = info.creation_date = std::time(0);
+        BOOST_REQUIRE(mz_zip_writer_add_buffer(writer,
+                                               const_cast<char*>(content.data()),
+                                               static_cast<int32_t>(content.size()),
+                                               &info)
+                      == MZ_OK);
+    }
+    mz_zip_writer_close(writer);
+    mz_zip_writer_delete(&writer);
+}
+
+// Larger than the buffer used to read the entries
+std::string largeContent()
+{
+    std::string content;
+    for (int i = 0; content.size() < 200 * 1024; ++i)
+    {
+        content += std::to_string(i) + '\t' + std::to_string(i * 0.5) + '\n';
+    }
+    return content;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(row_statistics)
+
+BOOST_AUTO_TEST_CASE(merge___same_statistics_as_adding_all_the_values)
+{
+    const std::vector<double> first = {1., 4., -2.5, 10., 3.};
+    const std::vector<double> second = {7., -8., 0.5};
+
+    auto merged = statisticsOf(first);
+    merged.merge(statisticsOf(second));
+
+    std::vector<double> all = first;
+    all.insert(all.end(), second.begin(), second.end());
+    checkSameStatistics(merged, statisticsOf(all));
+}
+
+BOOST_AUTO_TEST_CASE(merge_with_empty_statistics___statistics_are_unchanged)
+{
+    const auto expected = statisticsOf({2., 6., 1.});
+
+    auto merged = expected;
+    merged.merge(RowStatistics());
+    checkSameStatistics(merged, expected);
+
+    RowStatistics empty;
+    empty.merge(expected);
+    checkSameStatistics(empty, expected);
+}
+
+BOOST_AUTO_TEST_CASE(values_of_a_row___mean_deviation_min_and_max)
+{
+    const auto statistics = statisticsOf({2., 4., 4., 4., 5., 5., 7., 9.});
+    BOOST_CHECK_EQUAL(statistics.count(), 8);
+    BOOST_TEST(statistics.mean() == 5., tt::tolerance(1e-12));
+    BOOST_TEST(statistics.stdDeviation() == 2., tt::tolerance(1e-12));
+    BOOST_CHECK_EQUAL(statistics.min(), 2.);
+    BOOST_CHECK_EQUAL(statistics.max(), 9.);
+}
+
+BOOST_AUTO_TEST_CASE(partial_statistics_of_several_threads___merged)
+{
+    VariableStatistics variable;
+    auto gather = [&variable](double value)
+    {
+        auto& partial = variable.forCurrentThread();
+        partial.resize(2);
+        partial[0].add(value);
+        partial[1].add(-value);
+    };
+
+    std::vector<std::thread> threads;
+    for (double value: {1., 2., 3., 4.})
+    {
+        threads.emplace_back(gather, value);
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+    gather(5.);
+
+    const auto rows = variable.merge();
+    BOOST_REQUIRE_EQUAL(rows.size(), 2);
+    checkSameStatistics(rows[0], statisticsOf({1., 2., 3., 4., 5.}));
+    checkSameStatistics(rows[1], statisticsOf({-1., -2., -3., -4., -5.}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(quantile)
+
+BOOST_AUTO_TEST_CASE(quantiles_between_two_values___linear_interpolation)
+{
+    std::vector<double> values = {40., 10., 30., 20., 50.};
+    BOOST_TEST(Quantile(values, 0.5) == 30., tt::tolerance(1e-12));
+    BOOST_TEST(Quantile(values, 0.1) == 14., tt::tolerance(1e-12));
+    BOOST_TEST(Quantile(values, 0.9) == 46., tt::tolerance(1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(lowest_and_highest_quantiles___min_and_max)
+{
+    std::vector<double> values = {3., -1., 7., 2.};
+    BOOST_CHECK_EQUAL(Quantile(values, 0.), -1.);
+    BOOST_CHECK_EQUAL(Quantile(values, 1.), 7.);
+}
+
+BOOST_AUTO_TEST_CASE(single_value___quantile_is_this_value)
+{
+    std::vector<double> values = {4.5};
+    BOOST_CHECK_EQUAL(Quantile(values, 0.3), 4.5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(cell_value)
+
+BOOST_AUTO_TEST_CASE(signed_values___both_signs_are_read)
+{
+    double value = 0.;
+    BOOST_CHECK(ParseCellValue("+1.5", value));
+    BOOST_CHECK_EQUAL(value, 1.5);
+    BOOST_CHECK(ParseCellValue("-1.5", value));
+    BOOST_CHECK_EQUAL(value, -1.5);
+    BOOST_CHECK(ParseCellValue("+inf", value));
+    BOOST_CHECK_EQUAL(value, std::numeric_limits<double>::infinity());
+    BOOST_CHECK(ParseCellValue("-inf", value));
+    BOOST_CHECK_EQUAL(value, -std::numeric_limits<double>::infinity());
+}
+
+BOOST_AUTO_TEST_CASE(cells_without_numeric_value___not_read)
+{
+    double value = 0.;
+    BOOST_CHECK(!ParseCellValue("N/A", value));
+    BOOST_CHECK(!ParseCellValue("", value));
+    BOOST_CHECK(!ParseCellValue("+", value));
+    BOOST_CHECK(!ParseCellValue("+-1", value));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(statistics_file)
+
+namespace
+{
+// Values of the rows written in the statistics file, by row
+std::vector<std::vector<double>> readStatisticsFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    // Pseudo header of 5 lines
+    for (int i = 0; i != 5; ++i)
+    {
+        std::getline(file, line);
+    }
+
+    std::vector<std::vector<double>> rows;
+    while (std::getline(file, line))
+    {
+        std::istringstream cells(line);
+        std::string cell;
+        std::getline(cells, cell, '\t'); // empty
+        std::getline(cells, cell, '\t'); // row number
+        auto& row = rows.emplace_back();
+        while (std::getline(cells, cell, '\t'))
+        {
+            row.push_back(std::stod(cell));
+        }
+    }
+    return rows;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(cells_with_a_plus_sign___in_the_statistics_and_the_quantiles)
+{
+    // One column per year, two rows
+    std::vector<std::vector<std::string>> years = {{"+1.5", "-1"}, {"2", "+3"}, {"+4", "N/A"}};
+    const uint height = 2;
+
+    ResultMatrix matrix;
+    matrix.resize(static_cast<uint>(years.size()));
+    matrix.heightAfterAggregation = height;
+    std::vector<std::unique_ptr<CellData[]>> storage;
+    for (std::size_t x = 0; x != years.size(); ++x)
+    {
+        storage.push_back(std::make_unique<CellData[]>(height));
+        for (uint y = 0; y != height; ++y)
+        {
+            strcpy(storage[x][y], years[x][y].c_str());
+        }
+        matrix.columns[x].rows = storage[x].get();
+        matrix.columns[x].height = height;
+        AccumulateColumn(matrix.statistics.forCurrentThread(), storage[x].get(), height);
+    }
+
+    statisticsOptions.quantiles = {0., 0.5, 1.};
+    const auto folder = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    const auto path = folder / "statistics.txt";
+    BOOST_REQUIRE(matrix.saveStatisticsToCSVFile(path.string().c_str()));
+    statisticsOptions.quantiles.clear();
+
+    // mean, std dev, min, max, then the quantiles
+    const auto rows = readStatisticsFile(path);
+    BOOST_REQUIRE_EQUAL(rows.size(), height);
+    BOOST_REQUIRE_EQUAL(rows[0].size(), 7);
+    BOOST_TEST(rows[0][0] == 2.5, tt::tolerance(1e-12));
+    BOOST_CHECK_EQUAL(rows[0][2], 1.5);
+    BOOST_CHECK_EQUAL(rows[0][3], 4.);
+    BOOST_CHECK_EQUAL(rows[0][4], 1.5);
+    BOOST_CHECK_EQUAL(rows[0][5], 2.);
+    BOOST_CHECK_EQUAL(rows[0][6], 4.);
+
+    BOOST_REQUIRE_EQUAL(rows[1].size(), 7);
+    BOOST_TEST(rows[1][0] == 1., tt::tolerance(1e-12));
+    BOOST_CHECK_EQUAL(rows[1][2], -1.);
+    BOOST_CHECK_EQUAL(rows[1][3], 3.);
+    BOOST_CHECK_EQUAL(rows[1][4], -1.);
+    BOOST_CHECK_EQUAL(rows[1][5], 1.);
+    BOOST_CHECK_EQUAL(rows[1][6], 3.);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(zip_archive)
+
+BOOST_AUTO_TEST_CASE(entries_of_an_archive___listed_and_read)
+{
+    const auto folder = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    const auto zipPath = folder / "output.zip";
+    const std::string large = largeContent();
+    writeZip(zipPath,
+             {{"economy/mc-ind/00001/areas/a/values-hourly.txt", "first"},
+              {"economy/mc-ind/00002/areas/a/values-hourly.txt", large},
+              {"info.antares-output", "[general]"}});
+
+    auto archive = ZipArchive::Open(zipPath);
+    BOOST_REQUIRE(archive);
+
+    const std::set<std::string> expectedEntries = {
+      "economy/mc-ind/00001/areas/a/values-hourly.txt",
+      "economy/mc-ind/00002/areas/a/values-hourly.txt",
+      "info.antares-output"};
+    BOOST_CHECK(archive->entries() == expectedEntries);
+    BOOST_CHECK(archive->exists("info.antares-output"));
+    BOOST_CHECK(!archive->exists("economy/mc-ind/00003/areas/a/values-hourly.txt"));
+
+    std::string content;
+    BOOST_CHECK(archive->read("economy/mc-ind/00001/areas/a/values-hourly.txt", content));
+    BOOST_CHECK_EQUAL(content, "first");
+    BOOST_CHECK(archive->read("economy/mc-ind/00002/areas/a/values-hourly.txt", content));
+    BOOST_CHECK(content == large);
+    BOOST_CHECK(!archive->read("missing.txt", content));
+}
+
+BOOST_AUTO_TEST_CASE(entries_read_by_several_threads___same_content)
+{
+    const auto folder = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    const auto zipPath = folder / "output.zip";
+    std::vector<std::pair<std::string, std::string>> entries;
+    for (int i = 0; i != 8; ++i)
+    {
+        entries.emplace_back("entry-" + std::to_string(i), largeContent() + std::to_string(i));
+    }
+    writeZip(zipPath, entries);
+
+    auto archive = ZipArchive::Open(zipPath);
+    BOOST_REQUIRE(archive);
+
+    std::vector<std::string> contents(entries.size());
+    std::vector<char> results(entries.size(), false);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i != entries.size(); ++i)
+    {
+        threads.emplace_back([&, i] { results[i] = archive->read(entries[i].first, contents[i]); });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    for (std::size_t i = 0; i != entries.size(); ++i)
+    {
+        BOOST_CHECK(results[i]);
+        BOOST_CHECK(contents[i] == entries[i].second);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(missing_archive___not_opened)
+{
+    const auto folder = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    BOOST_CHECK(!ZipArchive::Open(folder / "missing.zip"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,151 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <yuni/core/getopt.h>
+
+#include <antares/columnar/reader.h>
+#include <antares/logs/logs.h>
+
+using namespace Antares;
+
+namespace fs = std::filesystem;
+
+namespace
+{
+struct Settings
+{
+    Yuni::String::Vector paths;
+    //! Remove the columnar files once converted
+    bool remove = false;
+};
+
+bool parseOptions(int argc, const char* argv[], Settings& settings)
+{
+    Yuni::GetOpt::Parser parser;
+    parser.addParagraph("Convert columnar result files back to the text layout\n"
+                        "usage: antares-columnar-to-txt [--remove] <output folder or file>...\n");
+    parser.addFlag(settings.remove,
+                   ' ',
+                   "remove",
+                   "Remove the columnar files once converted");
+    parser.remainingArguments(settings.paths);
+
+    switch (parser(argc, argv))
+    {
+        using namespace Yuni::GetOpt;
+    case ReturnCode::error:
+        logs.error() << "Unknown arguments, aborting";
+        return false;
+    case ReturnCode::help:
+        return false;
+    default:
+        break;
+    }
+
+    if (settings.paths.empty())
+    {
+        logs.error() << "No output folder given";
+        return false;
+    }
+    return true;
+}
+
+bool convert(const fs::path& path, bool remove)
+{
+    std::string text;
+    try
+    {
+        Columnar::TableReader table(path);
+        table.toText(text);
+    }
+    catch (const std::exception& e)
+    {
+        logs.error() << path << ": " << e.what();
+        return false;
+    }
+
+    fs::path target = path;
+    target.replace_extension(".txt");
+    std::ofstream out(target, std::ios::binary);
+    if (!out.write(text.data(), static_cast<std::streamsize>(text.size())))
+    {
+        logs.error() << target << ": impossible to write the file";
+        return false;
+    }
+    out.close();
+
+    if (remove)
+    {
+        std::error_code ec;
+        fs::remove(path, ec);
+    }
+    return true;
+}
+
+bool convertAll(const Settings& settings)
+{
+    unsigned converted = 0;
+    unsigned failed = 0;
+    auto visit = [&](const fs::path& path)
+    {
+        if (path.extension() == Columnar::extension)
+        {
+            convert(path, settings.remove) ? ++converted : ++failed;
+        }
+    };
+
+    for (const auto& arg: settings.paths)
+    {
+        const fs::path path = arg.c_str();
+        if (!fs::is_directory(path))
+        {
+            visit(path);
+            continue;
+        }
+        for (const auto& entry: fs::recursive_directory_iterator(path))
+        {
+            if (entry.is_regular_file())
+            {
+                visit(entry.path());
+            }
+        }
+    }
+
+    logs.info() << converted << " files converted, " << failed << " failed";
+    return failed == 0;
+}
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    logs.applicationName("columnar-to-txt");
+
+    Settings settings;
+    if (!parseOptions(argc, argv, settings))
+    {
+        return 1;
+    }
+
+    return !convertAll(settings); // return 0 for success
+}
@@ -0,0 +1,147 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <yuni/core/getopt.h>
+
+#include <antares/array/matrix-cache.h>
+#include <antares/logs/logs.h>
+#include <antares/study/study.h>
+
+using namespace Antares;
+
+namespace fs = std::filesystem;
+
+namespace
+{
+struct Settings
+{
+    std::string studyFolder;
+    //! Check the existing entries instead of building the cache
+    bool verify = false;
+    //! Remove the entries that are not up to date
+    bool clean = false;
+};
+
+bool parseOptions(int argc, const char* argv[], Settings& settings)
+{
+    Yuni::GetOpt::Parser parser;
+    parser.addParagraph("Build or verify the binary cache of the input matrices of a study\n"
+                        "usage: antares-input-cache [--verify [--clean]] <study folder>\n");
+    parser.addFlag(settings.verify,
+                   ' ',
+                   "verify",
+                   "Check the existing entries against the input files instead of building "
+                   "the cache");
+    parser.addFlag(settings.clean,
+                   ' ',
+                   "clean",
+                   "With --verify, remove the entries that are not up to date");
+    parser.remainingArguments(settings.studyFolder);
+
+    switch (parser(argc, argv))
+    {
+        using namespace Yuni::GetOpt;
+    case ReturnCode::error:
+        logs.error() << "Unknown arguments, aborting";
+        return false;
+    case ReturnCode::help:
+        return false;
+    default:
+        break;
+    }
+
+    if (settings.studyFolder.empty())
+    {
+        logs.error() << "No study folder given";
+        return false;
+    }
+    return true;
+}
+
+bool buildCache(const Settings& settings)
+{
+    auto study = std::make_shared<Data::Study>(true);
+    Data::StudyLoadOptions options;
+    options.useInputCache = true;
+    if (!study->loadFromFolder(settings.studyFolder, options))
+    {
+        logs.error() << "Invalid study: " << settings.studyFolder;
+        return false;
+    }
+    logs.info() << "Input cache up to date in " << MatrixCache::folder;
+    return true;
+}
+
+bool verifyCache(const Settings& settings)
+{
+    const fs::path folder = fs::path(settings.studyFolder) / ".input-cache";
+    if (!fs::is_directory(folder))
+    {
+        logs.error() << "No input cache in " << settings.studyFolder;
+        return false;
+    }
+
+    unsigned upToDate = 0;
+    unsigned outdated = 0;
+    for (const auto& file: fs::directory_iterator(folder))
+    {
+        const fs::path& path = file.path();
+        auto status = path.extension() == MatrixCache::extension
+                        ? MatrixCache::Verify(path)
+                        : MatrixCache::Status::corrupted; // interrupted writes
+        if (status == MatrixCache::Status::upToDate)
+        {
+            ++upToDate;
+            continue;
+        }
+
+        ++outdated;
+        logs.warning() << path.filename() << ": "
+                       << (status == MatrixCache::Status::stale ? "stale" : "corrupted");
+        if (settings.clean)
+        {
+            std::error_code ec;
+            fs::remove(path, ec);
+        }
+    }
+
+    logs.info() << upToDate << " entries up to date, " << outdated
+                << (settings.clean ? " removed" : " to rebuild");
+    return settings.clean || outdated == 0;
+}
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    logs.applicationName("input-cache");
+
+    Settings settings;
+    if (!parseOptions(argc, argv, settings))
+    {
+        return 1;
+    }
+
+    bool success = settings.verify ? verifyCache(settings) : buildCache(settings);
+    return !success; // return 0 for success
+}
@@ -14,7 +14,7 @@ class LinksTSgenerator
 public:
     LinksTSgenerator(Settings&);
     void extractData();
-    bool generate();
+    bool generate(const std::shared_ptr<Yuni::Job::QueueService>& threadPool);
 
 private:
     LinkPairs extractLinkNamesFromStudy();
@@ -335,14 +335,14 @@ void LinksTSgenerator::extractLinksSpecificTSparameters()
     readPreproTimeSeries(linkList_, toLinksDir);
 }
 
-bool LinksTSgenerator::generate()
+bool LinksTSgenerator::generate(const std::shared_ptr<Yuni::Job::QueueService>& threadPool)
 {
     auto saveTSpath = fs::path(studyFolder_) / "output"
                       / formatTime(getCurrentTime(), "%Y%m%d-%H%M");
     saveTSpath /= "ts-generator";
     saveTSpath /= "links";
 
-    return generateLinkTimeSeries(linkList_, generalParams_, saveTSpath);
+    return generateLinkTimeSeries(linkList_, generalParams_, saveTSpath, threadPool);
 }
 
 } // namespace Antares::TSGenerator
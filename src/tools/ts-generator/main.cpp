@@ -18,9 +18,11 @@
 ** You should have received a copy of the Mozilla Public Licence 2.0
 ** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
 */
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include <antares/logs/logs.h>
 #include <antares/solver/ts-generator/generator.h>
@@ -80,6 +82,11 @@ int main(int argc, const char* argv[])
 
     bool return_code{true};
 
+    // Clusters and links are generated in parallel, with the same results whatever the number
+    // of threads
+    auto threadPool = std::make_shared<Yuni::Job::QueueService>();
+    threadPool->maximumThreadCount(std::max(1u, std::thread::hardware_concurrency()));
+
     if (thermalTSrequired(settings))
     {
         // === Data for TS generation ===
@@ -104,7 +111,10 @@ int main(int argc, const char* argv[])
         // === TS generation ===
         MersenneTwister thermalRandom;
         thermalRandom.reset(study->parameters.seed[Data::seedTsGenThermal]);
-        return_code = TSGenerator::generateThermalTimeSeries(*study, clusters, thermalRandom);
+        return_code = TSGenerator::generateThermalTimeSeries(*study,
+                                                            clusters,
+                                                            thermalRandom,
+                                                            threadPool);
 
         // === Writing generated TS on disk ===
         auto thermalSavePath = fs::path(settings.studyFolder) / "output"
@@ -118,7 +128,7 @@ int main(int argc, const char* argv[])
     {
         LinksTSgenerator linksTSgenerator(settings);
         linksTSgenerator.extractData();
-        return_code = linksTSgenerator.generate() && return_code;
+        return_code = linksTSgenerator.generate(threadPool) && return_code;
     }
 
     return !return_code; // return 0 for success
@@ -21,11 +21,17 @@
 
 #include "job.h"
 
+#include <algorithm>
+#include <cstring>
 #include <mutex>
+#include <stdexcept>
+
+#include <yuni/io/file.h>
 
 #include <antares/logs/logs.h>
 
 #include "progress.h"
+#include "statistics.h"
 
 using namespace Yuni;
 using namespace Antares;
@@ -107,17 +113,35 @@ bool JobFileReader::openCSVFile()
     pFilename << SEP;
     datafile->append(pFilename);
 
-    if (!pFile.open(pFilename))
+    // The error message will be disabled to allow invalid command line
+    // parameters.
+    if (output->archive)
     {
-        // The error message will be disabled to allow invalid command line
-        // parameters.
+        // Entries are always separated by '/' within an archive
+        std::string entry = pFilename.c_str();
+        std::replace(entry.begin(), entry.end(), '\\', '/');
+        if (!output->archive->read(entry, pEntryContent))
+        {
+            return false;
+        }
+        pContent = pEntryContent;
+        return true;
+    }
 
-        // logs.error() << "I/O error: impossible to open " << pFilename;
-        // high value to avoid the message 'too many errors'
-        // Like this, the output will be completely disabled
-        // output->errors = 99999;
+    if (!IO::File::Exists(pFilename))
+    {
         return false;
     }
+    try
+    {
+        pMappedFile = std::make_unique<Antares::Columnar::MappedFile>(pFilename.c_str());
+    }
+    catch (const std::runtime_error&)
+    {
+        logs.error() << "I/O error: impossible to open " << pFilename;
+        return false;
+    }
+    pContent = std::string_view(pMappedFile->data(), pMappedFile->size());
     return true;
 }
 
@@ -138,94 +162,35 @@ bool JobFileReader::readRawData()
         pTmpResults[i] = new CellData[maxRows];
     }
 
-    // A buffer when dealing with rows on several file buffers
-    CString<1024> line;
-    // The offset on the current file buffer
-    uint offset = pDataOffset;
-    // An adapter, for avoiding useless string copies
-    AnyString adapter;
+    // The whole file is available : the lines are simply delimited in place, without copy
+    const char* cursor = pContent.data() + pDataOffset;
+    const char* const end = pContent.data() + pContent.size();
     // The total number of lines which have been found in the CSV file
     uint nbLines = 0;
 
-    do
+    while (cursor < end)
     {
-        // Looking for the next end-of-line
-        String::Size pos = buffer.find('\n', offset);
-        if (pos < buffer.size())
+        // Looking for the next end-of-line (the last line may not have one)
+        auto* eol = static_cast<const char*>(memchr(cursor, '\n', end - cursor));
+        if (!eol)
         {
-            adapter.adapt(buffer.c_str() + offset, pos - offset);
-            if (!adapter.empty())
-            {
-                readLine(adapter, nbLines);
-            }
-            else
-            {
-                logs.warning() << "Got an empty line at " << (pLineCount + 8) << ": " << pFilename;
-            }
+            eol = end;
+        }
 
-            // Another line has been found
-            ++nbLines;
-            offset = pos + 1;
+        AnyString adapter(cursor, static_cast<uint>(eol - cursor));
+        if (!adapter.empty())
+        {
+            readLine(adapter, nbLines);
         }
         else
         {
-            // The end-of-line has not been found
-            // If the offset is invalid, we can simply read the next file buffer,
-            // and try again
-            if (offset >= buffer.size())
-            {
-                if (!pFile.read(buffer, buffer.chunkSize))
-                {
-                    break;
-                }
-                offset = 0;
-            }
-            else
-            {
-                // Otherwise, we have a line between two file chunks
-                // We will keep the piece of line we have already read into
-                // #line, another file chunk will be read, and we will try again
-                line.clear();
-                do
-                {
-                    line.append(buffer.c_str() + offset, buffer.size() - offset);
-                    if (!pFile.read(buffer, buffer.chunkSize))
-                    {
-                        break;
-                    }
-                    pos = buffer.find('\n');
-                    offset = 0;
-                } while (pos == String::npos);
-
-                // Adding the final chunk to the line currently read...
-                if (!buffer.empty())
-                {
-                    line.append(buffer.c_str(), pos);
-                }
-                offset = pos + 1;
-
-                // ... and analyzing it
-                if (!line.empty())
-                {
-                    readLine(line, nbLines);
-                }
-                else
-                {
-                    logs.warning()
-                      << "Got an empty line at " << (pLineCount + 8) << "*: " << pFilename;
-                }
-
-                // Another line has been found
-                ++nbLines;
-
-                // end-of-file
-                if (!buffer)
-                {
-                    break;
-                }
-            }
+            logs.warning() << "Got an empty line at " << (nbLines + 8) << ": " << pFilename;
         }
-    } while (true);
+
+        // Another line has been found
+        ++nbLines;
+        cursor = eol + 1;
+    }
 
     pLineCount = nbLines;
 
@@ -325,13 +290,6 @@ bool JobFileReader::storeResults()
         return false;
     }
 
-    std::lock_guard locker(gResultsMutex);
-
-    // The total number of variables
-    const uint nbVars = (uint)output->columns.size();
-
-    ResultsForAllStudyItems& results = output->results;
-    ResultsForAllDataLevels& alldatalevels = results[studydata->name];
     DataFile::Ptr& data = datafile;
     if (!data)
     {
@@ -339,8 +297,23 @@ bool JobFileReader::storeResults()
         output->incrementError();
         return false;
     }
-    ResultsForAllTimeLevels& alltimelevels = alldatalevels[data->dataLevel];
-    ResultsAllVars& allvars = alltimelevels[data->timeLevel];
+
+    // All the results have been allocated before the jobs are started : the maps
+    // are not modified anymore and can be looked up concurrently
+    ResultsAllVars& allvars = output->results.at(studydata->name)
+                                .at(data->dataLevel)
+                                .at(data->timeLevel);
+
+    // The values are parsed and accumulated outside the lock, by each thread on its own
+    if (statisticsOptions.enabled)
+    {
+        accumulateStatistics(allvars);
+    }
+
+    std::lock_guard locker(gResultsMutex);
+
+    // The total number of variables
+    const uint nbVars = (uint)output->columns.size();
 
     for (uint v = 0; v != nbVars; ++v)
     {
@@ -383,19 +356,30 @@ bool JobFileReader::storeResults()
     return true;
 }
 
-bool JobFileReader::prepareJumpTable()
+void JobFileReader::accumulateStatistics(ResultsAllVars& allvars) const
 {
-    // Looking for the 5th line
-    if (!pFile.read(buffer, buffer.chunkSize))
+    const uint nbVars = (uint)output->columns.size();
+    for (uint v = 0; v != nbVars; ++v)
     {
-        return false;
+        if (!pVariablesOn[v])
+        {
+            continue;
+        }
+
+        AccumulateColumn(allvars[v].statistics.forCurrentThread(), pTmpResults[v], pLineCount);
     }
+}
+
+bool JobFileReader::prepareJumpTable()
+{
+    // Looking for the 5th line
+    const std::string_view buffer = pContent;
 
-    String::Size offset = 0;
+    std::string_view::size_type offset = 0;
     for (uint i = 0; i != 4; ++i)
     {
-        const String::Size pos = buffer.find('\n', offset);
-        if (pos == String::npos)
+        const auto pos = buffer.find('\n', offset);
+        if (pos == std::string_view::npos)
         {
             logs.error() << "invalid header in " << pFilename;
             output->incrementError();
@@ -404,14 +388,14 @@ bool JobFileReader::prepareJumpTable()
         offset = pos + 1;
     }
     // Looking for the \n
-    String::Size pos = buffer.find('\n', offset);
-    if (pos == String::npos)
+    auto pos = buffer.find('\n', offset);
+    if (pos == std::string_view::npos)
     {
         logs.error() << "invalid header in " << pFilename;
         output->incrementError();
         return false;
     }
-    AnyString adapter(buffer.c_str() + offset, pos - offset);
+    AnyString adapter(buffer.data() + offset, static_cast<uint>(pos - offset));
     String::Vector list;
     adapter.split(list, "\t", true, false);
     if (list.size() < 3)
@@ -421,7 +405,7 @@ bool JobFileReader::prepareJumpTable()
         return false;
     }
 
-    pDataOffset = pos + 1;
+    pDataOffset = static_cast<uint>(pos + 1);
 
     uint startIndex = 0;
     const DataFile::ShortString& timeLevel = datafile->timeLevel;
@@ -489,13 +473,13 @@ bool JobFileReader::prepareJumpTable()
     for (uint s = 0; s != 2; ++s)
     {
         pos = buffer.find('\n', pos);
-        if (pos == String::npos)
+        if (pos == std::string_view::npos)
         {
             return false;
         }
         ++pos;
     }
 
-    pDataOffset = pos;
+    pDataOffset = static_cast<uint>(pos);
     return true;
 }
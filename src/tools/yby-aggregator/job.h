@@ -22,13 +22,15 @@
 #define __STUDY_JOB_AGGREGATOR_JOB_H__
 
 #include <memory>
+#include <string>
+#include <string_view>
 
 #include <yuni/yuni.h>
 #include <yuni/core/string.h>
-#include <yuni/io/file.h>
 #include <yuni/job/job.h>
 #include <yuni/job/queue/service.h>
 
+#include <antares/columnar/mapped_file.h>
 #include "antares/solver/ts-generator/xcast/studydata.h"
 
 #include "datafile.h"
@@ -78,12 +80,14 @@ protected:
     ** The job consists in reading a single CSV file from one of the
     ** numerous 'mc-i<year>' and to keep the results on its reading
     ** into the variable 'results' available in the output structure.
+    ** The file is mapped in memory, or read at once from the archive
+    ** when the output is zipped.
     */
     virtual void onExecute() override;
 
 private:
     /*!
-    ** \brief Try to open the CSV file
+    ** \brief Try to load the content of the CSV file
     */
     bool openCSVFile();
     /*!
@@ -100,22 +104,25 @@ private:
 
     bool storeResults();
 
+    //! Add the values read to the statistics of the variables
+    void accumulateStatistics(ResultsAllVars& allvars) const;
+
     //! Reset the jump table
     void resizeJumpTable(uint newsize);
 
 private:
     //! Type for a temporary column
     using TemporaryColumnData = CellData*;
-    //! Buffer type
-    using BufferType = Yuni::CString<65536>;
     //! Jump table
     using JumpTable = std::vector<uint>;
 
 private:
-    //! Buffer for reading data
-    BufferType buffer;
-    //! Stream
-    Yuni::IO::File::Stream pFile;
+    //! The CSV file, mapped in memory
+    std::unique_ptr<Antares::Columnar::MappedFile> pMappedFile;
+    //! The CSV file, read from the archive
+    std::string pEntryContent;
+    //! The content of the CSV file (from one of the above)
+    std::string_view pContent;
     //! CSV filename
     Yuni::String pFilename;
     //! Jump table
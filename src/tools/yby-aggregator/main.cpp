@@ -42,6 +42,8 @@
 #include "job.h"
 #include "output.h"
 #include "progress.h"
+#include "statistics.h"
+#include "zip-archive.h"
 
 using namespace Yuni;
 using namespace Antares;
@@ -144,6 +146,176 @@ static void AbortProgram(int code)
     exit(code);
 }
 
+static void AddJobsForYear(const Output::Ptr& output,
+                           uint year,
+                           const String& path,
+                           const DataFile::Vector& dataFiles,
+                           const StudyData::Vector& studydata,
+                           uint& nbJobs)
+{
+    for (uint d = 0; d != dataFiles.size(); ++d)
+    {
+        const DataFile::Ptr& data = dataFiles[d];
+
+        for (uint s = 0; s != studydata.size(); ++s)
+        {
+            JobFileReader* job = new JobFileReader();
+            job->year = year - 1;
+            job->datafile = data;
+            job->output = output;
+            job->studydata = studydata[s];
+            job->path = path;
+            // Adding the job
+            ++nbJobs;
+            queueService += job;
+        }
+    }
+}
+
+static void AllocateResults(Output& output,
+                            const DataFile::Vector& dataFiles,
+                            const StudyData::Vector& studydata,
+                            const String::Vector& columns)
+{
+    logs.info() << "  allocating resources for " << output.path;
+    ResultsForAllStudyItems& results = output.results;
+    for (uint s = 0; s != studydata.size(); ++s)
+    {
+        const StudyData::Ptr& sdata = studydata[s];
+        ResultsForAllDataLevels& alldatalevels = results[sdata->name];
+
+        for (uint d = 0; d != dataFiles.size(); ++d)
+        {
+            const DataFile::Ptr& data = dataFiles[d];
+            ResultsForAllTimeLevels& alltimelevels = alldatalevels[data->dataLevel];
+            ResultsAllVars& allvars = alltimelevels[data->timeLevel];
+            allvars.resize(columns.size());
+            for (uint v = 0; v != allvars.size(); ++v)
+            {
+                ResultMatrix& mtrx = allvars[v];
+                mtrx.resize(output.maxYear);
+            }
+        }
+    }
+}
+
+static bool SetYearRange(Output& output, uint minYear, uint maxYear)
+{
+    if (minYear > maxYear)
+    {
+        logs.warning() << output.path << ": invalid range for MC years";
+        return false;
+    }
+    uint nbYears = maxYear - minYear + 1;
+    logs.debug() << "  " << output.path << " : from " << minYear << " to " << maxYear
+                 << "  (total: " << nbYears << ")";
+
+    output.minYear = minYear;
+    output.maxYear = maxYear;
+    output.nbYears = nbYears;
+    return true;
+}
+
+/*!
+** \brief Prepare the aggregation of a zipped study output
+**
+** The CSV files are read directly from the archive, and the aggregates are written
+** into a folder named after the archive.
+*/
+static bool PrepareTheWorkFromArchive(const String& archivePath,
+                                      const DataFile::Vector& dataFiles,
+                                      const StudyData::Vector& studydata,
+                                      const String::Vector& columns,
+                                      uint& nbJobs)
+{
+    logs.info() << "  reading " << archivePath;
+
+    auto archive = ZipArchive::Open(archivePath.c_str());
+    if (!archive)
+    {
+        logs.warning() << "impossible to read the archive '" << archivePath << "'";
+        return true;
+    }
+    if (!archive->exists("info.antares-output"))
+    {
+        logs.warning() << "Does not seem a valid study output: " << archivePath;
+        return true;
+    }
+
+    // Looking for the individual years, whatever the simulation mode
+    const std::set<std::string>& entries = archive->entries();
+    std::string mcind;
+    std::string mode;
+    for (const char* candidate: {"economy", "Economy", "adequacy", "Adequacy"})
+    {
+        mcind = std::string(candidate) + "/mc-ind/";
+        auto first = entries.lower_bound(mcind);
+        if (first != entries.end() && first->starts_with(mcind))
+        {
+            mode = candidate;
+            break;
+        }
+    }
+    if (mode.empty())
+    {
+        logs.warning() << "impossible to find data for individual years: " << archivePath;
+        return true;
+    }
+
+    // The year folders, from the entries they contain
+    std::set<std::string> folders;
+    for (auto i = entries.lower_bound(mcind); i != entries.end() && i->starts_with(mcind); ++i)
+    {
+        auto separator = i->find('/', mcind.size());
+        if (separator != std::string::npos)
+        {
+            folders.insert(i->substr(mcind.size(), separator - mcind.size()));
+        }
+    }
+
+    // The aggregates are written next to the archive
+    String target;
+    target.assign(archivePath.c_str(), archivePath.size() - 4 /*.zip*/);
+    auto output = std::make_shared<Output>(target, columns);
+    output->archive = archive;
+    output->mcvarFolder << target << SEP << mode << SEP << "mc-var";
+
+    uint minYear = 9999999; // invalid
+    uint maxYear = 0;
+    Output::FolderName folderName;
+    String path;
+    for (const auto& folder: folders)
+    {
+        ++Progress::Total;
+        if (folder.size() < 5)
+        {
+            continue;
+        }
+
+        folderName = folder;
+        uint year;
+        if (!folderName.to(year))
+        {
+            logs.warning() << "invalid MC year: " << folder;
+            continue;
+        }
+        minYear = std::min(minYear, year);
+        maxYear = std::max(maxYear, year);
+
+        path.clear() << mcind << folder;
+        AddJobsForYear(output, year, path, dataFiles, studydata, nbJobs);
+    }
+    if (!SetYearRange(*output, minYear, maxYear))
+    {
+        return false;
+    }
+
+    // Adding the output
+    AllOutputs.push_back(output);
+    AllocateResults(*output, dataFiles, studydata, columns);
+    return true;
+}
+
 static void PrepareTheWork(const String::Vector& outputs,
                            const DataFile::Vector& dataFiles,
                            const StudyData::Vector& studydata,
@@ -163,6 +335,17 @@ static void PrepareTheWork(const String::Vector& outputs,
     {
         // The current study output
         IO::MakeAbsolute(abspath, outputs[indx]);
+
+        // Zipped study output
+        if (abspath.endsWith(".zip") && IO::File::Exists(abspath))
+        {
+            if (!PrepareTheWorkFromArchive(abspath, dataFiles, studydata, columns, nbJobs))
+            {
+                return;
+            }
+            continue;
+        }
+
         IO::Normalize(info.directory(), abspath);
         logs.info() << "  reading " << info.directory();
 
@@ -196,6 +379,7 @@ static void PrepareTheWork(const String::Vector& outputs,
         {
             continue;
         }
+        output->mcvarFolder << info.directory() << SEP << "mc-var";
         info.directory() << SEP << "mc-ind";
         if (not IO::Directory::Exists(info.directory()))
         {
@@ -234,61 +418,18 @@ static void PrepareTheWork(const String::Vector& outputs,
                 maxYear = year;
             }
 
-            for (uint d = 0; d != dataFiles.size(); ++d)
-            {
-                const DataFile::Ptr& data = dataFiles[d];
-
-                for (uint s = 0; s != studydata.size(); ++s)
-                {
-                    JobFileReader* job = new JobFileReader();
-                    job->year = year - 1;
-                    job->datafile = data;
-                    job->output = output;
-                    job->studydata = studydata[s];
-                    job->path = i.filename();
-                    // Adding the job
-                    ++nbJobs;
-                    queueService += job;
-                }
-            }
+            AddJobsForYear(output, year, i.filename(), dataFiles, studydata, nbJobs);
         }
-        if (minYear > maxYear)
+        if (!SetYearRange(*output, minYear, maxYear))
         {
-            logs.warning() << info.directory() << ": invalid range for MC years";
             return;
         }
-        uint nbYears = maxYear - minYear + 1;
-        logs.debug() << "  " << info.directory() << " : from " << minYear << " to " << maxYear
-                     << "  (total: " << nbYears << ")";
-
-        output->minYear = minYear;
-        output->maxYear = maxYear;
-        output->nbYears = nbYears;
 
         // Adding the output
         AllOutputs.push_back(output);
 
         // Allocating the resources for the output
-        logs.info() << "  allocating resources for " << info.directory();
-        ResultsForAllStudyItems& results = output->results;
-        for (uint s = 0; s != studydata.size(); ++s)
-        {
-            const StudyData::Ptr& sdata = studydata[s];
-            ResultsForAllDataLevels& alldatalevels = results[sdata->name];
-
-            for (uint d = 0; d != dataFiles.size(); ++d)
-            {
-                const DataFile::Ptr& data = dataFiles[d];
-                ResultsForAllTimeLevels& alltimelevels = alldatalevels[data->dataLevel];
-                ResultsAllVars& allvars = alltimelevels[data->timeLevel];
-                allvars.resize(columns.size());
-                for (uint v = 0; v != allvars.size(); ++v)
-                {
-                    ResultMatrix& mtrx = allvars[v];
-                    mtrx.resize(maxYear);
-                }
-            }
-        }
+        AllocateResults(*output, dataFiles, studydata, columns);
     } // each output
 
     logs.info() << "  added " << nbJobs << " jobs for " << info.directory();
@@ -304,6 +445,7 @@ static void ReadCommandLineOptions(int argc, const char** argv)
     String::Vector optDatum;
     String::Vector optAreas;
     String::Vector optLinks;
+    String::Vector optQuantiles;
     bool optForce = false;
 
     // Command Line options
@@ -327,6 +469,16 @@ static void ReadCommandLineOptions(int argc, const char** argv)
         options.add(optColumns, 'c', "column", "add a column to consider during the aggregation");
         options.addFlag(optForce, ' ', "force", "ignore warnings");
 
+        options.addParagraph("\nStatistics");
+        options.addFlag(statisticsOptions.enabled,
+                        's',
+                        "stats",
+                        "also write the statistics over the years (mean, std dev, min, max)");
+        options.add(optQuantiles,
+                    'q',
+                    "quantile",
+                    "add a quantile to the statistics, in [0, 1] (implies --stats)");
+
         options.addParagraph("\nResources");
 
         options.add(optJobs,
@@ -385,6 +537,19 @@ static void ReadCommandLineOptions(int argc, const char** argv)
             }
         }
 
+        for (uint i = 0; i != optQuantiles.size(); ++i)
+        {
+            double p;
+            if (!optQuantiles[i].to(p) || p < 0. || p > 1.)
+            {
+                logs.error() << "invalid quantile: " << optQuantiles[i];
+                LocalPolicy::Close();
+                AbortProgram(1);
+            }
+            statisticsOptions.quantiles.push_back(p);
+            statisticsOptions.enabled = true;
+        }
+
         if (optJobs < 1)
         {
             optJobs = 1;
@@ -507,13 +672,7 @@ static bool WriteAggregates()
             }
         }
 
-        String mcvarfolder;
-        if (!DetermineOutputType(mcvarfolder, output->path))
-        {
-            logs.error() << "impossible to find output folder in " << output->path;
-            continue;
-        }
-        mcvarfolder << SEP << "mc-var";
+        const String& mcvarfolder = output->mcvarFolder;
 
         ResultsForAllStudyItems& results = output->results;
         const ResultsForAllStudyItems::iterator rend = results.end();
@@ -631,6 +790,17 @@ static bool WriteAggregates()
                             {
                                 logs.error() << "impossible to write " << path;
                             }
+                            if (statisticsOptions.enabled)
+                            {
+                                // Same name, with the suffix '-stats'
+                                path.chop(4 /*.txt*/);
+                                path << "-stats.txt";
+                                logs.info() << "    writing " << path;
+                                if (!matrix.saveStatisticsToCSVFile(path))
+                                {
+                                    logs.error() << "impossible to write " << path;
+                                }
+                            }
                             // empty log entry
                             logs.info();
                         }
@@ -28,6 +28,7 @@
 #include <yuni/core/string.h>
 
 #include "result.h"
+#include "zip-archive.h"
 
 class Output final
 {
@@ -62,8 +63,12 @@ public:
     uint maxYear;
     //! The total number of years
     uint nbYears;
-    //! The study output directory
+    //! The study output directory (without extension for a zipped output)
     const Yuni::String path;
+    //! The archive of a zipped output, null otherwise
+    ZipArchive::Ptr archive;
+    //! The folder where the aggregates are written
+    Yuni::String mcvarFolder;
     //! All columns to extract
     const Yuni::String::Vector columns;
     //! The number of errors
@@ -21,6 +21,9 @@
 
 #include "result.h"
 
+#include <charconv>
+#include <cstring>
+
 #include "progress.h"
 
 using namespace Yuni;
@@ -37,6 +40,15 @@ void AppendToBuffer(StringT& out, const char* buffer)
     out.append(buffer, length);
 }
 
+template<class StringT>
+void AppendDouble(StringT& out, double value)
+{
+    // Shortest representation allowing to read back the exact same value
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, (uint)(result.ptr - buffer));
+}
+
 } // anonymous namespace
 
 CellColumnData::CellColumnData():
@@ -231,3 +243,109 @@ bool ResultMatrix::saveToCSVFile(const String& filename) const
     }
     return true;
 }
+
+void AccumulateColumn(PartialStatistics& statistics, const CellData* column, uint height)
+{
+    if (statistics.size() < height)
+    {
+        statistics.resize(height);
+    }
+    for (uint y = 0; y != height; ++y)
+    {
+        double value;
+        if (ParseCellValue(column[y], value))
+        {
+            statistics[y].add(value);
+        }
+    }
+}
+
+bool ResultMatrix::saveStatisticsToCSVFile(const String& filename) const
+{
+    IO::File::Stream file;
+    if (!file.openRW(filename))
+    {
+        return false;
+    }
+
+    Progress::Total = heightAfterAggregation;
+    const PartialStatistics rows = statistics.merge();
+    const std::vector<double>& quantiles = statisticsOptions.quantiles;
+
+    String buffer;
+    buffer.reserve(1024 * 1024);
+
+    // Writing pseudo header like any other CSV in antares
+    buffer << "mc-var\tstatistics\n"
+           << "\t\tBEGIN\tEND\n"
+           << "\t\t1\t" << heightAfterAggregation << '\n';
+    buffer << '\n';
+    buffer << "\t\tmean\tstd dev\tmin\tmax";
+    for (double p: quantiles)
+    {
+        buffer << "\tq";
+        AppendDouble(buffer, p * 100.);
+    }
+    buffer << '\n';
+
+    // Values of all the years for the current row, for the quantiles
+    std::vector<double> values;
+    values.reserve(width);
+
+    for (uint y = 0; y != heightAfterAggregation; ++y)
+    {
+        buffer << '\t' << (1 + y);
+        if (y < rows.size() && rows[y].count())
+        {
+            const RowStatistics& row = rows[y];
+            for (double value: {row.mean(), row.stdDeviation(), row.min(), row.max()})
+            {
+                buffer << '\t';
+                AppendDouble(buffer, value);
+            }
+        }
+        else
+        {
+            buffer << "\t\t\t\t";
+        }
+
+        if (!quantiles.empty())
+        {
+            values.clear();
+            for (uint x = 0; x < width; ++x)
+            {
+                if (columns[x].rows && y < columns[x].height)
+                {
+                    double value;
+                    // Same cells as the ones accumulated into the statistics
+                    if (ParseCellValue(columns[x].rows[y], value))
+                    {
+                        values.push_back(value);
+                    }
+                }
+            }
+            for (double p: quantiles)
+            {
+                buffer << '\t';
+                if (!values.empty())
+                {
+                    AppendDouble(buffer, Quantile(values, p));
+                }
+            }
+        }
+        buffer << '\n';
+
+        if (buffer.size() > 1024 * 1024 * 8)
+        {
+            file << buffer;
+            buffer.clear();
+        }
+        ++Progress::Current;
+    }
+
+    if (not buffer.empty())
+    {
+        file << buffer;
+    }
+    return true;
+}
@@ -30,6 +30,7 @@
 #include "antares/solver/ts-generator/xcast/studydata.h"
 
 #include "datafile.h"
+#include "statistics.h"
 #include "studydata.h"
 
 using namespace Yuni;
@@ -91,15 +92,32 @@ public:
     */
     bool saveToCSVFile(const Yuni::String& filename) const;
 
+    /*!
+    ** \brief Export the statistics over the years into a CSV file
+    **
+    ** Mean, standard deviation, min and max come from the statistics gathered
+    ** while reading, the quantiles are computed from all the years.
+    */
+    bool saveStatisticsToCSVFile(const Yuni::String& filename) const;
+
 public:
     CellColumnData* columns;
     //! Width of the matrix
     uint width;
     //! Valid Height found after aggregation
     uint heightAfterAggregation;
+    //! Statistics over the years, gathered while reading
+    VariableStatistics statistics;
 
 }; // class ResultMatrix
 
+/*!
+** \brief Add the values of a column (a year) to the statistics of its rows
+**
+** Cells without any numeric value (e.g. 'N/A') are ignored.
+*/
+void AccumulateColumn(PartialStatistics& statistics, const CellData* column, uint height);
+
 using ResultsAllVars = std::vector<ResultMatrix>;
 
 using ResultsForAllTimeLevels = std::map<DataFile::ShortString, ResultsAllVars>;
@@ -0,0 +1,143 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "statistics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+
+/*extern*/ StatisticsOptions statisticsOptions;
+
+void RowStatistics::add(double value)
+{
+    ++pCount;
+    const double delta = value - pMean;
+    pMean += delta / pCount;
+    pM2 += delta * (value - pMean);
+    pMin = std::min(pMin, value);
+    pMax = std::max(pMax, value);
+}
+
+void RowStatistics::merge(const RowStatistics& other)
+{
+    if (!other.pCount)
+    {
+        return;
+    }
+    if (!pCount)
+    {
+        *this = other;
+        return;
+    }
+    const double count = static_cast<double>(pCount) + other.pCount;
+    const double delta = other.pMean - pMean;
+    pMean += delta * other.pCount / count;
+    pM2 += other.pM2 + delta * delta * pCount * other.pCount / count;
+    pCount += other.pCount;
+    pMin = std::min(pMin, other.pMin);
+    pMax = std::max(pMax, other.pMax);
+}
+
+double RowStatistics::stdDeviation() const
+{
+    return pCount ? std::sqrt(pM2 / pCount) : 0.;
+}
+
+namespace
+{
+//! Slot of the calling thread in the partial statistics of every variable
+uint ThreadSlot()
+{
+    static std::atomic<uint> nextSlot = 0;
+    thread_local const uint slot = nextSlot++;
+    return slot;
+}
+} // namespace
+
+PartialStatistics& VariableStatistics::forCurrentThread()
+{
+    const uint slot = ThreadSlot();
+
+    std::lock_guard locker(pMutex);
+    if (pPartials.size() <= slot)
+    {
+        pPartials.resize(slot + 1);
+    }
+    auto& partial = pPartials[slot];
+    if (!partial)
+    {
+        partial = std::make_unique<PartialStatistics>();
+    }
+    return *partial;
+}
+
+PartialStatistics VariableStatistics::merge() const
+{
+    std::lock_guard locker(pMutex);
+    PartialStatistics result;
+    for (const auto& partial: pPartials)
+    {
+        if (!partial)
+        {
+            continue;
+        }
+        if (result.size() < partial->size())
+        {
+            result.resize(partial->size());
+        }
+        for (uint row = 0; row != partial->size(); ++row)
+        {
+            result[row].merge((*partial)[row]);
+        }
+    }
+    return result;
+}
+
+bool ParseCellValue(std::string_view cell, double& value)
+{
+    // from_chars reads a leading '-' but not a leading '+'
+    if (cell.size() > 1 && cell.front() == '+' && cell[1] != '-' && cell[1] != '+')
+    {
+        cell.remove_prefix(1);
+    }
+    auto [ptr, ec] = std::from_chars(cell.data(), cell.data() + cell.size(), value);
+    return ec == std::errc();
+}
+
+double Quantile(std::vector<double>& values, double p)
+{
+    assert(!values.empty());
+    const double rank = p * (values.size() - 1);
+    const auto lower = static_cast<std::size_t>(rank);
+
+    std::nth_element(values.begin(), values.begin() + lower, values.end());
+    const double low = values[lower];
+    if (lower + 1 >= values.size())
+    {
+        return low;
+    }
+    // The next value is the smallest of the upper part
+    const double high = *std::min_element(values.begin() + lower + 1, values.end());
+    return low + (rank - lower) * (high - low);
+}
@@ -0,0 +1,134 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __STUDY_STATISTICS_AGGREGATOR_STATISTICS_H__
+#define __STUDY_STATISTICS_AGGREGATOR_STATISTICS_H__
+
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include <yuni/yuni.h>
+
+//! Statistics options, given from the command line
+struct StatisticsOptions final
+{
+    //! Write the statistics over the years
+    bool enabled = false;
+    //! Quantiles to write (in ]0, 1[), computed from all the years
+    std::vector<double> quantiles;
+};
+
+//! The statistics options
+extern StatisticsOptions statisticsOptions;
+
+/*!
+** \brief Statistics of a single row (a time step), over the years
+**
+** Mean and variance are updated on the fly (Welford), and two partial statistics
+** can be merged (Chan et al.) : each thread may gather its own years.
+*/
+class RowStatistics final
+{
+public:
+    //! Add the value of a year
+    void add(double value);
+    //! Merge statistics gathered on other years
+    void merge(const RowStatistics& other);
+
+    uint count() const
+    {
+        return pCount;
+    }
+
+    double mean() const
+    {
+        return pMean;
+    }
+
+    //! Standard deviation of the population
+    double stdDeviation() const;
+
+    double min() const
+    {
+        return pMin;
+    }
+
+    double max() const
+    {
+        return pMax;
+    }
+
+private:
+    uint pCount = 0;
+    double pMean = 0.;
+    //! Sum of the squared differences to the mean
+    double pM2 = 0.;
+    double pMin = std::numeric_limits<double>::infinity();
+    double pMax = -std::numeric_limits<double>::infinity();
+
+}; // class RowStatistics
+
+//! Statistics of all the rows of a variable
+using PartialStatistics = std::vector<RowStatistics>;
+
+/*!
+** \brief Statistics of a variable, gathered by all the jobs reading its years
+**
+** Each thread accumulates into its own partial statistics : they are indexed by a slot given
+** to each thread on its first use of any variable. The partial statistics are merged once all
+** the jobs are done.
+*/
+class VariableStatistics final
+{
+public:
+    //! Partial statistics of the calling thread (created on its first use)
+    PartialStatistics& forCurrentThread();
+
+    //! Merge all the partial statistics
+    PartialStatistics merge() const;
+
+private:
+    mutable std::mutex pMutex;
+    //! Partial statistics, indexed by the slot of the thread which gathered them
+    std::vector<std::unique_ptr<PartialStatistics>> pPartials;
+
+}; // class VariableStatistics
+
+/*!
+** \brief Read the numeric value of a cell
+**
+** Signs are handled the same way whatever the value : "+inf" and "+1.5" are read like "-inf"
+** and "-1.5".
+**
+** \return False if the cell has no numeric value (e.g. 'N/A')
+*/
+bool ParseCellValue(std::string_view cell, double& value);
+
+/*!
+** \brief Quantile of a set of values (linear interpolation between the closest ranks)
+**
+** The values are partially sorted.
+*/
+double Quantile(std::vector<double>& values, double p);
+
+#endif // __STUDY_STATISTICS_AGGREGATOR_STATISTICS_H__
@@ -0,0 +1,149 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "zip-archive.h"
+
+extern "C"
+{
+#include <mz.h>
+#include <mz_strm.h>
+#include <mz_zip.h>
+#include <mz_zip_rw.h>
+}
+
+namespace // anonymous
+{
+void* OpenReader(const std::filesystem::path& path)
+{
+    void* reader = mz_zip_reader_create();
+    if (reader && mz_zip_reader_open_file(reader, path.string().c_str()) != MZ_OK)
+    {
+        mz_zip_reader_delete(&reader);
+        return nullptr;
+    }
+    return reader;
+}
+
+void CloseReader(void* reader)
+{
+    mz_zip_reader_close(reader);
+    mz_zip_reader_delete(&reader);
+}
+
+} // anonymous namespace
+
+ZipArchive::Ptr ZipArchive::Open(const std::filesystem::path& path)
+{
+    auto archive = std::make_shared<ZipArchive>(path);
+
+    void* reader = OpenReader(path);
+    if (!reader)
+    {
+        return nullptr;
+    }
+    for (int32_t err = mz_zip_reader_goto_first_entry(reader); err == MZ_OK;
+         err = mz_zip_reader_goto_next_entry(reader))
+    {
+        mz_zip_file* info = nullptr;
+        if (mz_zip_reader_entry_get_info(reader, &info) == MZ_OK && info && info->filename)
+        {
+            archive->pEntries.emplace(info->filename);
+        }
+    }
+    archive->releaseReader(reader);
+    return archive;
+}
+
+ZipArchive::ZipArchive(const std::filesystem::path& path):
+    pPath(path)
+{
+}
+
+ZipArchive::~ZipArchive()
+{
+    for (void* reader: pReaders)
+    {
+        CloseReader(reader);
+    }
+}
+
+bool ZipArchive::exists(const std::string& entry) const
+{
+    return pEntries.count(entry) != 0;
+}
+
+bool ZipArchive::read(const std::string& entry, std::string& out)
+{
+    out.clear();
+    if (!exists(entry))
+    {
+        return false;
+    }
+
+    void* reader = acquireReader();
+    if (!reader)
+    {
+        return false;
+    }
+
+    bool success = false;
+    if (mz_zip_reader_locate_entry(reader, entry.c_str(), 0) == MZ_OK
+        && mz_zip_reader_entry_open(reader) == MZ_OK)
+    {
+        mz_zip_file* info = nullptr;
+        if (mz_zip_reader_entry_get_info(reader, &info) == MZ_OK && info)
+        {
+            out.reserve(static_cast<std::size_t>(info->uncompressed_size));
+        }
+
+        char buffer[65536];
+        int32_t read;
+        while ((read = mz_zip_reader_entry_read(reader, buffer, sizeof(buffer))) > 0)
+        {
+            out.append(buffer, static_cast<std::size_t>(read));
+        }
+        success = (read == 0);
+        mz_zip_reader_entry_close(reader);
+    }
+
+    releaseReader(reader);
+    return success;
+}
+
+void* ZipArchive::acquireReader()
+{
+    {
+        std::lock_guard locker(pMutex);
+        if (!pReaders.empty())
+        {
+            void* reader = pReaders.back();
+            pReaders.pop_back();
+            return reader;
+        }
+    }
+    return OpenReader(pPath);
+}
+
+void ZipArchive::releaseReader(void* reader)
+{
+    std::lock_guard locker(pMutex);
+    pReaders.push_back(reader);
+}
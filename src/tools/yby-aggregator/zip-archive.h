@@ -0,0 +1,91 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __STUDY_ZIP_ARCHIVE_AGGREGATOR_ZIP_ARCHIVE_H__
+#define __STUDY_ZIP_ARCHIVE_AGGREGATOR_ZIP_ARCHIVE_H__
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+/*!
+** \brief Read-only access to a study output written as a zip archive
+**
+** The entries are read directly from the archive, without extracting it first. Several
+** jobs may read entries concurrently : each one borrows its own reader, the readers being
+** kept open and reused from a job to another.
+*/
+class ZipArchive final
+{
+public:
+    //! The most suitable smart pointer
+    using Ptr = std::shared_ptr<ZipArchive>;
+
+    /*!
+    ** \brief Open an archive and list its entries
+    **
+    ** \return A null pointer if the archive can not be read
+    */
+    static Ptr Open(const std::filesystem::path& path);
+
+public:
+    explicit ZipArchive(const std::filesystem::path& path);
+    ~ZipArchive();
+
+    ZipArchive(const ZipArchive&) = delete;
+    ZipArchive& operator=(const ZipArchive&) = delete;
+
+    //! Does the archive contain this entry (path relative to the root of the archive) ?
+    bool exists(const std::string& entry) const;
+
+    //! All the entries of the archive, in alphabetical order
+    const std::set<std::string>& entries() const
+    {
+        return pEntries;
+    }
+
+    /*!
+    ** \brief Read the whole content of an entry
+    **
+    ** \return False if the entry does not exist or can not be read
+    */
+    bool read(const std::string& entry, std::string& out);
+
+private:
+    //! Take an opened reader, or open a new one if none is available
+    void* acquireReader();
+    //! Give a reader back, for another job to reuse it
+    void releaseReader(void* reader);
+
+private:
+    //! Path of the archive
+    const std::filesystem::path pPath;
+    //! All the entries
+    std::set<std::string> pEntries;
+    //! Readers not currently in use
+    std::vector<void*> pReaders;
+    std::mutex pMutex;
+
+}; // class ZipArchive
+
+#endif // __STUDY_ZIP_ARCHIVE_AGGREGATOR_ZIP_ARCHIVE_H__